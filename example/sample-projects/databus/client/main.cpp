@@ -86,7 +86,7 @@ static void RegisterSubscriptions(ClientState& s) {
         std::cout << "Client received DataMsg: " << msg.actuators.size() << " actuators, " << msg.sensors.size() << " sensors" << std::endl;
     });
 
-    s.statusConn = s.monitor.OnSendStatus.Connect(dmq::MakeDelegate([](dmq::DelegateRemoteId id, uint16_t seq, dmq::util::TransportMonitor::Status status) {
+    s.statusConn = s.monitor.OnSendStatus.Connect(dmq::MakeDelegate([](dmq::DelegateRemoteId id, uint32_t seq, dmq::util::TransportMonitor::Status status) {
         if (status == dmq::util::TransportMonitor::Status::TIMEOUT) {
             std::cerr << "!!! ALERT: Server not responding to command (RemoteID: " << id << " Seq: " << seq << ")" << std::endl;
         } else {
@@ -89,7 +89,7 @@ static void RegisterSubscriptions(ServerState& s) {
         g_pollingRateMs = msg.pollingRateMs;
     });
 
-    s.statusConn = s.monitor.OnSendStatus.Connect(dmq::MakeDelegate([](dmq::DelegateRemoteId id, uint16_t seq, dmq::util::TransportMonitor::Status status) {
+    s.statusConn = s.monitor.OnSendStatus.Connect(dmq::MakeDelegate([](dmq::DelegateRemoteId id, uint32_t seq, dmq::util::TransportMonitor::Status status) {
         if (status == dmq::util::TransportMonitor::Status::TIMEOUT) {
             std::cerr << "!!! ALERT: Client not acknowledging data (RemoteID: " << id << " Seq: " << seq << ")" << std::endl;
         }
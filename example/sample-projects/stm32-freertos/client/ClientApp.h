@@ -129,7 +129,7 @@ private:
             std::cout << "ClientApp Error: " << id << " " << (int)error << " " << aux << std::endl;
     }
 
-    void SendStatusHandler(dmq::DelegateRemoteId id, uint16_t seqNum, dmq::util::TransportMonitor::Status status)
+    void SendStatusHandler(dmq::DelegateRemoteId id, uint32_t seqNum, dmq::util::TransportMonitor::Status status)
     {
         // Log timeouts so you know Retries are happening, but don't treat as fatal
         if (status != dmq::util::TransportMonitor::Status::SUCCESS)
@@ -57,7 +57,7 @@ void NetworkMgr::OnError(DelegateRemoteId id, DelegateError error, DelegateError
     OnNetworkError(id, error, aux);
 }
 
-void NetworkMgr::OnStatus(dmq::DelegateRemoteId id, uint16_t seq, dmq::util::TransportMonitor::Status status) {
+void NetworkMgr::OnStatus(dmq::DelegateRemoteId id, uint32_t seq, dmq::util::TransportMonitor::Status status) {
     OnSendStatus(id, seq, status);
 }
 
@@ -166,7 +166,7 @@ private:
     // ------------------------------------------------------------------------
     // STATUS HANDLER: The Circuit Breaker (Cleaner Version)
     // ------------------------------------------------------------------------
-    void SendStatusHandler(dmq::DelegateRemoteId id, uint16_t seqNum, TransportMonitor::Status status)
+    void SendStatusHandler(dmq::DelegateRemoteId id, uint32_t seqNum, TransportMonitor::Status status)
     {
         if (status == TransportMonitor::Status::SUCCESS)
         {
@@ -192,7 +192,7 @@ private:
             // WARNING POINT: Approaching the limit
             else if (m_consecutiveErrors < MAX_CONSECUTIVE_ERRORS)
             {
-                printf("[ServerApp] Send Failed (Seq %d). Errors: %d/%d\n", seqNum, m_consecutiveErrors, MAX_CONSECUTIVE_ERRORS);
+                printf("[ServerApp] Send Failed (Seq %lu). Errors: %d/%d\n", (unsigned long)seqNum, m_consecutiveErrors, MAX_CONSECUTIVE_ERRORS);
             }
             // SILENT POINT: If > MAX, we already stopped. Don't spam logs.
         }
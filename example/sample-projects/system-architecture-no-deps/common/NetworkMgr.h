@@ -48,7 +48,7 @@ public:
     dmq::Signal<void(DataMsg&)>                                                         OnData;
     dmq::Signal<void(ActuatorMsg&)>                                                     OnActuator;
     dmq::Signal<void(dmq::DelegateRemoteId, dmq::DelegateError, dmq::DelegateErrorAux)> OnNetworkError;
-    dmq::Signal<void(dmq::DelegateRemoteId, uint16_t, dmq::util::TransportMonitor::Status)>   OnSendStatus;
+    dmq::Signal<void(dmq::DelegateRemoteId, uint32_t, dmq::util::TransportMonitor::Status)>   OnSendStatus;
 
     static NetworkMgr& Instance() { static NetworkMgr instance; return instance; }
 
@@ -68,7 +68,7 @@ public:
 protected:
     // Override base class hooks to fire our Signals
     void OnError(dmq::DelegateRemoteId id, dmq::DelegateError error, dmq::DelegateErrorAux aux) override;
-    void OnStatus(dmq::DelegateRemoteId id, uint16_t seq, dmq::util::TransportMonitor::Status status) override;
+    void OnStatus(dmq::DelegateRemoteId id, uint32_t seq, dmq::util::TransportMonitor::Status status) override;
 
 private:
     NetworkMgr();
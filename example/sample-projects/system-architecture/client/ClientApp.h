@@ -124,7 +124,7 @@ private:
             std::cout << "ClientApp Error: " << id << " " << (int)error << " " << aux << std::endl;
     }
 
-    void SendStatusHandler(dmq::DelegateRemoteId id, uint16_t seqNum, dmq::util::TransportMonitor::Status status)
+    void SendStatusHandler(dmq::DelegateRemoteId id, uint32_t seqNum, dmq::util::TransportMonitor::Status status)
     {
         if (status != dmq::util::TransportMonitor::Status::SUCCESS)
             std::cout << "ClientApp Timeout: " << id << " " << seqNum << std::endl;
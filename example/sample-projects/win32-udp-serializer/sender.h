@@ -105,7 +105,7 @@ private:
             std::cout << "ErrorHandler " << (int)err << std::endl;
     }
 
-    void OnSendStatus(DelegateRemoteId id, uint16_t seqNum, TransportMonitor::Status status)
+    void OnSendStatus(DelegateRemoteId id, uint32_t seqNum, TransportMonitor::Status status)
     {
         if (status == TransportMonitor::Status::TIMEOUT)
         {
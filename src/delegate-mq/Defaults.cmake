@@ -68,6 +68,11 @@ if(NOT DEFINED DMQ_ALLOCATOR)
     set(DMQ_ALLOCATOR "OFF")
 endif()
 
+# --- Slab Pool Defaults ---
+if(NOT DEFINED DMQ_SLAB_POOL)
+    set(DMQ_SLAB_POOL "OFF")
+endif()
+
 # --- Assert Defaults ---
 if(NOT DEFINED DMQ_ASSERTS)
     set(DMQ_ASSERTS "OFF")
@@ -123,6 +123,7 @@
 #if defined(DMQ_THREAD_STDLIB)
     #include "port/os/stdlib/Thread.h"
     #include "port/os/stdlib/ThreadMsg.h"
+    #include "port/os/stdlib/ThreadPool.h"
 #elif defined(DMQ_THREAD_WIN32)
     #include "port/os/win32/Thread.h"
     #include "port/os/win32/ThreadMsg.h"
@@ -184,6 +185,12 @@
     #include "extras/dispatcher/Dispatcher.h"
     #include "port/transport/linux-udp/LinuxUdpTransport.h"
     #include "port/transport/linux-udp/MulticastTransport.h"
+#elif defined(DMQ_TRANSPORT_LINUX_URING)
+    #include "extras/dispatcher/Dispatcher.h"
+    #include "port/transport/linux-uring/LinuxUringTransport.h"
+#elif defined(DMQ_TRANSPORT_SHM)
+    #include "extras/dispatcher/Dispatcher.h"
+    #include "port/transport/shm/ShmTransport.h"
 #elif defined(DMQ_TRANSPORT_LINUX_TCP)
     #include "extras/dispatcher/Dispatcher.h"
     #include "port/transport/linux-tcp/LinuxTcpTransport.h"
@@ -224,7 +231,8 @@
 #if defined(DMQ_TRANSPORT_ZEROMQ) || defined(DMQ_TRANSPORT_NNG) || \
     defined(DMQ_TRANSPORT_WIN32_PIPE) || defined(DMQ_TRANSPORT_WIN32_UDP) || \
     defined(DMQ_TRANSPORT_WIN32_TCP) || defined(DMQ_TRANSPORT_LINUX_UDP) || \
-    defined(DMQ_TRANSPORT_LINUX_TCP) || defined(DMQ_TRANSPORT_MQTT) || \
+    defined(DMQ_TRANSPORT_LINUX_TCP) || defined(DMQ_TRANSPORT_LINUX_URING) || \
+    defined(DMQ_TRANSPORT_SHM) || defined(DMQ_TRANSPORT_MQTT) || \
     defined(DMQ_TRANSPORT_SERIAL_PORT) || defined(DMQ_TRANSPORT_ARM_LWIP_UDP) || \
     defined(DMQ_TRANSPORT_ARM_LWIP_NETCONN_UDP) || defined(DMQ_TRANSPORT_THREADX_UDP) || \
     defined(DMQ_TRANSPORT_STM32_UART) || defined(DMQ_TRANSPORT_ZEPHYR_UDP) || \
@@ -242,6 +250,7 @@
     #include "extras/util/AsyncInvoke.h"
     #include "extras/util/TransportMonitor.h"
     #include "extras/util/ThreadMonitor.h"
+    #include "extras/util/AllocatorMonitor.h"
 #endif
 
 // Only include NetworkEngine if a transport that uses it is active
@@ -92,6 +92,12 @@ elseif (DMQ_TRANSPORT STREQUAL "DMQ_TRANSPORT_WIN32_TCP")
 elseif (DMQ_TRANSPORT STREQUAL "DMQ_TRANSPORT_LINUX_UDP")
     add_compile_definitions(DMQ_TRANSPORT_LINUX_UDP)
     file(GLOB TRANSPORT_SOURCES "${DMQ_ROOT_DIR}/port/transport/linux-udp/*.h")
+elseif (DMQ_TRANSPORT STREQUAL "DMQ_TRANSPORT_LINUX_URING")
+    add_compile_definitions(DMQ_TRANSPORT_LINUX_URING)
+    file(GLOB TRANSPORT_SOURCES "${DMQ_ROOT_DIR}/port/transport/linux-uring/*.h")
+elseif (DMQ_TRANSPORT STREQUAL "DMQ_TRANSPORT_SHM")
+    add_compile_definitions(DMQ_TRANSPORT_SHM)
+    file(GLOB TRANSPORT_SOURCES "${DMQ_ROOT_DIR}/port/transport/shm/*.h")
 elseif (DMQ_TRANSPORT STREQUAL "DMQ_TRANSPORT_LINUX_TCP")
     add_compile_definitions(DMQ_TRANSPORT_LINUX_TCP)
     file(GLOB TRANSPORT_SOURCES "${DMQ_ROOT_DIR}/port/transport/linux-tcp/*.h")
@@ -151,6 +157,10 @@ file(GLOB FAULT_SOURCES
     "${DMQ_ROOT_DIR}/port/fault/Fault.cpp"
 )
 
+if (DMQ_SLAB_POOL STREQUAL "ON")
+    add_compile_definitions(DMQ_SLAB_POOL)
+endif()
+
 if (DMQ_ASSERTS STREQUAL "ON")
     add_compile_definitions(DMQ_ASSERTS)
 endif()
@@ -0,0 +1,472 @@
+#ifndef _BYTE_BUFFER_H
+#define _BYTE_BUFFER_H
+
+/// @file
+/// @brief Growable, reusable contiguous byte buffer for remote argument data.
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @details `ByteBuffer` holds serialized remote function arguments in one contiguous
+/// block. Unlike `xostringstream`, clearing the buffer keeps its capacity, the bytes are
+/// viewed in place with `Data()`/`Size()` (no `str()` copy), and writes are plain
+/// `memcpy` calls. Once a buffer reaches its working size, reuse performs no heap
+/// allocations.
+///
+/// `ByteBufferOStream` and `ByteBufferIStream` adapt a buffer to the `std::ostream` /
+/// `std::istream` API for serializers that only support streams. The adapters write and
+/// read the buffer storage directly.
+///
+/// `ByteSpan` is the read-only counterpart for received bytes owned by someone else,
+/// typically a transport receive buffer (see `ITransport::ReceiveView()`).
+
+#include "DelegateOpt.h"
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+namespace dmq {
+
+/// @brief A growable contiguous byte buffer with independent read position.
+/// @details Not thread safe. Typically owned by a remote channel and reused for
+/// every message.
+class ByteBuffer
+{
+public:
+#ifdef DMQ_ALLOCATOR
+    using Storage = std::vector<uint8_t, stl_allocator<uint8_t>>;
+#else
+    using Storage = std::vector<uint8_t>;
+#endif
+
+    ByteBuffer() = default;
+
+    /// Construct with an initial capacity.
+    /// @param[in] capacity Bytes to reserve.
+    explicit ByteBuffer(size_t capacity) { Reserve(capacity); }
+
+    /// @return Pointer to the first byte.
+    uint8_t* Data() noexcept { return m_storage.data(); }
+    const uint8_t* Data() const noexcept { return m_storage.data(); }
+
+    /// @return Number of bytes written.
+    size_t Size() const noexcept { return m_size; }
+
+    /// @return `true` if no bytes are written.
+    bool Empty() const noexcept { return m_size == 0; }
+
+    /// @return Number of bytes available without reallocation.
+    size_t Capacity() const noexcept { return m_storage.size(); }
+
+    /// Discard the contents and reset the read position and error state.
+    /// Capacity is retained.
+    void Clear() noexcept
+    {
+        m_size = 0;
+        m_readPos = 0;
+        m_fail = false;
+    }
+
+    /// Ensure capacity for at least `capacity` bytes.
+    void Reserve(size_t capacity)
+    {
+        if (capacity > m_storage.size())
+            m_storage.resize(capacity);
+    }
+
+    /// Set the number of written bytes, growing the storage if required. Used
+    /// after filling `Data()` externally (e.g. by a socket receive).
+    void Resize(size_t size)
+    {
+        Reserve(size);
+        m_size = size;
+        if (m_readPos > m_size)
+            m_readPos = m_size;
+    }
+
+    /// Append bytes to the end of the buffer.
+    void Write(const void* data, size_t size)
+    {
+        if (size == 0)
+            return;
+        uint8_t* dest = Append(size);
+        std::memcpy(dest, data, size);
+    }
+
+    /// Extend the buffer by `size` bytes.
+    /// @return Pointer to the first new byte. Valid until the next write.
+    uint8_t* Append(size_t size)
+    {
+        Grow(m_size + size);
+        uint8_t* dest = m_storage.data() + m_size;
+        m_size += size;
+        return dest;
+    }
+
+    /// Replace the contents with a copy of `data`.
+    void Assign(const void* data, size_t size)
+    {
+        Clear();
+        Write(data, size);
+    }
+
+    /// Copy bytes from the read position and advance it. Sets the error
+    /// state if fewer than `size` bytes remain.
+    /// @return Number of bytes copied.
+    size_t Read(void* dest, size_t size)
+    {
+        size_t n = size <= Remaining() ? size : Remaining();
+        if (n > 0)
+            std::memcpy(dest, m_storage.data() + m_readPos, n);
+        m_readPos += n;
+        if (n < size)
+            m_fail = true;
+        return n;
+    }
+
+    /// @return Pointer to the byte at the read position.
+    const uint8_t* ReadData() const noexcept { return m_storage.data() + m_readPos; }
+
+    /// @return Number of unread bytes.
+    size_t Remaining() const noexcept { return m_size - m_readPos; }
+
+    size_t GetReadPos() const noexcept { return m_readPos; }
+    void SetReadPos(size_t pos) noexcept { m_readPos = pos <= m_size ? pos : m_size; }
+
+    /// @return `false` if a read or write on the buffer failed.
+    bool Good() const noexcept { return !m_fail; }
+
+    /// Flag the buffer contents as invalid.
+    void SetFail() noexcept { m_fail = true; }
+
+    /// Direct access to the underlying storage for serializer adapters that
+    /// write into a standard container. The storage size is the capacity;
+    /// call `Resize()` afterwards to set the written size.
+    Storage& GetStorage() noexcept { return m_storage; }
+
+private:
+    friend class ByteBufferStreamBuf;
+
+    void Grow(size_t required)
+    {
+        if (required <= m_storage.size())
+            return;
+        size_t capacity = m_storage.size() < 64 ? 64 : m_storage.size() * 2;
+        while (capacity < required)
+            capacity *= 2;
+        m_storage.resize(capacity);
+    }
+
+    Storage m_storage;
+    size_t m_size = 0;
+    size_t m_readPos = 0;
+    bool m_fail = false;
+};
+
+/// @brief `std::streambuf` over a `ByteBuffer`. The put and get areas map directly
+/// onto the buffer storage, so stream writes and reads are in-place copies.
+/// @details Output starts at the end of the written data. Seeking the output position
+/// backwards overwrites existing bytes without truncating (as `std::stringbuf`), which
+/// serializers use to backfill length fields. Input starts at the buffer read position.
+/// The buffer size and read position are updated on `pubsync()` and destruction.
+class ByteBufferStreamBuf : public std::streambuf
+{
+public:
+    ByteBufferStreamBuf(ByteBuffer& buffer, std::ios_base::openmode mode)
+        : m_buffer(buffer), m_mode(mode), m_high(buffer.m_size)
+    {
+        if (m_mode & std::ios_base::out)
+            SetPut(m_buffer.m_size);
+        if (m_mode & std::ios_base::in)
+        {
+            char* base = Base();
+            setg(base, base + m_buffer.m_readPos, base + m_buffer.m_size);
+        }
+    }
+
+    ~ByteBufferStreamBuf() override { sync(); }
+
+    ByteBufferStreamBuf(const ByteBufferStreamBuf&) = delete;
+    ByteBufferStreamBuf& operator=(const ByteBufferStreamBuf&) = delete;
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (!(m_mode & std::ios_base::out))
+            return traits_type::eof();
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+            return traits_type::not_eof(ch);
+
+        size_t pos = PutPos();
+        UpdateHigh();
+        m_buffer.Grow(pos + 1);
+        SetPut(pos);
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+        return ch;
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        if (!(m_mode & std::ios_base::out) || n <= 0)
+            return 0;
+
+        size_t pos = PutPos();
+        if (static_cast<size_t>(epptr() - pptr()) < static_cast<size_t>(n))
+        {
+            UpdateHigh();
+            m_buffer.Grow(pos + static_cast<size_t>(n));
+            SetPut(pos);
+        }
+        std::memcpy(pptr(), s, static_cast<size_t>(n));
+        SetPut(pos + static_cast<size_t>(n));
+        return n;
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+        std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override
+    {
+        UpdateHigh();
+        const bool in = (which & std::ios_base::in) && (m_mode & std::ios_base::in);
+        const bool out = (which & std::ios_base::out) && (m_mode & std::ios_base::out);
+        if (!in && !out)
+            return pos_type(off_type(-1));
+
+        off_type cur = out ? off_type(PutPos()) : off_type(gptr() - eback());
+        off_type base = dir == std::ios_base::beg ? 0 :
+                        dir == std::ios_base::cur ? cur : off_type(Size());
+        off_type pos = base + off;
+        if (pos < 0 || pos > off_type(Size()))
+            return pos_type(off_type(-1));
+
+        if (in)
+            setg(eback(), eback() + pos, egptr());
+        if (out)
+            SetPut(static_cast<size_t>(pos));
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    int sync() override
+    {
+        if (m_mode & std::ios_base::out)
+        {
+            UpdateHigh();
+            m_buffer.m_size = m_high;
+        }
+        if (m_mode & std::ios_base::in)
+            m_buffer.m_readPos = static_cast<size_t>(gptr() - eback());
+        return 0;
+    }
+
+private:
+    char* Base() { return reinterpret_cast<char*>(m_buffer.m_storage.data()); }
+    size_t PutPos() const { return static_cast<size_t>(pptr() - pbase()); }
+    size_t Size() const { return m_mode & std::ios_base::out ? m_high : m_buffer.m_size; }
+
+    void UpdateHigh()
+    {
+        if ((m_mode & std::ios_base::out) && PutPos() > m_high)
+            m_high = PutPos();
+    }
+
+    /// Map the put area onto the full storage and position it at `pos`.
+    void SetPut(size_t pos)
+    {
+        char* base = Base();
+        setp(base, base + m_buffer.m_storage.size());
+        while (pos > static_cast<size_t>(INT32_MAX))
+        {
+            pbump(INT32_MAX);
+            pos -= INT32_MAX;
+        }
+        pbump(static_cast<int>(pos));
+    }
+
+    ByteBuffer& m_buffer;
+    const std::ios_base::openmode m_mode;
+    size_t m_high;
+};
+
+/// @brief `std::ostream` that appends to a `ByteBuffer`.
+/// @details The buffer size is updated when the stream is destroyed or flushed.
+/// A stream error marks the buffer as failed.
+class ByteBufferOStream : public std::ostream
+{
+public:
+    explicit ByteBufferOStream(ByteBuffer& buffer)
+        : std::ostream(nullptr), m_buffer(buffer), m_streamBuf(buffer, std::ios_base::out)
+    {
+        rdbuf(&m_streamBuf);
+    }
+
+    ~ByteBufferOStream() override
+    {
+        m_streamBuf.pubsync();
+        if (fail())
+            m_buffer.SetFail();
+    }
+
+private:
+    ByteBuffer& m_buffer;
+    ByteBufferStreamBuf m_streamBuf;
+};
+
+/// @brief `std::istream` that reads a `ByteBuffer` from its read position.
+/// @details The buffer read position is updated when the stream is destroyed. A stream
+/// error marks the buffer as failed.
+class ByteBufferIStream : public std::istream
+{
+public:
+    explicit ByteBufferIStream(ByteBuffer& buffer)
+        : std::istream(nullptr), m_buffer(buffer), m_streamBuf(buffer, std::ios_base::in)
+    {
+        rdbuf(&m_streamBuf);
+    }
+
+    ~ByteBufferIStream() override
+    {
+        m_streamBuf.pubsync();
+        if (bad() || fail())
+            m_buffer.SetFail();
+    }
+
+private:
+    ByteBuffer& m_buffer;
+    ByteBufferStreamBuf m_streamBuf;
+};
+
+/// @brief A read-only view of bytes owned elsewhere, with a read position.
+/// @details Used to deserialize received argument data where it lies, e.g. in a
+/// transport receive buffer. The viewed bytes must outlive the span.
+class ByteSpan
+{
+public:
+    ByteSpan() = default;
+    ByteSpan(const void* data, size_t size) noexcept
+        : m_data(static_cast<const uint8_t*>(data)), m_size(size) {}
+
+    /// @return Pointer to the first byte.
+    const uint8_t* Data() const noexcept { return m_data; }
+
+    /// @return Number of bytes viewed.
+    size_t Size() const noexcept { return m_size; }
+
+    bool Empty() const noexcept { return m_size == 0; }
+
+    /// Copy bytes from the read position and advance it. Sets the error
+    /// state if fewer than `size` bytes remain.
+    /// @return Number of bytes copied.
+    size_t Read(void* dest, size_t size)
+    {
+        size_t n = size <= Remaining() ? size : Remaining();
+        if (n > 0)
+            std::memcpy(dest, m_data + m_readPos, n);
+        m_readPos += n;
+        if (n < size)
+            m_fail = true;
+        return n;
+    }
+
+    /// @return Pointer to the byte at the read position.
+    const uint8_t* ReadData() const noexcept { return m_data + m_readPos; }
+
+    /// @return Number of unread bytes.
+    size_t Remaining() const noexcept { return m_size - m_readPos; }
+
+    size_t GetReadPos() const noexcept { return m_readPos; }
+    void SetReadPos(size_t pos) noexcept { m_readPos = pos <= m_size ? pos : m_size; }
+
+    /// @return `false` if a read on the span failed.
+    bool Good() const noexcept { return !m_fail; }
+
+    /// Flag the span contents as invalid.
+    void SetFail() noexcept { m_fail = true; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_readPos = 0;
+    bool m_fail = false;
+};
+
+/// @brief Read-only `std::streambuf` over a `ByteSpan`. The get area maps directly
+/// onto the viewed bytes; the span read position is updated on `pubsync()`.
+class ByteSpanStreamBuf : public std::streambuf
+{
+public:
+    explicit ByteSpanStreamBuf(ByteSpan& span) : m_span(span)
+    {
+        // The get area is never written through
+        char* base = const_cast<char*>(reinterpret_cast<const char*>(span.Data()));
+        setg(base, base + span.GetReadPos(), base + span.Size());
+    }
+
+    ~ByteSpanStreamBuf() override { sync(); }
+
+    ByteSpanStreamBuf(const ByteSpanStreamBuf&) = delete;
+    ByteSpanStreamBuf& operator=(const ByteSpanStreamBuf&) = delete;
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+        std::ios_base::openmode which = std::ios_base::in) override
+    {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        off_type base = dir == std::ios_base::beg ? 0 :
+                        dir == std::ios_base::cur ? off_type(gptr() - eback()) : off_type(egptr() - eback());
+        off_type pos = base + off;
+        if (pos < 0 || pos > egptr() - eback())
+            return pos_type(off_type(-1));
+        setg(eback(), eback() + pos, egptr());
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    int sync() override
+    {
+        m_span.SetReadPos(static_cast<size_t>(gptr() - eback()));
+        return 0;
+    }
+
+private:
+    ByteSpan& m_span;
+};
+
+/// @brief `std::istream` that reads a `ByteSpan` from its read position without
+/// copying it. The span read position is updated when the stream is destroyed. A
+/// stream error marks the span as failed.
+class ByteSpanIStream : public std::istream
+{
+public:
+    explicit ByteSpanIStream(ByteSpan& span)
+        : std::istream(nullptr), m_span(span), m_streamBuf(span)
+    {
+        rdbuf(&m_streamBuf);
+    }
+
+    ~ByteSpanIStream() override
+    {
+        m_streamBuf.pubsync();
+        if (bad() || fail())
+            m_span.SetFail();
+    }
+
+private:
+    ByteSpan& m_span;
+    ByteSpanStreamBuf m_streamBuf;
+};
+
+} // namespace dmq
+
+#endif
@@ -124,6 +124,12 @@ public:
     /// @post The caller is responsible for deleting the clone instance. 
     virtual DelegateBase* Clone() const = 0;
 
+    /// @brief Get the identity of the bound target object, if any.
+    /// @details Async delegates copy this key into each `DelegateMsg` as the strand key, so 
+    /// an `IThread` that runs messages concurrently can serialize calls on the same object.
+    /// @return The target object address, or `nullptr` if the target has no object.
+    virtual const void* GetTargetKey() const noexcept { return nullptr; }
+
     // Optional fixed block allocator for delegates created on the heap 
     // using operator new(). See DMQ_ALLOCATOR in DelegateOpt.h and 
     // ENABLE_ALLOCATOR in CMakeLists.txt.
@@ -517,6 +523,9 @@ public:
     /// @post The delegate is empty.
     void Clear() noexcept { m_object = nullptr; m_func = nullptr; }
 
+    /// @brief Get the bound target object address.
+    virtual const void* GetTargetKey() const noexcept override { return m_object.get(); }
+
     /// @brief Implicit conversion operator to `bool`.
     /// @return `true` if the object is not empty, `false` if the object is empty.
     explicit operator bool() const noexcept { return !Empty(); }
@@ -668,6 +677,9 @@ public:
     /// @brief Clear the target function.
     void Clear() noexcept { m_object.reset(); m_func = nullptr; }
 
+    /// @brief Get the bound target object address, or nullptr if expired.
+    virtual const void* GetTargetKey() const noexcept override { return m_object.lock().get(); }
+
     explicit operator bool() const noexcept { return !Empty(); }
 
 private:
@@ -15,8 +15,10 @@
 /// A `IThread` implementation is required to serialize and dispatch an async delegate onto
 /// a destination thread of control. 
 /// 
-/// Argument data is created on the heap using `operator new` for transport thought a thread 
-/// message queue. An optional fixed-block allocator is available. See `DMQ_ALLOCATOR`. 
+/// The delegate clone and argument data are copied into a single heap allocated message for 
+/// transport through a thread message queue. An optional fixed-block allocator is available.
+/// See `DMQ_ALLOCATOR`. Alternatively, `DMQ_SLAB_POOL` recycles messages from a per-type
+/// slab. See `SlabPool.h`.
 /// 
 /// `RetType operator()(Args... args)` - called by the source thread to initiate the async
 /// function call. May throw `std::bad_alloc` if dynamic storage allocation fails and `DMQ_ASSERTS` 
@@ -51,12 +53,14 @@
 #include "Delegate.h"
 #include "IThread.h"
 #include "IInvoker.h"
+#include "SlabPool.h"
 #include <tuple>
+#include <utility>
 
 namespace dmq {
 
 /// @brief Stores all function arguments suitable for non-blocking asynchronous calls.
-/// Argument data is stored in the heap.
+/// Argument data is copied inline within the message. See `async_arg`.
 /// @tparam Args The argument types of the bound delegate function.
 template <class...Args>
 class DelegateAsyncMsg : public DelegateMsg
@@ -66,9 +70,8 @@ public:
     /// @param[in] invoker - the invoker instance
     /// @param[in] priority - the delegate message priority
     /// @param[in] args - a parameter pack of all target function arguments
-    /// @throws std::bad_alloc If make_tuble_heap() fails to obtain memory and DMQ_ASSERTS not defined.
-    DelegateAsyncMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) : DelegateMsg(invoker, priority),
-        m_args(make_tuple_heap(m_heapMem, m_start, std::forward<Args>(args)...)) {
+    DelegateAsyncMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) :
+        DelegateAsyncMsg(std::move(invoker), priority, std::index_sequence_for<Args...>(), std::forward<Args>(args)...) {
     }
 
     /// Delete the default constructor
@@ -86,21 +89,55 @@ public:
 
     virtual ~DelegateAsyncMsg() = default;
 
-    /// Get all function arguments that were created on the heap
+    /// Get all function arguments copied into the message
     /// @return A tuple of all function arguments
     std::tuple<Args...>& GetArgs() { return m_args; }
 
+protected:
+    /// Constructor used by a derived message that embeds the invoker.
+    /// @param[in] priority - the delegate message priority
+    /// @param[in] args - a parameter pack of all target function arguments
+    DelegateAsyncMsg(Priority priority, Args... args) :
+        DelegateAsyncMsg(nullptr, priority, std::index_sequence_for<Args...>(), std::forward<Args>(args)...) {
+    }
+
 private:
-    /// A list of heap allocated argument memory blocks
-    xlist<std::shared_ptr<heap_arg_deleter_base>> m_heapMem;
+    template <std::size_t... I>
+    DelegateAsyncMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, std::index_sequence<I...>, Args... args) :
+        DelegateMsg(std::move(invoker), priority),
+        m_storage(args...),
+        m_args(std::get<I>(m_storage).Bind(args)...) {
+    }
 
-    /// An empty starting tuple
-    std::tuple<> m_start;
+    /// Inline copies of reference and pointer arguments
+    std::tuple<async_arg<Args>...> m_storage;
 
-    /// A tuple with each element stored within the heap
+    /// A tuple of function arguments. Reference and pointer elements refer to m_storage.
     std::tuple<Args...> m_args;
 };
 
+/// @brief An async message that also stores the delegate invoker, so the invoker, 
+/// priority and arguments share one allocation.
+/// @tparam TInvoker The async delegate type invoked on the destination thread.
+/// @tparam Args The argument types of the bound delegate function.
+template <class TInvoker, class...Args>
+class DelegateAsyncInvokerMsg : public DelegateAsyncMsg<Args...>
+{
+public:
+    /// Constructor
+    /// @param[in] invoker - the delegate copied into the message
+    /// @param[in] priority - the delegate message priority
+    /// @param[in] args - a parameter pack of all target function arguments
+    DelegateAsyncInvokerMsg(const TInvoker& invoker, Priority priority, Args... args) :
+        DelegateAsyncMsg<Args...>(priority, std::forward<Args>(args)...), m_invoker(invoker) {
+        this->SetEmbeddedInvoker(&m_invoker);
+    }
+
+private:
+    /// The delegate instance invoked on the destination thread
+    TInvoker m_invoker;
+};
+
 template <class R>
 class DelegateFreeAsync; // Not defined
 
@@ -247,9 +284,9 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
-    /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// The `DelegateAsyncInvokerMsg` copies the delegate and function arguments into a single 
+    /// message allocation. The source thread is not required to place function arguments into the 
+    /// heap. The delegate library performs all necessary argument copying for the caller. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -266,15 +303,12 @@ public:
             return BaseType::operator()(std::forward<Args>(args)...);
         }
         else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread
-            auto msg = xmake_shared<DelegateAsyncMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
+            // Create a new message holding a clone of this delegate and the arguments
+            // within a single allocation for sending to the destination thread
+            auto msg = make_slab_shared<DelegateAsyncInvokerMsg<ClassType, Args...>>(*this, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
+            msg->SetStrandKey(BaseType::GetTargetKey());
 
             auto thread = this->GetThread();
             if (thread) {
@@ -561,9 +595,9 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
-    /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// The `DelegateAsyncInvokerMsg` copies the delegate and function arguments into a single 
+    /// message allocation. The source thread is not required to place function arguments into the 
+    /// heap. The delegate library performs all necessary argument copying for the caller. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -580,15 +614,12 @@ public:
             return BaseType::operator()(std::forward<Args>(args)...);
         }
         else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread
-            auto msg = xmake_shared<DelegateAsyncMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
+            // Create a new message holding a clone of this delegate and the arguments
+            // within a single allocation for sending to the destination thread
+            auto msg = make_slab_shared<DelegateAsyncInvokerMsg<ClassType, Args...>>(*this, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
+            msg->SetStrandKey(BaseType::GetTargetKey());
 
             auto thread = this->GetThread();
             if (thread) {
@@ -804,9 +835,9 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
-    /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// The `DelegateAsyncInvokerMsg` copies the delegate and function arguments into a single 
+    /// message allocation. The source thread is not required to place function arguments into the 
+    /// heap. The delegate library performs all necessary argument copying for the caller. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -823,15 +854,12 @@ public:
             return BaseType::operator()(std::forward<Args>(args)...);
         }
         else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread
-            auto msg = xmake_shared<DelegateAsyncMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
+            // Create a new message holding a clone of this delegate and the arguments
+            // within a single allocation for sending to the destination thread
+            auto msg = make_slab_shared<DelegateAsyncInvokerMsg<ClassType, Args...>>(*this, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
+            msg->SetStrandKey(BaseType::GetTargetKey());
 
             auto thread = this->GetThread();
             if (thread) {
@@ -1059,9 +1087,9 @@ public:
     /// destination thread message queue. `Invoke()` must be called by the destination 
     /// thread to invoke the target function. Always safe to call.
     /// 
-    /// The `DelegateAsyncMsg` duplicates and copies the function arguments into heap memory. 
-    /// The source thread is not required to place function arguments into the heap. The delegate
-    /// library performs all necessary heap and argument coping for the caller. Ensure complex
+    /// The `DelegateAsyncInvokerMsg` copies the delegate and function arguments into a single 
+    /// message allocation. The source thread is not required to place function arguments into the 
+    /// heap. The delegate library performs all necessary argument copying for the caller. Ensure complex
     /// argument data types can be safely copied by creating a copy constructor if necessary. 
     /// @param[in] args The function arguments, if any.
     /// @return A default return value. The return value is *not* returned from the 
@@ -1078,15 +1106,12 @@ public:
             return BaseType::operator()(std::forward<Args>(args)...);
         }
         else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread
-            auto msg = xmake_shared<DelegateAsyncMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
+            // Create a new message holding a clone of this delegate and the arguments
+            // within a single allocation for sending to the destination thread
+            auto msg = make_slab_shared<DelegateAsyncInvokerMsg<ClassType, Args...>>(*this, m_priority, std::forward<Args>(args)...);
             if (!msg)
                 BAD_ALLOC();
+            msg->SetStrandKey(BaseType::GetTargetKey());
 
             auto thread = this->GetThread();
             if (thread) {
@@ -20,11 +20,13 @@
 /// a destination thread of control. 
 /// 
 /// Delegate "`AsyncWait`" series of classes used to invoke a function asynchronously and wait for 
-/// completion by the destination target thread. Invoking a function asynchronously requires making 
-/// a clone of the object to be sent to the destination thread message queue. The destination thread 
+/// completion by the destination target thread. The source thread sends a `DelegateAsyncWaitMsg` 
+/// referring to the delegate itself to the destination thread message queue; no clone is made 
+/// because the delegate cannot be destroyed while its caller is blocked. The destination thread 
 /// calls `Invoke()` to invoke the target function. The source thread blocks on a semaphore 
 /// waiting for the destination thread to complete the function invoke. If the caller timeout expires, 
-/// the target function is not invoked. 
+/// the target function is not invoked. Each source thread reuses its message, semaphore and return 
+/// value slot between calls, so a successful call does not allocate. 
 /// 
 /// The `m_lock` mutex is used to protect shared state data between the source and destination 
 /// threads using the two thread-safe functions below:
@@ -61,8 +63,9 @@
 #include "Semaphore.h"
 #include "IThread.h"
 #include "IInvoker.h"
+#include "SlabPool.h"
 #include <optional>
-#include <any>
+#include <type_traits>
 #include <chrono>
 
 namespace dmq {
@@ -72,22 +75,26 @@ namespace dmq {
 // on systems with nanosecond clock resolution (Linux/Windows).
 constexpr auto WAIT_INFINITE = std::chrono::hours(1000);
 
-/// @brief Stores all function arguments suitable for blocking asynchronous calls.
+/// @brief Stores all function arguments and the return value for a blocking asynchronous call. 
 /// Argument data is not stored in the heap.
+/// @details The message is its own invoker. It refers to the source delegate without cloning 
+/// it, and only calls the target while the source thread is blocked waiting, so the delegate 
+/// is guaranteed alive. After a timeout the message no longer touches the delegate. Each source 
+/// thread reuses one message per delegate type between calls. See `WaitMsgCache`.
+/// @tparam TInvoker The async wait delegate type that sent the message.
+/// @tparam RetType The return type of the bound delegate function.
 /// @tparam Args The target function arguments.
-template <class...Args>
-class DelegateAsyncWaitMsg : public DelegateMsg
+template <class TInvoker, class RetType, class...Args>
+class DelegateAsyncWaitMsg : public DelegateMsg, public IThreadInvoker
 {
 public:
-    /// Constructor
-    /// @param[in] invoker - the invoker instance
-    /// @param[in] priority - the delegate message priority
-    /// @param[in] args - a parameter pack of all target function arguments
-    DelegateAsyncWaitMsg(std::shared_ptr<IThreadInvoker> invoker, Priority priority, Args... args) : DelegateMsg(invoker, priority),
-        m_args(std::forward<Args>(args)...) {}
+    /// Return value storage type. A `void` function stores nothing.
+    using RetStorage = std::conditional_t<std::is_void_v<RetType>, bool, std::remove_cv_t<RetType>>;
 
-    /// Delete the default constructor
-    DelegateAsyncWaitMsg() = delete;
+    /// Constructor
+    DelegateAsyncWaitMsg() : DelegateMsg(nullptr, Priority::NORMAL) {
+        this->SetEmbeddedInvoker(this);
+    }
 
     /// Delete the copy constructor
     DelegateAsyncWaitMsg(const DelegateAsyncWaitMsg&) = delete;
@@ -101,36 +108,82 @@ public:
 
     virtual ~DelegateAsyncWaitMsg() = default;
 
-    /// Get all function arguments 
-    /// @return A tuple of all function arguments
-    std::tuple<Args...>& GetArgs() { return m_args; }
+    /// Prepare the message for the next dispatch. Called by the source thread before 
+    /// dispatching the message.
+    /// @param[in] delegate - the source delegate to invoke on the destination thread
+    /// @param[in] priority - the delegate message priority
+    /// @param[in] args - a parameter pack of all target function arguments
+    void Prepare(TInvoker* delegate, Priority priority, Args... args) {
+        const dmq::LockGuard<Mutex> lock(m_lock);
+        m_delegate = delegate;
+        this->SetPriority(priority);
+        m_args.emplace(std::forward<Args>(args)...);
+        m_retVal.reset();
+        m_invokerWaiting = true;
+    }
+
+    /// Stop waiting for the destination thread and release the arguments. Called by the 
+    /// source thread once the wait completes or times out.
+    /// @return The target function return value, if the target was invoked.
+    std::optional<RetStorage> Complete() {
+        const dmq::LockGuard<Mutex> lock(m_lock);
+        m_invokerWaiting = false;
+        m_delegate = nullptr;
+        m_args.reset();
+        std::optional<RetStorage> retVal = std::move(m_retVal);
+        m_retVal.reset();
+        return retVal;
+    }
+
+    /// Invoke the target function on the destination thread if the source thread is 
+    /// still waiting, then signal the source thread.
+    /// @param[in] msg The delegate message (this instance).
+    /// @return `true` if target function invoked or timeout expired.
+    virtual bool Invoke(std::shared_ptr<DelegateMsg> msg) override {
+        (void)msg;
+
+        // Protect data shared between source and destination threads
+        const dmq::LockGuard<Mutex> lock(m_lock);
+
+        // Is the source thread waiting for the target function invoke to complete?
+        if (m_invokerWaiting) {
+            if constexpr (std::is_void<RetType>::value == true)
+                Call(std::index_sequence_for<Args...>());
+            else
+                m_retVal.emplace(Call(std::index_sequence_for<Args...>()));
+
+            // Signal the source thread that the destination thread function call is complete
+            m_sema.Signal();
+        }
+        return true;
+    }
 
     /// Get the semaphore used to signal the sending thread that the receiving 
     /// thread has invoked the target function. 
     /// @return The semaphore reference.
     Semaphore& GetSema() { return m_sema; }
 
-    /// Get a mutex shared between sender and receiver threads.
-    /// @return The lock reference.
-    Mutex& GetLock() { return m_lock; }
-
     /// True if the sending thread is waiting for the receiver thread to call the function.
-    /// False if the sending thread delegate timeout occurred and is not waiting.
-    /// @return `true` if the sending thread is waiting for the receiving thread to complete
-    /// the target function invoke.
-    bool GetInvokerWaiting() { return m_invokerWaiting; }
-
-    /// Set to true when source thread is waiting for destination thread to complete the 
-    /// function call.
-    /// @param[in] invokerWaiting The status of the invoker waiting flag.
-    void SetInvokerWaiting(bool invokerWaiting) { m_invokerWaiting = invokerWaiting; }
+    /// Only the source thread writes the flag, so the source thread may read it unlocked.
+    /// @return `true` if a call using this message is in progress.
+    bool GetInvokerWaiting() const { return m_invokerWaiting; }
 
 private:
-    /// An empty starting tuple
-    std::tuple<> m_start;
+    /// Call the bound target function directly, bypassing the async delegate dispatch.
+    /// Value arguments are moved into the call; reference arguments are passed through.
+    template <std::size_t... I>
+    RetType Call(std::index_sequence<I...>) {
+        return m_delegate->TInvoker::BaseType::operator()(std::forward<Args>(std::get<I>(*m_args))...);
+    }
+
+    /// The source delegate. Only valid while `m_invokerWaiting` is `true`.
+    TInvoker* m_delegate = nullptr;
 
     /// A tuple with each function argument element 
-    std::tuple<Args...> m_args;
+    std::optional<std::tuple<Args...>> m_args;
+
+    /// Return value of the target invoked function
+    std::optional<RetStorage> m_retVal;
 
     /// Semaphore to signal waiting thread
     Semaphore m_sema;
@@ -142,6 +195,47 @@ private:
     bool m_invokerWaiting = false;
 };
 
+/// @brief Per-thread cache of one `DelegateAsyncWaitMsg` for each message type.
+/// @details Once a blocking call succeeds the destination thread no longer touches the 
+/// message, apart from releasing its `std::shared_ptr`, so the source thread reuses the same 
+/// message, semaphore and lock for its next call. A message is discarded after a failed call, 
+/// since the destination thread may still invoke it or signal it late. A nested call on the 
+/// same thread while the cached message is in use gets a new message. Without thread local 
+/// storage every call allocates a new message.
+/// @tparam TMsg The wait message type.
+template <class TMsg>
+class WaitMsgCache
+{
+public:
+    /// Get a message not in use by a call on this thread.
+    /// @return The message, or nullptr if allocation fails.
+    static std::shared_ptr<TMsg> Acquire() {
+#ifdef DMQ_HAS_THREAD_LOCAL
+        auto& msg = Slot();
+        if (!msg || msg->GetInvokerWaiting())
+            msg = make_slab_shared<TMsg>();
+        return msg;
+#else
+        return make_slab_shared<TMsg>();
+#endif
+    }
+
+    /// Drop the calling thread's cached message.
+    static void Discard() {
+#ifdef DMQ_HAS_THREAD_LOCAL
+        Slot().reset();
+#endif
+    }
+
+private:
+#ifdef DMQ_HAS_THREAD_LOCAL
+    static std::shared_ptr<TMsg>& Slot() {
+        static thread_local std::shared_ptr<TMsg> msg;
+        return msg;
+    }
+#endif
+};
+
 template <class R>
 class DelegateFreeAsyncWait; // Not defined
 
@@ -200,6 +294,9 @@ public:
 
     // <common_code>
 
+    /// The message type dispatched to the destination thread
+    using MsgType = DelegateAsyncWaitMsg<ClassType, RetType, Args...>;
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -322,53 +419,43 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
-            return BaseType::operator()(std::forward<Args>(args)...);
-        } else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread.
-            auto msg = xmake_shared<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
-            if (!msg)
-                BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
-
-            auto thread = this->GetThread();
-            if (thread) {
-                // Dispatch message onto the callback destination thread. Invoke()
-                // will be called by the destination thread. 
-                if (thread->DispatchDelegate(msg)) {
-                    // Wait for destination thread to execute the delegate function and get return value
-                    if (msg->GetSema().Wait(m_timeout)) {
-                        // Wait succeeded. Now acquire lock to safely read the value.
-                        const dmq::LockGuard<Mutex> lock(msg->GetLock());
-                        m_success = true;
-                        m_retVal = delegate->m_retVal;
-                    }
-                }
+        // Get this thread's reusable message. The message refers to this delegate 
+        // rather than a clone, since this thread is blocked until the invoke completes.
+        auto msg = WaitMsgCache<MsgType>::Acquire();
+        if (!msg)
+            BAD_ALLOC();
+        msg->Prepare(this, m_priority, std::forward<Args>(args)...);
+        msg->SetStrandKey(BaseType::GetTargetKey());
+
+        auto thread = this->GetThread();
+        if (thread) {
+            // Dispatch message onto the callback destination thread. Invoke()
+            // will be called by the destination thread. 
+            if (thread->DispatchDelegate(msg)) {
+                // Wait for destination thread to execute the delegate function
+                if (msg->GetSema().Wait(m_timeout))
+                    m_success = true;
             }
+        }
 
-            // Protect data shared between source and destination threads
-            const dmq::LockGuard<Mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
-            // Does the target function have a return value?
-            if constexpr (std::is_void<RetType>::value == false) {
-                // Is the return value valid? 
-                if (m_retVal.has_value()) {
-                    // Return the destination thread target function return value
-                    return GetRetVal();
-                } else {
-                    // Return a default return value
-                    return RetType();
-                }
+        // Set flag that source is not waiting anymore and get the return value
+        auto retVal = msg->Complete();
+        if (m_success)
+            m_retVal = std::move(retVal);
+
+        // The destination thread may still hold or late signal a failed message
+        if (!m_success)
+            WaitMsgCache<MsgType>::Discard();
+
+        // Does the target function have a return value?
+        if constexpr (std::is_void<RetType>::value == false) {
+            // Is the return value valid? 
+            if (m_retVal.has_value()) {
+                // Return the destination thread target function return value
+                return GetRetVal();
+            } else {
+                // Return a default return value
+                return RetType();
             }
         }
     }
@@ -404,32 +491,12 @@ public:
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        auto delegateMsg = std::dynamic_pointer_cast<MsgType>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const dmq::LockGuard<Mutex> lock(delegateMsg->GetLock());
-
-        // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
-            // Invoke the delegate function synchronously
-            m_sync = true;
-
-            // Does target function have a void return value?
-            if constexpr (std::is_void<RetType>::value == true) {
-                // Invoke the target function using the source thread supplied function arguments
-                std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            } else {
-                // Invoke the target function using the source thread supplied function arguments 
-                // and get the return value
-                m_retVal = std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            }
-
-            // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
-        }
-        return true;
+        // The message holds the source delegate and waiting state
+        return delegateMsg->Invoke(msg);
     }
 
     /// Returns `true` if asynchronous function successfully invoked on the target thread
@@ -440,27 +507,16 @@ public:
     /// Get the asynchronous function return value
     /// @return The destination thread target function return value
     RetType GetRetVal() noexcept {
-        // Use pointer cast if exceptions are disabled OR if user requested Asserts-only mode
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-        // Fast, non-throwing check suitable for Embedded/Real-time
-        auto* p = std::any_cast<RetType>(&m_retVal);
-        if (p) return *p;
+        if constexpr (std::is_void<RetType>::value == false) {
+            if (m_retVal.has_value())
+                return *m_retVal;
 
-        // Optional: If you want to trap this error in debug mode
 #if defined(DMQ_ASSERTS)
-        ASSERT();
+            // Trap reading an invalid return value in debug mode
+            ASSERT();
 #endif
-
-        return RetType();
-#else
-        // Standard C++ behavior with Exception Handling
-        try {
-            return std::any_cast<RetType>(m_retVal);
-        }
-        catch (const std::bad_any_cast&) {
             return RetType();
         }
-#endif
     }
 
     ///@brief Get the destination thread that the target function is invoked on.
@@ -476,9 +532,6 @@ private:
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// Set to `true` if async function call succeeds
     bool m_success = false;			        
 
@@ -486,7 +539,7 @@ private:
     Duration m_timeout = WAIT_INFINITE;    
 
     /// Return value of the target invoked function
-    std::any m_retVal;
+    std::optional<typename MsgType::RetStorage> m_retVal;
 
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
@@ -636,6 +689,9 @@ public:
 
     // <common_code>
 
+    /// The message type dispatched to the destination thread
+    using MsgType = DelegateAsyncWaitMsg<ClassType, RetType, Args...>;
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -758,53 +814,43 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
-            return BaseType::operator()(std::forward<Args>(args)...);
-        } else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread.
-            auto msg = xmake_shared<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
-            if (!msg)
-                BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
-
-            auto thread = this->GetThread();
-            if (thread) {
-                // Dispatch message onto the callback destination thread. Invoke()
-                // will be called by the destination thread. 
-                if (thread->DispatchDelegate(msg)) {
-                    // Wait for destination thread to execute the delegate function and get return value
-                    if (msg->GetSema().Wait(m_timeout)) {
-                        // Wait succeeded. Now acquire lock to safely read the value.
-                        const dmq::LockGuard<Mutex> lock(msg->GetLock());
-                        m_success = true;
-                        m_retVal = delegate->m_retVal;
-                    }
-                }
+        // Get this thread's reusable message. The message refers to this delegate 
+        // rather than a clone, since this thread is blocked until the invoke completes.
+        auto msg = WaitMsgCache<MsgType>::Acquire();
+        if (!msg)
+            BAD_ALLOC();
+        msg->Prepare(this, m_priority, std::forward<Args>(args)...);
+        msg->SetStrandKey(BaseType::GetTargetKey());
+
+        auto thread = this->GetThread();
+        if (thread) {
+            // Dispatch message onto the callback destination thread. Invoke()
+            // will be called by the destination thread. 
+            if (thread->DispatchDelegate(msg)) {
+                // Wait for destination thread to execute the delegate function
+                if (msg->GetSema().Wait(m_timeout))
+                    m_success = true;
             }
+        }
 
-            // Protect data shared between source and destination threads
-            const dmq::LockGuard<Mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
-            // Does the target function have a return value?
-            if constexpr (std::is_void<RetType>::value == false) {
-                // Is the return value valid? 
-                if (m_retVal.has_value()) {
-                    // Return the destination thread target function return value
-                    return GetRetVal();
-                } else {
-                    // Return a default return value
-                    return RetType();
-                }
+        // Set flag that source is not waiting anymore and get the return value
+        auto retVal = msg->Complete();
+        if (m_success)
+            m_retVal = std::move(retVal);
+
+        // The destination thread may still hold or late signal a failed message
+        if (!m_success)
+            WaitMsgCache<MsgType>::Discard();
+
+        // Does the target function have a return value?
+        if constexpr (std::is_void<RetType>::value == false) {
+            // Is the return value valid? 
+            if (m_retVal.has_value()) {
+                // Return the destination thread target function return value
+                return GetRetVal();
+            } else {
+                // Return a default return value
+                return RetType();
             }
         }
     }
@@ -840,32 +886,12 @@ public:
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        auto delegateMsg = std::dynamic_pointer_cast<MsgType>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const dmq::LockGuard<Mutex> lock(delegateMsg->GetLock());
-
-        // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
-            // Invoke the delegate function synchronously
-            m_sync = true;
-
-            // Does target function have a void return value?
-            if constexpr (std::is_void<RetType>::value == true) {
-                // Invoke the target function using the source thread supplied function arguments
-                std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            } else {
-                // Invoke the target function using the source thread supplied function arguments 
-                // and get the return value
-                m_retVal = std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            }
-
-            // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
-        }
-        return true;
+        // The message holds the source delegate and waiting state
+        return delegateMsg->Invoke(msg);
     }
 
     /// Returns `true` if asynchronous function successfully invoked on the target thread
@@ -876,27 +902,16 @@ public:
     /// Get the asynchronous function return value
     /// @return The destination thread target function return value
     RetType GetRetVal() noexcept {
-        // Use pointer cast if exceptions are disabled OR if user requested Asserts-only mode
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-        // Fast, non-throwing check suitable for Embedded/Real-time
-        auto* p = std::any_cast<RetType>(&m_retVal);
-        if (p) return *p;
+        if constexpr (std::is_void<RetType>::value == false) {
+            if (m_retVal.has_value())
+                return *m_retVal;
 
-        // Optional: If you want to trap this error in debug mode
 #if defined(DMQ_ASSERTS)
-        ASSERT();
+            // Trap reading an invalid return value in debug mode
+            ASSERT();
 #endif
-
-        return RetType();
-#else
-        // Standard C++ behavior with Exception Handling
-        try {
-            return std::any_cast<RetType>(m_retVal);
-        }
-        catch (const std::bad_any_cast&) {
             return RetType();
         }
-#endif
     }
 
     ///@brief Get the destination thread that the target function is invoked on.
@@ -912,9 +927,6 @@ private:
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// Set to `true` if async function call succeeds
     bool m_success = false;			        
 
@@ -922,7 +934,7 @@ private:
     Duration m_timeout = WAIT_INFINITE;    
 
     /// Return value of the target invoked function
-    std::any m_retVal;
+    std::optional<typename MsgType::RetStorage> m_retVal;
 
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
@@ -989,6 +1001,9 @@ public:
 
     // <common_code>
 
+    /// The message type dispatched to the destination thread
+    using MsgType = DelegateAsyncWaitMsg<ClassType, RetType, Args...>;
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -1111,53 +1126,43 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
-            return BaseType::operator()(std::forward<Args>(args)...);
-        } else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread.
-            auto msg = xmake_shared<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
-            if (!msg)
-                BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
-
-            auto thread = this->GetThread();
-            if (thread) {
-                // Dispatch message onto the callback destination thread. Invoke()
-                // will be called by the destination thread. 
-                if (thread->DispatchDelegate(msg)) {
-                    // Wait for destination thread to execute the delegate function and get return value
-                    if (msg->GetSema().Wait(m_timeout)) {
-                        // Wait succeeded. Now acquire lock to safely read the value.
-                        const dmq::LockGuard<Mutex> lock(msg->GetLock());
-                        m_success = true;
-                        m_retVal = delegate->m_retVal;
-                    }
-                }
+        // Get this thread's reusable message. The message refers to this delegate 
+        // rather than a clone, since this thread is blocked until the invoke completes.
+        auto msg = WaitMsgCache<MsgType>::Acquire();
+        if (!msg)
+            BAD_ALLOC();
+        msg->Prepare(this, m_priority, std::forward<Args>(args)...);
+        msg->SetStrandKey(BaseType::GetTargetKey());
+
+        auto thread = this->GetThread();
+        if (thread) {
+            // Dispatch message onto the callback destination thread. Invoke()
+            // will be called by the destination thread. 
+            if (thread->DispatchDelegate(msg)) {
+                // Wait for destination thread to execute the delegate function
+                if (msg->GetSema().Wait(m_timeout))
+                    m_success = true;
             }
+        }
 
-            // Protect data shared between source and destination threads
-            const dmq::LockGuard<Mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
-            // Does the target function have a return value?
-            if constexpr (std::is_void<RetType>::value == false) {
-                // Is the return value valid? 
-                if (m_retVal.has_value()) {
-                    // Return the destination thread target function return value
-                    return GetRetVal();
-                } else {
-                    // Return a default return value
-                    return RetType();
-                }
+        // Set flag that source is not waiting anymore and get the return value
+        auto retVal = msg->Complete();
+        if (m_success)
+            m_retVal = std::move(retVal);
+
+        // The destination thread may still hold or late signal a failed message
+        if (!m_success)
+            WaitMsgCache<MsgType>::Discard();
+
+        // Does the target function have a return value?
+        if constexpr (std::is_void<RetType>::value == false) {
+            // Is the return value valid? 
+            if (m_retVal.has_value()) {
+                // Return the destination thread target function return value
+                return GetRetVal();
+            } else {
+                // Return a default return value
+                return RetType();
             }
         }
     }
@@ -1193,32 +1198,12 @@ public:
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        auto delegateMsg = std::dynamic_pointer_cast<MsgType>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const dmq::LockGuard<Mutex> lock(delegateMsg->GetLock());
-
-        // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
-            // Invoke the delegate function synchronously
-            m_sync = true;
-
-            // Does target function have a void return value?
-            if constexpr (std::is_void<RetType>::value == true) {
-                // Invoke the target function using the source thread supplied function arguments
-                std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            } else {
-                // Invoke the target function using the source thread supplied function arguments 
-                // and get the return value
-                m_retVal = std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            }
-
-            // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
-        }
-        return true;
+        // The message holds the source delegate and waiting state
+        return delegateMsg->Invoke(msg);
     }
 
     /// Returns `true` if asynchronous function successfully invoked on the target thread
@@ -1229,27 +1214,16 @@ public:
     /// Get the asynchronous function return value
     /// @return The destination thread target function return value
     RetType GetRetVal() noexcept {
-        // Use pointer cast if exceptions are disabled OR if user requested Asserts-only mode
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-        // Fast, non-throwing check suitable for Embedded/Real-time
-        auto* p = std::any_cast<RetType>(&m_retVal);
-        if (p) return *p;
+        if constexpr (std::is_void<RetType>::value == false) {
+            if (m_retVal.has_value())
+                return *m_retVal;
 
-        // Optional: If you want to trap this error in debug mode
 #if defined(DMQ_ASSERTS)
-        ASSERT();
+            // Trap reading an invalid return value in debug mode
+            ASSERT();
 #endif
-
-        return RetType();
-#else
-        // Standard C++ behavior with Exception Handling
-        try {
-            return std::any_cast<RetType>(m_retVal);
-        }
-        catch (const std::bad_any_cast&) {
             return RetType();
         }
-#endif
     }
 
     ///@brief Get the destination thread that the target function is invoked on.
@@ -1265,9 +1239,6 @@ private:
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// Set to `true` if async function call succeeds
     bool m_success = false;			        
 
@@ -1275,7 +1246,7 @@ private:
     Duration m_timeout = WAIT_INFINITE;    
 
     /// Return value of the target invoked function
-    std::any m_retVal;
+    std::optional<typename MsgType::RetStorage> m_retVal;
 
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
@@ -1344,6 +1315,9 @@ public:
 
     // <common_code>
 
+    /// The message type dispatched to the destination thread
+    using MsgType = DelegateAsyncWaitMsg<ClassType, RetType, Args...>;
+
     /// @brief Assigns the state of one object to another.
     /// @details Copy the state from the `rhs` (right-hand side) object to the
     /// current object.
@@ -1466,53 +1440,43 @@ public:
         if (this->Empty())
             return RetType();
 
-        // Synchronously invoke the target function?
-        if (m_sync) {
-            // Invoke the target function directly
-            return BaseType::operator()(std::forward<Args>(args)...);
-        } else {
-            // Create a clone instance of this delegate 
-            auto delegate = xmake_shared<ClassType>(*this);
-            if (!delegate)
-                BAD_ALLOC();
-
-            // Create a new message instance for sending to the destination thread.
-            auto msg = xmake_shared<DelegateAsyncWaitMsg<Args...>>(delegate, m_priority, std::forward<Args>(args)...);
-            if (!msg)
-                BAD_ALLOC();
-            msg->SetInvokerWaiting(true);
-
-            auto thread = this->GetThread();
-            if (thread) {
-                // Dispatch message onto the callback destination thread. Invoke()
-                // will be called by the destination thread. 
-                if (thread->DispatchDelegate(msg)) {
-                    // Wait for destination thread to execute the delegate function and get return value
-                    if (msg->GetSema().Wait(m_timeout)) {
-                        // Wait succeeded. Now acquire lock to safely read the value.
-                        const dmq::LockGuard<Mutex> lock(msg->GetLock());
-                        m_success = true;
-                        m_retVal = delegate->m_retVal;
-                    }
-                }
+        // Get this thread's reusable message. The message refers to this delegate 
+        // rather than a clone, since this thread is blocked until the invoke completes.
+        auto msg = WaitMsgCache<MsgType>::Acquire();
+        if (!msg)
+            BAD_ALLOC();
+        msg->Prepare(this, m_priority, std::forward<Args>(args)...);
+        msg->SetStrandKey(BaseType::GetTargetKey());
+
+        auto thread = this->GetThread();
+        if (thread) {
+            // Dispatch message onto the callback destination thread. Invoke()
+            // will be called by the destination thread. 
+            if (thread->DispatchDelegate(msg)) {
+                // Wait for destination thread to execute the delegate function
+                if (msg->GetSema().Wait(m_timeout))
+                    m_success = true;
             }
+        }
 
-            // Protect data shared between source and destination threads
-            const dmq::LockGuard<Mutex> lock(msg->GetLock());
-
-            // Set flag that source is not waiting anymore
-            msg->SetInvokerWaiting(false);
-
-            // Does the target function have a return value?
-            if constexpr (std::is_void<RetType>::value == false) {
-                // Is the return value valid? 
-                if (m_retVal.has_value()) {
-                    // Return the destination thread target function return value
-                    return GetRetVal();
-                } else {
-                    // Return a default return value
-                    return RetType();
-                }
+        // Set flag that source is not waiting anymore and get the return value
+        auto retVal = msg->Complete();
+        if (m_success)
+            m_retVal = std::move(retVal);
+
+        // The destination thread may still hold or late signal a failed message
+        if (!m_success)
+            WaitMsgCache<MsgType>::Discard();
+
+        // Does the target function have a return value?
+        if constexpr (std::is_void<RetType>::value == false) {
+            // Is the return value valid? 
+            if (m_retVal.has_value()) {
+                // Return the destination thread target function return value
+                return GetRetVal();
+            } else {
+                // Return a default return value
+                return RetType();
             }
         }
     }
@@ -1548,32 +1512,12 @@ public:
         static_assert(!(is_unique_ptr<RetType>::value), "std::unique_ptr return value not allowed");
 
         // Typecast the base pointer to back correct derived to instance
-        auto delegateMsg = std::dynamic_pointer_cast<DelegateAsyncWaitMsg<Args...>>(msg);
+        auto delegateMsg = std::dynamic_pointer_cast<MsgType>(msg);
         if (delegateMsg == nullptr)
             return false;
 
-        // Protect data shared between source and destination threads
-        const dmq::LockGuard<Mutex> lock(delegateMsg->GetLock());
-
-        // Is the source thread waiting for the target function invoke to complete?
-        if (delegateMsg->GetInvokerWaiting()) {
-            // Invoke the delegate function synchronously
-            m_sync = true;
-
-            // Does target function have a void return value?
-            if constexpr (std::is_void<RetType>::value == true) {
-                // Invoke the target function using the source thread supplied function arguments
-                std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            } else {
-                // Invoke the target function using the source thread supplied function arguments 
-                // and get the return value
-                m_retVal = std::apply(&BaseType::operator(), std::tuple_cat(std::make_tuple(this), delegateMsg->GetArgs()));
-            }
-
-            // Signal the source thread that the destination thread function call is complete
-            delegateMsg->GetSema().Signal();
-        }
-        return true;
+        // The message holds the source delegate and waiting state
+        return delegateMsg->Invoke(msg);
     }
 
     /// Returns `true` if asynchronous function successfully invoked on the target thread
@@ -1584,27 +1528,16 @@ public:
     /// Get the asynchronous function return value
     /// @return The destination thread target function return value
     RetType GetRetVal() noexcept {
-        // Use pointer cast if exceptions are disabled OR if user requested Asserts-only mode
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-        // Fast, non-throwing check suitable for Embedded/Real-time
-        auto* p = std::any_cast<RetType>(&m_retVal);
-        if (p) return *p;
+        if constexpr (std::is_void<RetType>::value == false) {
+            if (m_retVal.has_value())
+                return *m_retVal;
 
-        // Optional: If you want to trap this error in debug mode
 #if defined(DMQ_ASSERTS)
-        ASSERT();
+            // Trap reading an invalid return value in debug mode
+            ASSERT();
 #endif
-
-        return RetType();
-#else
-        // Standard C++ behavior with Exception Handling
-        try {
-            return std::any_cast<RetType>(m_retVal);
-        }
-        catch (const std::bad_any_cast&) {
             return RetType();
         }
-#endif
     }
 
     ///@brief Get the destination thread that the target function is invoked on.
@@ -1620,9 +1553,6 @@ private:
     /// The target thread to invoke the delegate function.
     IThread* m_thread = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
-
     /// Set to `true` if async function call succeeds
     bool m_success = false;			        
 
@@ -1630,7 +1560,7 @@ private:
     Duration m_timeout = WAIT_INFINITE;    
 
     /// Return value of the target invoked function
-    std::any m_retVal;
+    std::optional<typename MsgType::RetStorage> m_retVal;
 
     /// The delegate message priority
     Priority m_priority = Priority::NORMAL;
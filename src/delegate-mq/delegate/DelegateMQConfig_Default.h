@@ -25,6 +25,14 @@
     #define DMQ_DEFAULT_QUEUE_SIZE          20
 #endif
 
+#ifndef DMQ_LOCKFREE_QUEUE_SIZE
+    #define DMQ_LOCKFREE_QUEUE_SIZE         1024
+#endif
+
+#ifndef DMQ_SLAB_CHUNK_SIZE
+    #define DMQ_SLAB_CHUNK_SIZE             32
+#endif
+
 #ifndef DMQ_MAX_WATCHDOG_THREADS
     #define DMQ_MAX_WATCHDOG_THREADS        16
 #endif
@@ -37,4 +45,8 @@
     #define DMQ_MAX_PARTICIPANTS            8
 #endif
 
+#ifndef DMQ_DATABUS_TOPIC_BUCKETS
+    #define DMQ_DATABUS_TOPIC_BUCKETS       64
+#endif
+
 #endif // _DELEGATEMQ_CONFIG_DEFAULT_H
@@ -23,6 +23,13 @@
 /// Default internal message queue depth for all dmq::os::Thread ports.
 #define DMQ_DEFAULT_QUEUE_SIZE          20
 
+/// Per-priority ring capacity of a stdlib Thread using QueueEngine::LOCK_FREE
+/// with an unlimited (0) maxQueueSize.
+#define DMQ_LOCKFREE_QUEUE_SIZE         1024
+
+/// Blocks added to a SlabPool each time its free list runs empty (DMQ_SLAB_POOL).
+#define DMQ_SLAB_CHUNK_SIZE             32
+
 /// Max number of threads that can be registered with the watchdog.
 #define DMQ_MAX_WATCHDOG_THREADS        16
 
@@ -33,4 +40,8 @@
 /// Max number of remote Participants the DataBus can hold without heap allocation.
 #define DMQ_MAX_PARTICIPANTS            8
 
+/// Hash buckets in the DataBus topic table. Topic lookups on publish are lock-free;
+/// more buckets shorten the per-bucket chains when many topics are in use.
+#define DMQ_DATABUS_TOPIC_BUCKETS       64
+
 #endif // _DELEGATEMQ_CONFIG_H
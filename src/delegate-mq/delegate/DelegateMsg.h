@@ -7,6 +7,7 @@
 #include "IInvoker.h"
 #include "DelegateOpt.h"
 #include "make_tuple_heap.h"
+#include "async_arg.h"
 #include <tuple>
 #include <list>
 #include <memory>
@@ -24,7 +25,10 @@ enum class Priority
 };
 
 /// @brief Base class for all delegate inter-thread messages
-class DelegateMsg
+/// @details The invoker is either a separately owned object, or embedded within the 
+/// derived message itself. An embedded invoker shares the message ownership, so dispatching
+/// the message requires a single allocation. 
+class DelegateMsg : public std::enable_shared_from_this<DelegateMsg>
 {
 public:
 	/// Constructor
@@ -37,21 +41,52 @@ public:
 	virtual ~DelegateMsg() = default;
 
 	/// Get the delegate invoker instance the delegate is registered with.
-	/// @return The invoker instance. 
-	std::shared_ptr<IThreadInvoker> GetInvoker() const { return m_invoker; }
+	/// @return The invoker instance. An embedded invoker is returned as an aliasing
+	/// pointer that keeps this message alive.
+	std::shared_ptr<IThreadInvoker> GetInvoker() const { 
+		if (m_embeddedInvoker)
+			return std::shared_ptr<IThreadInvoker>(weak_from_this().lock(), m_embeddedInvoker);
+		return m_invoker; 
+	}
 
 	/// Get the delegate message priority
 	/// @return Delegate message priority
 	Priority GetPriority() const { return m_priority; }
 
+	/// Set the strand key. An `IThread` that runs messages concurrently (e.g. a thread
+	/// pool) executes messages with the same non-null key one at a time, in order.
+	/// @param[in] key - the strand key, typically the target object address.
+	void SetStrandKey(const void* key) { m_strandKey = key; }
+
+	/// Get the strand key
+	/// @return The strand key, or nullptr if the message has no ordering constraint.
+	const void* GetStrandKey() const { return m_strandKey; }
+
+protected:
+	/// Set an invoker instance owned by the derived message. Call from the derived
+	/// class constructor body once the invoker is fully constructed.
+	/// @param[in] invoker - the embedded invoker instance.
+	void SetEmbeddedInvoker(IThreadInvoker* invoker) { m_embeddedInvoker = invoker; }
+
+	/// Set the delegate message priority. Used by a derived message that is reused 
+	/// across dispatches.
+	/// @param[in] priority - the delegate message priority
+	void SetPriority(Priority priority) { m_priority = priority; }
+
 private:
 	/// The IThreadInvoker instance used to invoke the target function 
     /// on the destination thread of control
 	std::shared_ptr<IThreadInvoker> m_invoker;
 
+	/// An invoker embedded within the derived message, or nullptr
+	IThreadInvoker* m_embeddedInvoker = nullptr;
+
 	/// The delegate message priority
 	Priority m_priority = Priority::NORMAL;
 
+	/// Messages with the same non-null strand key are serialized
+	const void* m_strandKey = nullptr;
+
 	// Use fixed-block memory allocator if DMQ_ALLOCATOR set
 	XALLOCATOR
 };
@@ -187,6 +187,14 @@ namespace dmq
     /// Override via DMQ_DEFAULT_QUEUE_SIZE in delegatemqconfig.h.
     inline constexpr size_t DEFAULT_QUEUE_SIZE = DMQ_DEFAULT_QUEUE_SIZE;
 
+    /// @brief Per-priority ring capacity of an unbounded QueueEngine::LOCK_FREE stdlib Thread.
+    /// Override via DMQ_LOCKFREE_QUEUE_SIZE in delegatemqconfig.h.
+    inline constexpr size_t LOCKFREE_QUEUE_SIZE = DMQ_LOCKFREE_QUEUE_SIZE;
+
+    /// @brief Number of blocks added to a `SlabPool` each time its free list is empty.
+    /// Override via DMQ_SLAB_CHUNK_SIZE in delegatemqconfig.h.
+    inline constexpr size_t SLAB_CHUNK_SIZE = DMQ_SLAB_CHUNK_SIZE;
+
     /// @brief Max number of threads that can be monitored by the watchdog.
     /// Override via DMQ_MAX_WATCHDOG_THREADS in delegatemqconfig.h.
     inline constexpr size_t MAX_WATCHDOG_THREADS = DMQ_MAX_WATCHDOG_THREADS;
@@ -195,6 +203,10 @@ namespace dmq
     /// Override via DMQ_MAX_PARTICIPANTS in delegatemqconfig.h.
     inline constexpr size_t MAX_PARTICIPANTS = DMQ_MAX_PARTICIPANTS;
 
+    /// @brief Number of hash buckets in the DataBus topic table.
+    /// Override via DMQ_DATABUS_TOPIC_BUCKETS in delegatemqconfig.h.
+    inline constexpr size_t DATABUS_TOPIC_BUCKETS = DMQ_DATABUS_TOPIC_BUCKETS;
+
     // --- MUTEX / LOCK SELECTION ---
 #if defined(DMQ_THREAD_STDLIB) || defined(DMQ_THREAD_WIN32) || defined(DMQ_THREAD_QT)
     // Windows / Linux / macOS / Qt
@@ -236,9 +248,10 @@ namespace dmq
 
 #else
     // Bare metal has no threads, so no locking is required.
-    // NullMutex satisfies BasicLockable; PortableLockGuard compiles to nothing meaningful.
+    // NullMutex satisfies Lockable; PortableLockGuard compiles to nothing meaningful.
     struct NullMutex {
         void lock() {}
+        bool try_lock() { return true; }
         void unlock() {}
     };
     using Mutex = NullMutex;
@@ -248,6 +261,15 @@ namespace dmq
 #endif
 }
 
+// --- THREAD LOCAL STORAGE ---
+// Ports whose threads support C++ thread_local. Enables per-thread caches such as the
+// DelegateAsyncWait message cache. An RTOS port with toolchain TLS support may define
+// DMQ_HAS_THREAD_LOCAL in its config header.
+#if !defined(DMQ_HAS_THREAD_LOCAL) && \
+    (defined(DMQ_THREAD_STDLIB) || defined(DMQ_THREAD_WIN32) || defined(DMQ_THREAD_QT))
+    #define DMQ_HAS_THREAD_LOCAL
+#endif
+
 // Detect if exceptions are disabled at the compiler level
 #if !defined(__cpp_exceptions)
     #ifndef DMQ_ASSERTS
@@ -25,6 +25,17 @@
 /// 
 /// `void Invoke(std::istream& is)` - called by the receiver to invoke the target function. 
 /// 
+/// `SetBuffer()` selects a reusable `ByteBuffer` in place of the stream. The bytes are
+/// serialized into the buffer and dispatched in place, so once the buffer reaches its
+/// working size a remote call performs no per-message heap allocations (serializer and
+/// transport permitting).
+/// 
+/// `InvokeSpan()` deserializes straight from bytes owned by the caller, typically a
+/// transport receive buffer (see `ITransport::ReceiveView()`), without copying them.
+/// 
+/// `SetReuseArgs()` keeps the receive-side argument objects between messages so that
+/// container arguments are deserialized into their existing capacity.
+/// 
 /// Limitations:
 /// 
 /// * The target function return value is not valid after invoke since the delegate does 
@@ -50,8 +61,11 @@
 #include "UnicastDelegate.h"
 #include "ISerializer.h"
 #include "IDispatcher.h"
+#include "ByteBuffer.h"
 #include "IInvoker.h"
+#include <atomic>
 #include <tuple>
+#include <memory>
 #include <iostream>
 #include <stdexcept>
 
@@ -85,6 +99,9 @@ class RemoteArg
 {
 public:
     Arg& Get() { return m_arg; }
+
+    // Prepare the storage to be read into again (see SetReuseArgs())
+    void Reuse() { }
 private:
     Arg m_arg;
 };
@@ -99,6 +116,9 @@ public:
     // Return a REFERENCE to the pointer (L-value), satisfying ISerializer::Read
     Arg*& Get() { return m_ptr; }
 
+    // The serializer may have repointed m_ptr; point it back at the storage
+    void Reuse() { m_ptr = &m_arg; }
+
 private:
     Arg m_arg;   // The actual object storage
     Arg* m_ptr;  // The persistent pointer variable
@@ -126,10 +146,24 @@ class RemoteArg<Arg&>
 {
 public:
     Arg& Get() { return m_arg; }
+    void Reuse() { }
 private:
     Arg m_arg;
 };
 
+// Releases the reused remote argument storage, claimed with exchange(true), when
+// the guard goes out of scope
+class RemoteArgsGuard
+{
+public:
+    explicit RemoteArgsGuard(std::atomic<bool>& inUse) : m_inUse(inUse) { }
+    ~RemoteArgsGuard() { m_inUse.store(false, std::memory_order_release); }
+    RemoteArgsGuard(const RemoteArgsGuard&) = delete;
+    RemoteArgsGuard& operator=(const RemoteArgsGuard&) = delete;
+private:
+    std::atomic<bool>& m_inUse;
+};
+
 template <class R>
 class DelegateFreeRemote; // Not defined
 
@@ -143,6 +177,7 @@ public:
     typedef RetType(*FreeFunc)(Args...);
     using ClassType = DelegateFreeRemote<RetType(Args...)>;
     using BaseType = DelegateFree<RetType(Args...)>;
+    using ArgStorage = std::tuple<RemoteArg<Args>...>;
     using BaseType::operator=;
 
     /// @brief Constructor to create a class instance. Typically called by sender. 
@@ -171,9 +206,10 @@ public:
     /// @param[in] rhs The object to move from.
     DelegateFreeRemote(ClassType&& rhs) noexcept :
         BaseType(std::move(rhs)), m_id(rhs.m_id),
-        m_dispatcher(rhs.m_dispatcher), m_serializer(rhs.m_serializer), m_stream(rhs.m_stream) {
+        m_dispatcher(rhs.m_dispatcher), m_serializer(rhs.m_serializer), m_stream(rhs.m_stream), m_buffer(rhs.m_buffer),
+        m_args(std::move(rhs.m_args)), m_reuseArgs(rhs.m_reuseArgs) {
         rhs.Clear();
-        rhs.m_dispatcher = nullptr; rhs.m_serializer = nullptr; rhs.m_stream = nullptr;
+        rhs.m_dispatcher = nullptr; rhs.m_serializer = nullptr; rhs.m_stream = nullptr; rhs.m_buffer = nullptr;
     }
 
     DelegateFreeRemote() = default;
@@ -197,6 +233,8 @@ public:
     /// @param[in] rhs The object whose state is to be copied.
     void Assign(const ClassType& rhs) {
         m_id = rhs.m_id;
+        m_reuseArgs = rhs.m_reuseArgs;
+        m_args.reset();     // Argument storage is per instance; allocated on first use
         BaseType::Assign(rhs);
     }
 
@@ -228,6 +266,8 @@ public:
         if (&rhs != this) {
             BaseType::operator=(std::move(rhs));
             m_id = rhs.m_id;    // Use the resource
+            m_args = std::move(rhs.m_args);
+            m_reuseArgs = rhs.m_reuseArgs;
         }
         return *this;
     }
@@ -305,48 +345,12 @@ public:
             return BaseType::operator()(std::forward<Args>(args)...);
         }
         else {
-            if (m_serializer && m_stream) {
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-                // Serialize all target function arguments into a stream
-                m_serializer->Write(*m_stream, std::forward<Args>(args)...);
-                RaiseSuccess(m_id);
-#else
-                try {
-                    // Serialize all target function arguments into a stream
-                    m_serializer->Write(*m_stream, std::forward<Args>(args)...);
-                    RaiseSuccess(m_id);
-                }
-                catch (std::exception&) {
-                    RaiseError(m_id, DelegateError::ERR_SERIALIZE);
-                }
-#endif
-
-                if (!m_stream->good()) {
-                    RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
-                }
-                else {
-                    // Dispatch delegate invocation to the remote destination
-                    if (m_dispatcher) {
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-                        int error = m_dispatcher->Dispatch(*m_stream, m_id);
-                        if (error)
-                            RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
-#else
-                        try {
-                            int error = m_dispatcher->Dispatch(*m_stream, m_id);
-                            if (error)
-                                RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
-                        }
-                        catch (std::exception&) {
-                            RaiseError(m_id, DelegateError::ERR_DISPATCH);
-                        }
-#endif
-                    }
-                    else {
-                        RaiseError(m_id, DelegateError::ERR_NO_DISPATCHER);
-                    }
-                }
-
+            // Serialize into the byte buffer if set, otherwise the stream
+            if (m_serializer && m_buffer) {
+                SerializeAndDispatch(*m_buffer, args...);
+            }
+            else if (m_serializer && m_stream) {
+                SerializeAndDispatch(*m_stream, args...);
             }
 
             // Do not wait for remote to invoke function call
@@ -373,6 +377,19 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Send function argument data that is already serialized. Used to
+    /// serialize once and send the same bytes to several remote destinations.
+    /// @param[in] payload Argument data written by a serializer compatible with
+    /// the receiver's serializer.
+    void DispatchSerialized(const ByteBuffer& payload) {
+        if (!IsGood(payload)) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return;
+        }
+        RaiseSuccess(m_id);
+        DispatchSink(payload);
+    }
+
     /// @brief Invoke the delegate function on the destination receiver. Called by the 
     /// remote destination. The sender serializes all target function arguments. This
     /// function unserializes the argument data and invokes the remote target function.
@@ -392,67 +409,46 @@ public:
             return false;
         }
 
-        // Invoke the delegate function synchronously
-        m_sync = true;
+        return DeserializeAndInvoke(is);
+    }
 
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-        if constexpr (ArgCnt::value == 0) {
-            BaseType::operator()();
+    /// @brief Invoke the delegate function on the destination receiver using argument
+    /// data held in a byte buffer. Reads from the buffer read position.
+    /// @param[in] buffer The delegate argument data created and sent within 
+    /// `operator()(Args... args)`.
+    /// @return `true` if target function invoked; `false` if error. 
+    virtual bool InvokeBuffer(ByteBuffer& buffer) override {
+        if (!m_serializer) {
+            RaiseError(m_id, DelegateError::ERR_NO_SERIALIZER);
+            return false;
         }
-        else {
-            // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
-            std::tuple<RemoteArg<Args>...> remoteArgs;
-
-            // 2. Use std::apply to unpack the tuple elements
-            std::apply([this, &is](auto&... rArgs) {
 
-                // 3. Deserialize: Expand the pack to call Read(is, arg1, arg2...)
-                // rArgs.Get() returns the reference/pointer to the internal storage
-                m_serializer->Read(is, rArgs.Get()...);
-
-                if (!is.bad() && !is.fail()) {
-                    // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
-                    this->operator()(rArgs.Get()...);
-                }
-                else {
-                    this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
-                }
-
-                }, remoteArgs);
+        if (!buffer.Good()) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return false;
         }
-#else
-        try {
-            if constexpr (ArgCnt::value == 0) {
-                BaseType::operator()();
-            }
-            else {
-                // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
-                std::tuple<RemoteArg<Args>...> remoteArgs;
-
-                // 2. Use std::apply to unpack the tuple elements
-                std::apply([this, &is](auto&... rArgs) {
 
-                    // 3. Deserialize: Expand the pack to call Read(is, arg1, arg2...)
-                    // rArgs.Get() returns the reference/pointer to the internal storage
-                    m_serializer->Read(is, rArgs.Get()...);
-
-                    if (!is.bad() && !is.fail()) {
-                        // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
-                        this->operator()(rArgs.Get()...);
-                    }
-                    else {
-                        this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
-                    }
+        return DeserializeAndInvoke(buffer);
+    }
 
-                    }, remoteArgs);
-            }
+    /// @brief Invoke the delegate function on the destination receiver using argument
+    /// data viewed in place (e.g. a transport receive buffer). Reads from the span
+    /// read position without copying the bytes.
+    /// @param[in] span The delegate argument data created and sent within 
+    /// `operator()(Args... args)`.
+    /// @return `true` if target function invoked; `false` if error. 
+    virtual bool InvokeSpan(ByteSpan& span) override {
+        if (!m_serializer) {
+            RaiseError(m_id, DelegateError::ERR_NO_SERIALIZER);
+            return false;
         }
-        catch (std::exception&) {
-            RaiseError(m_id, DelegateError::ERR_DESERIALIZE_EXCEPTION);
+
+        if (!span.Good()) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return false;
         }
-#endif
 
-        return true;
+        return DeserializeAndInvoke(span);
     }
 
     ///@brief Get the remote identifier.
@@ -483,6 +479,31 @@ public:
         m_stream = stream;
     }
 
+    /// @brief Set the byte buffer used to store serialized function argument
+    /// data. When set, the buffer is used instead of the stream.
+    /// @param[in] buffer A reusable byte buffer.
+    void SetBuffer(ByteBuffer* buffer) {
+        m_buffer = buffer;
+    }
+
+    /// @brief Keep the receive-side argument objects between `Invoke()` calls and
+    /// deserialize each message into them in place. Container arguments (e.g.
+    /// `std::vector`, `std::string`) then keep their capacity, so a steady message
+    /// rate performs no per-message argument allocations. Off by default.
+    /// @details Arguments passed by value are still copied into the target function;
+    /// use reference arguments (e.g. `void(std::vector<float>&)`) to avoid the copy.
+    /// The target must not keep a reference or pointer to an argument after it
+    /// returns. The serializer must overwrite each argument completely; a field it
+    /// skips keeps the value from the previous message. A re-entrant `Invoke()`, or
+    /// one concurrent with another thread's, deserializes into temporary arguments.
+    /// Call before messages are received.
+    /// @param[in] reuse `true` to reuse the argument storage.
+    void SetReuseArgs(bool reuse) {
+        m_reuseArgs = reuse;
+        if (!reuse)
+            m_args.reset();
+    }
+
     /// @brief Set the error handler
     /// @param[in] errorHandler The delegate error handler called when 
     /// an error is detected.
@@ -512,6 +533,141 @@ public:
     }
 
 private:
+    static bool IsGood(const std::ios& s) noexcept { return !s.bad() && !s.fail(); }
+    static bool IsGood(const ByteBuffer& b) noexcept { return b.Good(); }
+    static bool IsGood(const ByteSpan& b) noexcept { return b.Good(); }
+
+    /// Route a stream, byte buffer or span to the matching serializer/dispatcher call.
+    void WriteArgs(std::ostream& os, const Args&... args) { m_serializer->Write(os, args...); }
+    void WriteArgs(ByteBuffer& buffer, const Args&... args) { m_serializer->WriteBuffer(buffer, args...); }
+    void ReadArgs(std::istream& is, Args&... args) { m_serializer->Read(is, args...); }
+    void ReadArgs(ByteBuffer& buffer, Args&... args) { m_serializer->ReadBuffer(buffer, args...); }
+    void ReadArgs(ByteSpan& span, Args&... args) { m_serializer->ReadSpan(span, args...); }
+    int DispatchArgs(std::ostream& os) { return m_dispatcher->Dispatch(os, m_id); }
+    int DispatchArgs(const ByteBuffer& buffer) { return m_dispatcher->DispatchBuffer(buffer, m_id); }
+
+    /// Serialize the arguments into `sink` (a stream or byte buffer) and dispatch.
+    template <class Sink>
+    void SerializeAndDispatch(Sink& sink, const Args&... args) {
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+        // Serialize all target function arguments
+        WriteArgs(sink, args...);
+        RaiseSuccess(m_id);
+#else
+        try {
+            // Serialize all target function arguments
+            WriteArgs(sink, args...);
+            RaiseSuccess(m_id);
+        }
+        catch (std::exception&) {
+            RaiseError(m_id, DelegateError::ERR_SERIALIZE);
+        }
+#endif
+
+        if (!IsGood(sink)) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+        }
+        else {
+            DispatchSink(sink);
+        }
+    }
+
+    /// Dispatch serialized argument data in `sink` to the remote destination.
+    template <class Sink>
+    void DispatchSink(Sink& sink) {
+        if (m_dispatcher) {
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+            int error = DispatchArgs(sink);
+            if (error)
+                RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
+#else
+            try {
+                int error = DispatchArgs(sink);
+                if (error)
+                    RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
+            }
+            catch (std::exception&) {
+                RaiseError(m_id, DelegateError::ERR_DISPATCH);
+            }
+#endif
+        }
+        else {
+            RaiseError(m_id, DelegateError::ERR_NO_DISPATCHER);
+        }
+    }
+
+    /// Deserialize the arguments from `source` (a stream, byte buffer or span) and invoke
+    /// the target function synchronously.
+    template <class Source>
+    bool DeserializeAndInvoke(Source& source) {
+        // Invoke the delegate function synchronously
+        m_sync = true;
+
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+        if constexpr (ArgCnt::value == 0) {
+            BaseType::operator()();
+        }
+        else {
+            ReadAndInvoke(source);
+        }
+#else
+        try {
+            if constexpr (ArgCnt::value == 0) {
+                BaseType::operator()();
+            }
+            else {
+                ReadAndInvoke(source);
+            }
+        }
+        catch (std::exception&) {
+            RaiseError(m_id, DelegateError::ERR_DESERIALIZE_EXCEPTION);
+        }
+#endif
+
+        return true;
+    }
+
+    /// Select the argument storage: the reused storage if enabled and not held by an
+    /// outer or concurrent `Invoke()`, otherwise temporary storage.
+    template <class Source>
+    void ReadAndInvoke(Source& source) {
+        if (m_reuseArgs && !m_argsInUse.exchange(true, std::memory_order_acquire)) {
+            RemoteArgsGuard guard(m_argsInUse);
+            if (!m_args)
+                m_args.reset(new(std::nothrow) ArgStorage());
+            if (m_args) {
+                ReadAndInvoke(source, *m_args);
+                return;
+            }
+        }
+
+        // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
+        ArgStorage remoteArgs;
+        ReadAndInvoke(source, remoteArgs);
+    }
+
+    /// Deserialize into `remoteArgs` and invoke the target function.
+    template <class Source>
+    void ReadAndInvoke(Source& source, ArgStorage& remoteArgs) {
+        // 2. Use std::apply to unpack the tuple elements
+        std::apply([this, &source](auto&... rArgs) {
+            (rArgs.Reuse(), ...);
+
+            // 3. Deserialize: Expand the pack to call ReadArgs(source, arg1, arg2...)
+            // rArgs.Get() returns the reference/pointer to the internal storage
+            this->ReadArgs(source, rArgs.Get()...);
+
+            if (IsGood(source)) {
+                // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
+                this->operator()(rArgs.Get()...);
+            }
+            else {
+                this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
+            }
+
+            }, remoteArgs);
+    }
+
     /// Raise an error and callback registered error handler
     /// @param[in] id Remote delegate ID.
     /// @param[in] error Error code.
@@ -550,8 +706,9 @@ private:
     /// A pointer to the function argument serializer
     ISerializer<RetType(Args...)>* m_serializer = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
+    /// Flag to control synchronous vs asynchronous target invoke behavior. Set by
+    /// each receive-side `Invoke()`, which may run on several threads.
+    std::atomic<bool> m_sync{ false };
 
     /// The error detected
     DelegateError m_error = DelegateError::SUCCESS;
@@ -559,6 +716,20 @@ private:
     /// Stream to store serialize remote argument function data
     std::ostream* m_stream = nullptr;
 
+    /// Byte buffer to store serialize remote argument function data. Used
+    /// instead of m_stream when set.
+    ByteBuffer* m_buffer = nullptr;
+
+    /// Receive-side argument storage kept between invokes. See SetReuseArgs().
+    std::unique_ptr<ArgStorage> m_args;
+
+    /// Reuse m_args for each received message.
+    bool m_reuseArgs = false;
+
+    /// Set while m_args is being read or passed to the target function. Atomic so
+    /// concurrent `Invoke()` calls on one delegate fall back to temporary storage.
+    std::atomic<bool> m_argsInUse{ false };
+
     // </common_code>
 };
 
@@ -579,6 +750,7 @@ public:
     typedef RetType(TClass::* ConstMemberFunc)(Args...) const;
     using ClassType = DelegateMemberRemote<TClass, RetType(Args...)>;
     using BaseType = DelegateMember<TClass, RetType(Args...)>;
+    using ArgStorage = std::tuple<RemoteArg<Args>...>;
     using BaseType::operator=;
 
     /// @brief Constructor to create a class instance. Typically called by sender. 
@@ -631,9 +803,10 @@ public:
     /// @param[in] rhs The object to move from.
     DelegateMemberRemote(ClassType&& rhs) noexcept :
         BaseType(std::move(rhs)), m_id(rhs.m_id),
-        m_dispatcher(rhs.m_dispatcher), m_serializer(rhs.m_serializer), m_stream(rhs.m_stream) {
+        m_dispatcher(rhs.m_dispatcher), m_serializer(rhs.m_serializer), m_stream(rhs.m_stream), m_buffer(rhs.m_buffer),
+        m_args(std::move(rhs.m_args)), m_reuseArgs(rhs.m_reuseArgs) {
         rhs.Clear();
-        rhs.m_dispatcher = nullptr; rhs.m_serializer = nullptr; rhs.m_stream = nullptr;
+        rhs.m_dispatcher = nullptr; rhs.m_serializer = nullptr; rhs.m_stream = nullptr; rhs.m_buffer = nullptr;
     }
 
     DelegateMemberRemote() = default;
@@ -694,6 +867,8 @@ public:
     /// @param[in] rhs The object whose state is to be copied.
     void Assign(const ClassType& rhs) {
         m_id = rhs.m_id;
+        m_reuseArgs = rhs.m_reuseArgs;
+        m_args.reset();     // Argument storage is per instance; allocated on first use
         BaseType::Assign(rhs);
     }
 
@@ -725,6 +900,8 @@ public:
         if (&rhs != this) {
             BaseType::operator=(std::move(rhs));
             m_id = rhs.m_id;    // Use the resource
+            m_args = std::move(rhs.m_args);
+            m_reuseArgs = rhs.m_reuseArgs;
         }
         return *this;
     }
@@ -802,48 +979,12 @@ public:
             return BaseType::operator()(std::forward<Args>(args)...);
         }
         else {
-            if (m_serializer && m_stream) {
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-                // Serialize all target function arguments into a stream
-                m_serializer->Write(*m_stream, std::forward<Args>(args)...);
-                RaiseSuccess(m_id);
-#else
-                try {
-                    // Serialize all target function arguments into a stream
-                    m_serializer->Write(*m_stream, std::forward<Args>(args)...);
-                    RaiseSuccess(m_id);
-                }
-                catch (std::exception&) {
-                    RaiseError(m_id, DelegateError::ERR_SERIALIZE);
-                }
-#endif
-
-                if (!m_stream->good()) {
-                    RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
-                }
-                else {
-                    // Dispatch delegate invocation to the remote destination
-                    if (m_dispatcher) {
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-                        int error = m_dispatcher->Dispatch(*m_stream, m_id);
-                        if (error)
-                            RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
-#else
-                        try {
-                            int error = m_dispatcher->Dispatch(*m_stream, m_id);
-                            if (error)
-                                RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
-                        }
-                        catch (std::exception&) {
-                            RaiseError(m_id, DelegateError::ERR_DISPATCH);
-                        }
-#endif
-                    }
-                    else {
-                        RaiseError(m_id, DelegateError::ERR_NO_DISPATCHER);
-                    }
-                }
-
+            // Serialize into the byte buffer if set, otherwise the stream
+            if (m_serializer && m_buffer) {
+                SerializeAndDispatch(*m_buffer, args...);
+            }
+            else if (m_serializer && m_stream) {
+                SerializeAndDispatch(*m_stream, args...);
             }
 
             // Do not wait for remote to invoke function call
@@ -870,6 +1011,19 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Send function argument data that is already serialized. Used to
+    /// serialize once and send the same bytes to several remote destinations.
+    /// @param[in] payload Argument data written by a serializer compatible with
+    /// the receiver's serializer.
+    void DispatchSerialized(const ByteBuffer& payload) {
+        if (!IsGood(payload)) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return;
+        }
+        RaiseSuccess(m_id);
+        DispatchSink(payload);
+    }
+
     /// @brief Invoke the delegate function on the destination receiver. Called by the 
     /// remote destination. The sender serializes all target function arguments. This
     /// function unserializes the argument data and invokes the remote target function.
@@ -889,67 +1043,46 @@ public:
             return false;
         }
 
-        // Invoke the delegate function synchronously
-        m_sync = true;
+        return DeserializeAndInvoke(is);
+    }
 
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-        if constexpr (ArgCnt::value == 0) {
-            BaseType::operator()();
+    /// @brief Invoke the delegate function on the destination receiver using argument
+    /// data held in a byte buffer. Reads from the buffer read position.
+    /// @param[in] buffer The delegate argument data created and sent within 
+    /// `operator()(Args... args)`.
+    /// @return `true` if target function invoked; `false` if error. 
+    virtual bool InvokeBuffer(ByteBuffer& buffer) override {
+        if (!m_serializer) {
+            RaiseError(m_id, DelegateError::ERR_NO_SERIALIZER);
+            return false;
         }
-        else {
-            // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
-            std::tuple<RemoteArg<Args>...> remoteArgs;
-
-            // 2. Use std::apply to unpack the tuple elements
-            std::apply([this, &is](auto&... rArgs) {
-
-                // 3. Deserialize: Expand the pack to call Read(is, arg1, arg2...)
-                // rArgs.Get() returns the reference/pointer to the internal storage
-                m_serializer->Read(is, rArgs.Get()...);
 
-                if (!is.bad() && !is.fail()) {
-                    // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
-                    this->operator()(rArgs.Get()...);
-                }
-                else {
-                    this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
-                }
-
-                }, remoteArgs);
+        if (!buffer.Good()) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return false;
         }
-#else
-        try {
-            if constexpr (ArgCnt::value == 0) {
-                BaseType::operator()();
-            }
-            else {
-                // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
-                std::tuple<RemoteArg<Args>...> remoteArgs;
 
-                // 2. Use std::apply to unpack the tuple elements
-                std::apply([this, &is](auto&... rArgs) {
-
-                    // 3. Deserialize: Expand the pack to call Read(is, arg1, arg2...)
-                    // rArgs.Get() returns the reference/pointer to the internal storage
-                    m_serializer->Read(is, rArgs.Get()...);
-
-                    if (!is.bad() && !is.fail()) {
-                        // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
-                        this->operator()(rArgs.Get()...);
-                    }
-                    else {
-                        this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
-                    }
+        return DeserializeAndInvoke(buffer);
+    }
 
-                    }, remoteArgs);
-            }
+    /// @brief Invoke the delegate function on the destination receiver using argument
+    /// data viewed in place (e.g. a transport receive buffer). Reads from the span
+    /// read position without copying the bytes.
+    /// @param[in] span The delegate argument data created and sent within 
+    /// `operator()(Args... args)`.
+    /// @return `true` if target function invoked; `false` if error. 
+    virtual bool InvokeSpan(ByteSpan& span) override {
+        if (!m_serializer) {
+            RaiseError(m_id, DelegateError::ERR_NO_SERIALIZER);
+            return false;
         }
-        catch (std::exception&) {
-            RaiseError(m_id, DelegateError::ERR_DESERIALIZE_EXCEPTION);
+
+        if (!span.Good()) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return false;
         }
-#endif
 
-        return true;
+        return DeserializeAndInvoke(span);
     }
 
     ///@brief Get the remote identifier.
@@ -980,6 +1113,31 @@ public:
         m_stream = stream;
     }
 
+    /// @brief Set the byte buffer used to store serialized function argument
+    /// data. When set, the buffer is used instead of the stream.
+    /// @param[in] buffer A reusable byte buffer.
+    void SetBuffer(ByteBuffer* buffer) {
+        m_buffer = buffer;
+    }
+
+    /// @brief Keep the receive-side argument objects between `Invoke()` calls and
+    /// deserialize each message into them in place. Container arguments (e.g.
+    /// `std::vector`, `std::string`) then keep their capacity, so a steady message
+    /// rate performs no per-message argument allocations. Off by default.
+    /// @details Arguments passed by value are still copied into the target function;
+    /// use reference arguments (e.g. `void(std::vector<float>&)`) to avoid the copy.
+    /// The target must not keep a reference or pointer to an argument after it
+    /// returns. The serializer must overwrite each argument completely; a field it
+    /// skips keeps the value from the previous message. A re-entrant `Invoke()`, or
+    /// one concurrent with another thread's, deserializes into temporary arguments.
+    /// Call before messages are received.
+    /// @param[in] reuse `true` to reuse the argument storage.
+    void SetReuseArgs(bool reuse) {
+        m_reuseArgs = reuse;
+        if (!reuse)
+            m_args.reset();
+    }
+
     /// @brief Set the error handler
     /// @param[in] errorHandler The delegate error handler called when 
     /// an error is detected.
@@ -1009,6 +1167,141 @@ public:
     }
 
 private:
+    static bool IsGood(const std::ios& s) noexcept { return !s.bad() && !s.fail(); }
+    static bool IsGood(const ByteBuffer& b) noexcept { return b.Good(); }
+    static bool IsGood(const ByteSpan& b) noexcept { return b.Good(); }
+
+    /// Route a stream, byte buffer or span to the matching serializer/dispatcher call.
+    void WriteArgs(std::ostream& os, const Args&... args) { m_serializer->Write(os, args...); }
+    void WriteArgs(ByteBuffer& buffer, const Args&... args) { m_serializer->WriteBuffer(buffer, args...); }
+    void ReadArgs(std::istream& is, Args&... args) { m_serializer->Read(is, args...); }
+    void ReadArgs(ByteBuffer& buffer, Args&... args) { m_serializer->ReadBuffer(buffer, args...); }
+    void ReadArgs(ByteSpan& span, Args&... args) { m_serializer->ReadSpan(span, args...); }
+    int DispatchArgs(std::ostream& os) { return m_dispatcher->Dispatch(os, m_id); }
+    int DispatchArgs(const ByteBuffer& buffer) { return m_dispatcher->DispatchBuffer(buffer, m_id); }
+
+    /// Serialize the arguments into `sink` (a stream or byte buffer) and dispatch.
+    template <class Sink>
+    void SerializeAndDispatch(Sink& sink, const Args&... args) {
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+        // Serialize all target function arguments
+        WriteArgs(sink, args...);
+        RaiseSuccess(m_id);
+#else
+        try {
+            // Serialize all target function arguments
+            WriteArgs(sink, args...);
+            RaiseSuccess(m_id);
+        }
+        catch (std::exception&) {
+            RaiseError(m_id, DelegateError::ERR_SERIALIZE);
+        }
+#endif
+
+        if (!IsGood(sink)) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+        }
+        else {
+            DispatchSink(sink);
+        }
+    }
+
+    /// Dispatch serialized argument data in `sink` to the remote destination.
+    template <class Sink>
+    void DispatchSink(Sink& sink) {
+        if (m_dispatcher) {
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+            int error = DispatchArgs(sink);
+            if (error)
+                RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
+#else
+            try {
+                int error = DispatchArgs(sink);
+                if (error)
+                    RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
+            }
+            catch (std::exception&) {
+                RaiseError(m_id, DelegateError::ERR_DISPATCH);
+            }
+#endif
+        }
+        else {
+            RaiseError(m_id, DelegateError::ERR_NO_DISPATCHER);
+        }
+    }
+
+    /// Deserialize the arguments from `source` (a stream, byte buffer or span) and invoke
+    /// the target function synchronously.
+    template <class Source>
+    bool DeserializeAndInvoke(Source& source) {
+        // Invoke the delegate function synchronously
+        m_sync = true;
+
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+        if constexpr (ArgCnt::value == 0) {
+            BaseType::operator()();
+        }
+        else {
+            ReadAndInvoke(source);
+        }
+#else
+        try {
+            if constexpr (ArgCnt::value == 0) {
+                BaseType::operator()();
+            }
+            else {
+                ReadAndInvoke(source);
+            }
+        }
+        catch (std::exception&) {
+            RaiseError(m_id, DelegateError::ERR_DESERIALIZE_EXCEPTION);
+        }
+#endif
+
+        return true;
+    }
+
+    /// Select the argument storage: the reused storage if enabled and not held by an
+    /// outer or concurrent `Invoke()`, otherwise temporary storage.
+    template <class Source>
+    void ReadAndInvoke(Source& source) {
+        if (m_reuseArgs && !m_argsInUse.exchange(true, std::memory_order_acquire)) {
+            RemoteArgsGuard guard(m_argsInUse);
+            if (!m_args)
+                m_args.reset(new(std::nothrow) ArgStorage());
+            if (m_args) {
+                ReadAndInvoke(source, *m_args);
+                return;
+            }
+        }
+
+        // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
+        ArgStorage remoteArgs;
+        ReadAndInvoke(source, remoteArgs);
+    }
+
+    /// Deserialize into `remoteArgs` and invoke the target function.
+    template <class Source>
+    void ReadAndInvoke(Source& source, ArgStorage& remoteArgs) {
+        // 2. Use std::apply to unpack the tuple elements
+        std::apply([this, &source](auto&... rArgs) {
+            (rArgs.Reuse(), ...);
+
+            // 3. Deserialize: Expand the pack to call ReadArgs(source, arg1, arg2...)
+            // rArgs.Get() returns the reference/pointer to the internal storage
+            this->ReadArgs(source, rArgs.Get()...);
+
+            if (IsGood(source)) {
+                // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
+                this->operator()(rArgs.Get()...);
+            }
+            else {
+                this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
+            }
+
+            }, remoteArgs);
+    }
+
     /// Raise an error and callback registered error handler
     /// @param[in] id Remote delegate ID.
     /// @param[in] error Error code.
@@ -1047,8 +1340,9 @@ private:
     /// A pointer to the function argument serializer
     ISerializer<RetType(Args...)>* m_serializer = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
+    /// Flag to control synchronous vs asynchronous target invoke behavior. Set by
+    /// each receive-side `Invoke()`, which may run on several threads.
+    std::atomic<bool> m_sync{ false };
 
     /// The error detected
     DelegateError m_error = DelegateError::SUCCESS;
@@ -1056,6 +1350,20 @@ private:
     /// Stream to store serialize remote argument function data
     std::ostream* m_stream = nullptr;
 
+    /// Byte buffer to store serialize remote argument function data. Used
+    /// instead of m_stream when set.
+    ByteBuffer* m_buffer = nullptr;
+
+    /// Receive-side argument storage kept between invokes. See SetReuseArgs().
+    std::unique_ptr<ArgStorage> m_args;
+
+    /// Reuse m_args for each received message.
+    bool m_reuseArgs = false;
+
+    /// Set while m_args is being read or passed to the target function. Atomic so
+    /// concurrent `Invoke()` calls on one delegate fall back to temporary storage.
+    std::atomic<bool> m_argsInUse{ false };
+
     // </common_code>
 };
 
@@ -1077,6 +1385,7 @@ public:
     using FunctionType = std::function<RetType(Args...)>;
     using ClassType = DelegateFunctionRemote<RetType(Args...)>;
     using BaseType = DelegateFunction<RetType(Args...)>;
+    using ArgStorage = std::tuple<RemoteArg<Args>...>;
     using BaseType::operator=;
 
     /// @brief Constructor to create a class instance. Typically called by sender. 
@@ -1105,9 +1414,10 @@ public:
     /// @param[in] rhs The object to move from.
     DelegateFunctionRemote(ClassType&& rhs) noexcept :
         BaseType(std::move(rhs)), m_id(rhs.m_id),
-        m_dispatcher(rhs.m_dispatcher), m_serializer(rhs.m_serializer), m_stream(rhs.m_stream) {
+        m_dispatcher(rhs.m_dispatcher), m_serializer(rhs.m_serializer), m_stream(rhs.m_stream), m_buffer(rhs.m_buffer),
+        m_args(std::move(rhs.m_args)), m_reuseArgs(rhs.m_reuseArgs) {
         rhs.Clear();
-        rhs.m_dispatcher = nullptr; rhs.m_serializer = nullptr; rhs.m_stream = nullptr;
+        rhs.m_dispatcher = nullptr; rhs.m_serializer = nullptr; rhs.m_stream = nullptr; rhs.m_buffer = nullptr;
     }
 
     DelegateFunctionRemote() = default;
@@ -1131,6 +1441,8 @@ public:
     /// @param[in] rhs The object whose state is to be copied.
     void Assign(const ClassType& rhs) {
         m_id = rhs.m_id;
+        m_reuseArgs = rhs.m_reuseArgs;
+        m_args.reset();     // Argument storage is per instance; allocated on first use
         BaseType::Assign(rhs);
     }
 
@@ -1162,6 +1474,8 @@ public:
         if (&rhs != this) {
             BaseType::operator=(std::move(rhs));
             m_id = rhs.m_id;    // Use the resource
+            m_args = std::move(rhs.m_args);
+            m_reuseArgs = rhs.m_reuseArgs;
         }
         return *this;
     }
@@ -1239,48 +1553,12 @@ public:
             return BaseType::operator()(std::forward<Args>(args)...);
         }
         else {
-            if (m_serializer && m_stream) {
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-                // Serialize all target function arguments into a stream
-                m_serializer->Write(*m_stream, std::forward<Args>(args)...);
-                RaiseSuccess(m_id);
-#else
-                try {
-                    // Serialize all target function arguments into a stream
-                    m_serializer->Write(*m_stream, std::forward<Args>(args)...);
-                    RaiseSuccess(m_id);
-                }
-                catch (std::exception&) {
-                    RaiseError(m_id, DelegateError::ERR_SERIALIZE);
-                }
-#endif
-
-                if (!m_stream->good()) {
-                    RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
-                }
-                else {
-                    // Dispatch delegate invocation to the remote destination
-                    if (m_dispatcher) {
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-                        int error = m_dispatcher->Dispatch(*m_stream, m_id);
-                        if (error)
-                            RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
-#else
-                        try {
-                            int error = m_dispatcher->Dispatch(*m_stream, m_id);
-                            if (error)
-                                RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
-                        }
-                        catch (std::exception&) {
-                            RaiseError(m_id, DelegateError::ERR_DISPATCH);
-                        }
-#endif
-                    }
-                    else {
-                        RaiseError(m_id, DelegateError::ERR_NO_DISPATCHER);
-                    }
-                }
-
+            // Serialize into the byte buffer if set, otherwise the stream
+            if (m_serializer && m_buffer) {
+                SerializeAndDispatch(*m_buffer, args...);
+            }
+            else if (m_serializer && m_stream) {
+                SerializeAndDispatch(*m_stream, args...);
             }
 
             // Do not wait for remote to invoke function call
@@ -1307,6 +1585,19 @@ public:
         operator()(std::forward<Args>(args)...);
     }
 
+    /// @brief Send function argument data that is already serialized. Used to
+    /// serialize once and send the same bytes to several remote destinations.
+    /// @param[in] payload Argument data written by a serializer compatible with
+    /// the receiver's serializer.
+    void DispatchSerialized(const ByteBuffer& payload) {
+        if (!IsGood(payload)) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return;
+        }
+        RaiseSuccess(m_id);
+        DispatchSink(payload);
+    }
+
     /// @brief Invoke the delegate function on the destination receiver. Called by the 
     /// remote destination. The sender serializes all target function arguments. This
     /// function unserializes the argument data and invokes the remote target function.
@@ -1326,67 +1617,46 @@ public:
             return false;
         }
 
-        // Invoke the delegate function synchronously
-        m_sync = true;
+        return DeserializeAndInvoke(is);
+    }
 
-#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
-        if constexpr (ArgCnt::value == 0) {
-            BaseType::operator()();
+    /// @brief Invoke the delegate function on the destination receiver using argument
+    /// data held in a byte buffer. Reads from the buffer read position.
+    /// @param[in] buffer The delegate argument data created and sent within 
+    /// `operator()(Args... args)`.
+    /// @return `true` if target function invoked; `false` if error. 
+    virtual bool InvokeBuffer(ByteBuffer& buffer) override {
+        if (!m_serializer) {
+            RaiseError(m_id, DelegateError::ERR_NO_SERIALIZER);
+            return false;
         }
-        else {
-            // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
-            std::tuple<RemoteArg<Args>...> remoteArgs;
-
-            // 2. Use std::apply to unpack the tuple elements
-            std::apply([this, &is](auto&... rArgs) {
-
-                // 3. Deserialize: Expand the pack to call Read(is, arg1, arg2...)
-                // rArgs.Get() returns the reference/pointer to the internal storage
-                m_serializer->Read(is, rArgs.Get()...);
-
-                if (!is.bad() && !is.fail()) {
-                    // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
-                    this->operator()(rArgs.Get()...);
-                }
-                else {
-                    this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
-                }
 
-                }, remoteArgs);
+        if (!buffer.Good()) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return false;
         }
-#else
-        try {
-            if constexpr (ArgCnt::value == 0) {
-                BaseType::operator()();
-            }
-            else {
-                // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
-                std::tuple<RemoteArg<Args>...> remoteArgs;
-
-                // 2. Use std::apply to unpack the tuple elements
-                std::apply([this, &is](auto&... rArgs) {
 
-                    // 3. Deserialize: Expand the pack to call Read(is, arg1, arg2...)
-                    // rArgs.Get() returns the reference/pointer to the internal storage
-                    m_serializer->Read(is, rArgs.Get()...);
-
-                    if (!is.bad() && !is.fail()) {
-                        // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
-                        this->operator()(rArgs.Get()...);
-                    }
-                    else {
-                        this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
-                    }
+        return DeserializeAndInvoke(buffer);
+    }
 
-                    }, remoteArgs);
-            }
+    /// @brief Invoke the delegate function on the destination receiver using argument
+    /// data viewed in place (e.g. a transport receive buffer). Reads from the span
+    /// read position without copying the bytes.
+    /// @param[in] span The delegate argument data created and sent within 
+    /// `operator()(Args... args)`.
+    /// @return `true` if target function invoked; `false` if error. 
+    virtual bool InvokeSpan(ByteSpan& span) override {
+        if (!m_serializer) {
+            RaiseError(m_id, DelegateError::ERR_NO_SERIALIZER);
+            return false;
         }
-        catch (std::exception&) {
-            RaiseError(m_id, DelegateError::ERR_DESERIALIZE_EXCEPTION);
+
+        if (!span.Good()) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+            return false;
         }
-#endif
 
-        return true;
+        return DeserializeAndInvoke(span);
     }
 
     ///@brief Get the remote identifier.
@@ -1417,6 +1687,31 @@ public:
         m_stream = stream;
     }
 
+    /// @brief Set the byte buffer used to store serialized function argument
+    /// data. When set, the buffer is used instead of the stream.
+    /// @param[in] buffer A reusable byte buffer.
+    void SetBuffer(ByteBuffer* buffer) {
+        m_buffer = buffer;
+    }
+
+    /// @brief Keep the receive-side argument objects between `Invoke()` calls and
+    /// deserialize each message into them in place. Container arguments (e.g.
+    /// `std::vector`, `std::string`) then keep their capacity, so a steady message
+    /// rate performs no per-message argument allocations. Off by default.
+    /// @details Arguments passed by value are still copied into the target function;
+    /// use reference arguments (e.g. `void(std::vector<float>&)`) to avoid the copy.
+    /// The target must not keep a reference or pointer to an argument after it
+    /// returns. The serializer must overwrite each argument completely; a field it
+    /// skips keeps the value from the previous message. A re-entrant `Invoke()`, or
+    /// one concurrent with another thread's, deserializes into temporary arguments.
+    /// Call before messages are received.
+    /// @param[in] reuse `true` to reuse the argument storage.
+    void SetReuseArgs(bool reuse) {
+        m_reuseArgs = reuse;
+        if (!reuse)
+            m_args.reset();
+    }
+
     /// @brief Set the error handler
     /// @param[in] errorHandler The delegate error handler called when 
     /// an error is detected.
@@ -1446,6 +1741,141 @@ public:
     }
 
 private:
+    static bool IsGood(const std::ios& s) noexcept { return !s.bad() && !s.fail(); }
+    static bool IsGood(const ByteBuffer& b) noexcept { return b.Good(); }
+    static bool IsGood(const ByteSpan& b) noexcept { return b.Good(); }
+
+    /// Route a stream, byte buffer or span to the matching serializer/dispatcher call.
+    void WriteArgs(std::ostream& os, const Args&... args) { m_serializer->Write(os, args...); }
+    void WriteArgs(ByteBuffer& buffer, const Args&... args) { m_serializer->WriteBuffer(buffer, args...); }
+    void ReadArgs(std::istream& is, Args&... args) { m_serializer->Read(is, args...); }
+    void ReadArgs(ByteBuffer& buffer, Args&... args) { m_serializer->ReadBuffer(buffer, args...); }
+    void ReadArgs(ByteSpan& span, Args&... args) { m_serializer->ReadSpan(span, args...); }
+    int DispatchArgs(std::ostream& os) { return m_dispatcher->Dispatch(os, m_id); }
+    int DispatchArgs(const ByteBuffer& buffer) { return m_dispatcher->DispatchBuffer(buffer, m_id); }
+
+    /// Serialize the arguments into `sink` (a stream or byte buffer) and dispatch.
+    template <class Sink>
+    void SerializeAndDispatch(Sink& sink, const Args&... args) {
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+        // Serialize all target function arguments
+        WriteArgs(sink, args...);
+        RaiseSuccess(m_id);
+#else
+        try {
+            // Serialize all target function arguments
+            WriteArgs(sink, args...);
+            RaiseSuccess(m_id);
+        }
+        catch (std::exception&) {
+            RaiseError(m_id, DelegateError::ERR_SERIALIZE);
+        }
+#endif
+
+        if (!IsGood(sink)) {
+            RaiseError(m_id, DelegateError::ERR_STREAM_NOT_GOOD);
+        }
+        else {
+            DispatchSink(sink);
+        }
+    }
+
+    /// Dispatch serialized argument data in `sink` to the remote destination.
+    template <class Sink>
+    void DispatchSink(Sink& sink) {
+        if (m_dispatcher) {
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+            int error = DispatchArgs(sink);
+            if (error)
+                RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
+#else
+            try {
+                int error = DispatchArgs(sink);
+                if (error)
+                    RaiseError(m_id, DelegateError::ERR_DISPATCH, error);
+            }
+            catch (std::exception&) {
+                RaiseError(m_id, DelegateError::ERR_DISPATCH);
+            }
+#endif
+        }
+        else {
+            RaiseError(m_id, DelegateError::ERR_NO_DISPATCHER);
+        }
+    }
+
+    /// Deserialize the arguments from `source` (a stream, byte buffer or span) and invoke
+    /// the target function synchronously.
+    template <class Source>
+    bool DeserializeAndInvoke(Source& source) {
+        // Invoke the delegate function synchronously
+        m_sync = true;
+
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+        if constexpr (ArgCnt::value == 0) {
+            BaseType::operator()();
+        }
+        else {
+            ReadAndInvoke(source);
+        }
+#else
+        try {
+            if constexpr (ArgCnt::value == 0) {
+                BaseType::operator()();
+            }
+            else {
+                ReadAndInvoke(source);
+            }
+        }
+        catch (std::exception&) {
+            RaiseError(m_id, DelegateError::ERR_DESERIALIZE_EXCEPTION);
+        }
+#endif
+
+        return true;
+    }
+
+    /// Select the argument storage: the reused storage if enabled and not held by an
+    /// outer or concurrent `Invoke()`, otherwise temporary storage.
+    template <class Source>
+    void ReadAndInvoke(Source& source) {
+        if (m_reuseArgs && !m_argsInUse.exchange(true, std::memory_order_acquire)) {
+            RemoteArgsGuard guard(m_argsInUse);
+            if (!m_args)
+                m_args.reset(new(std::nothrow) ArgStorage());
+            if (m_args) {
+                ReadAndInvoke(source, *m_args);
+                return;
+            }
+        }
+
+        // 1. Create a tuple of RemoteArg<T> to hold the temporary storage
+        ArgStorage remoteArgs;
+        ReadAndInvoke(source, remoteArgs);
+    }
+
+    /// Deserialize into `remoteArgs` and invoke the target function.
+    template <class Source>
+    void ReadAndInvoke(Source& source, ArgStorage& remoteArgs) {
+        // 2. Use std::apply to unpack the tuple elements
+        std::apply([this, &source](auto&... rArgs) {
+            (rArgs.Reuse(), ...);
+
+            // 3. Deserialize: Expand the pack to call ReadArgs(source, arg1, arg2...)
+            // rArgs.Get() returns the reference/pointer to the internal storage
+            this->ReadArgs(source, rArgs.Get()...);
+
+            if (IsGood(source)) {
+                // 4. Invoke: Expand the pack to call operator()(arg1, arg2...)
+                this->operator()(rArgs.Get()...);
+            }
+            else {
+                this->RaiseError(m_id, DelegateError::ERR_DESERIALIZE);
+            }
+
+            }, remoteArgs);
+    }
+
     /// Raise an error and callback registered error handler
     /// @param[in] id Remote delegate ID.
     /// @param[in] error Error code.
@@ -1484,8 +1914,9 @@ private:
     /// A pointer to the function argument serializer
     ISerializer<RetType(Args...)>* m_serializer = nullptr;
 
-    /// Flag to control synchronous vs asynchronous target invoke behavior.
-    bool m_sync = false;
+    /// Flag to control synchronous vs asynchronous target invoke behavior. Set by
+    /// each receive-side `Invoke()`, which may run on several threads.
+    std::atomic<bool> m_sync{ false };
 
     /// The error detected
     DelegateError m_error = DelegateError::SUCCESS;
@@ -1493,6 +1924,20 @@ private:
     /// Stream to store serialize remote argument function data
     std::ostream* m_stream = nullptr;
 
+    /// Byte buffer to store serialize remote argument function data. Used
+    /// instead of m_stream when set.
+    ByteBuffer* m_buffer = nullptr;
+
+    /// Receive-side argument storage kept between invokes. See SetReuseArgs().
+    std::unique_ptr<ArgStorage> m_args;
+
+    /// Reuse m_args for each received message.
+    bool m_reuseArgs = false;
+
+    /// Set while m_args is being read or passed to the target function. Atomic so
+    /// concurrent `Invoke()` calls on one delegate fall back to temporary storage.
+    std::atomic<bool> m_argsInUse{ false };
+
     // </common_code>
 };
 
@@ -4,6 +4,7 @@
 /// @file
 /// @brief Delegate dispatcher interface class. 
 
+#include "ByteBuffer.h"
 #include <cstdint>
 
 namespace dmq {
@@ -12,6 +13,10 @@ namespace dmq {
 typedef uint16_t DelegateRemoteId;
 const uint16_t INVALID_REMOTE_ID = static_cast<uint16_t>(-1);
 const uint16_t ACK_REMOTE_ID = 0;
+// Reserved for frames packing several messages (see BatchDispatcher)
+const uint16_t BATCH_REMOTE_ID = static_cast<uint16_t>(-2);
+// Reserved for fragments of a large message (see FragmentTransport)
+const uint16_t FRAGMENT_REMOTE_ID = static_cast<uint16_t>(-3);
 
 /// @TODO Implement the IDispatcher interface if necessary.
 /// @brief Delegate interface class to dispatch serialized function argument data
@@ -34,6 +39,17 @@ public:
     /// @param[in] os An outgoing stream to send to the remote destination.
     /// @param[in] id The unique delegate identifier shared between sender and receiver.
     virtual int Dispatch(std::ostream& os, DelegateRemoteId id) = 0;
+
+    /// Dispatch the contents of a byte buffer to a remote system. Implementers
+    /// override this to send the buffer bytes in place. The default implementation
+    /// copies the buffer into a stream and calls `Dispatch(std::ostream&, ...)`.
+    /// @param[in] buffer The serialized argument data to send.
+    /// @param[in] id The unique delegate identifier shared between sender and receiver.
+    virtual int DispatchBuffer(const ByteBuffer& buffer, DelegateRemoteId id) {
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os.write(reinterpret_cast<const char*>(buffer.Data()), static_cast<std::streamsize>(buffer.Size()));
+        return Dispatch(os, id);
+    }
 };
 
 }
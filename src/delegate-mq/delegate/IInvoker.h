@@ -4,6 +4,7 @@
 /// @file
 /// @brief Delegate inter-thread invoker base class. 
 
+#include "ByteBuffer.h"
 #include <memory>
 
 namespace dmq {
@@ -36,6 +37,25 @@ public:
     /// @param[in] is The incoming remote message stream. 
     /// @return `true` if function was invoked; `false` if failed. 
     virtual bool Invoke(std::istream& is) = 0;
+
+    /// Called to invoke the bound target function using argument data held in a
+    /// byte buffer. The default implementation adapts the buffer to a stream.
+    /// @param[in] buffer The incoming remote argument data.
+    /// @return `true` if function was invoked; `false` if failed.
+    virtual bool InvokeBuffer(ByteBuffer& buffer) {
+        ByteBufferIStream is(buffer);
+        return Invoke(is);
+    }
+
+    /// Called to invoke the bound target function using argument data viewed in
+    /// place, e.g. in a transport receive buffer. The default implementation
+    /// adapts the span to a non-copying stream.
+    /// @param[in] span The incoming remote argument data.
+    /// @return `true` if function was invoked; `false` if failed.
+    virtual bool InvokeSpan(ByteSpan& span) {
+        ByteSpanIStream is(span);
+        return Invoke(is);
+    }
 };
 
 }
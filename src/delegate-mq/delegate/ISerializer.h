@@ -6,6 +6,7 @@
 /// @see https://github.com/DelegateMQ/DelegateMQ
 /// David Lafreniere, 2025.
 
+#include "ByteBuffer.h"
 #include <iostream>
 
 namespace dmq {
@@ -51,6 +52,58 @@ namespace dmq {
         /// @param[out] args References to the arguments where the data should be stored.
         /// @return Reference to the input stream.
         virtual std::istream& Read(std::istream& is, Args&... args) = 0;
+
+        /// @brief Serializes function arguments into a byte buffer.
+        ///
+        /// @details
+        /// Called by the `DelegateRemote` when a `ByteBuffer` is set. The buffer is cleared
+        /// and then filled with the arguments. Serializers that write directly to contiguous
+        /// memory override this to avoid the stream layer. The default implementation adapts
+        /// the buffer to a stream and calls `Write(std::ostream&, ...)`.
+        ///
+        /// @param[out] buffer The buffer to write data to. On failure `buffer.Good()` is `false`.
+        /// @param[in] args The actual arguments passed to the delegate invocation.
+        /// @return Reference to the buffer.
+        virtual ByteBuffer& WriteBuffer(ByteBuffer& buffer, const Args&... args) {
+            buffer.Clear();
+            ByteBufferOStream os(buffer);
+            Write(os, args...);
+            return buffer;
+        }
+
+        /// @brief Deserializes function arguments from a byte buffer.
+        ///
+        /// @details
+        /// Reads from the buffer read position. The default implementation adapts the buffer
+        /// to a stream and calls `Read(std::istream&, ...)`.
+        ///
+        /// @param[in] buffer The buffer containing received data. On failure `buffer.Good()`
+        /// is `false`.
+        /// @param[out] args References to the arguments where the data should be stored.
+        /// @return Reference to the buffer.
+        virtual ByteBuffer& ReadBuffer(ByteBuffer& buffer, Args&... args) {
+            ByteBufferIStream is(buffer);
+            Read(is, args...);
+            return buffer;
+        }
+
+        /// @brief Deserializes function arguments from a read-only byte span.
+        ///
+        /// @details
+        /// Called when a transport hands over received bytes in place (see
+        /// `ITransport::ReceiveView()`). Reads from the span read position. The default
+        /// implementation adapts the span to a non-copying stream and calls
+        /// `Read(std::istream&, ...)`; serializers that parse contiguous memory override
+        /// this to read the bytes directly.
+        ///
+        /// @param[in] span The received data. On failure `span.Good()` is `false`.
+        /// @param[out] args References to the arguments where the data should be stored.
+        /// @return Reference to the span.
+        virtual ByteSpan& ReadSpan(ByteSpan& span, Args&... args) {
+            ByteSpanIStream is(span);
+            Read(is, args...);
+            return span;
+        }
     };
 }
 
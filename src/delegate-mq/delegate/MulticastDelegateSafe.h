@@ -4,8 +4,12 @@
 /// @file
 /// @brief Delegate container for storing and iterating over a collection of 
 /// delegate instances. Class is thread-safe.
+///
+/// @details Modifications are serialized by a mutex and publish an immutable copy of
+/// the delegate list. Invocation iterates the published copy without locking.
 
 #include "MulticastDelegate.h"
+#include "SlotArray.h"
 
 namespace dmq {
 
@@ -26,11 +30,14 @@ public:
     MulticastDelegateSafe(const MulticastDelegateSafe& rhs) : BaseType() {
         dmq::ScopedLock<RecursiveMutex, RecursiveMutex> lock(m_lock, rhs.m_lock);
         BaseType::operator=(rhs);
+        Publish();
     }
 
     MulticastDelegateSafe(MulticastDelegateSafe&& rhs) : BaseType() {
         dmq::ScopedLock<RecursiveMutex, RecursiveMutex> lock(m_lock, rhs.m_lock);
         BaseType::operator=(std::move(rhs));
+        Publish();
+        rhs.Publish();
     }
 
     /// Constructor to initialize from a single Delegate (Copy)
@@ -47,40 +54,10 @@ public:
     /// A void return value is used since multiple targets invoked.
     /// @param[in] args The arguments used when invoking the target functions
     void operator()(Args... args) {
-        // To prevent deadlocks, the mutex must be released before invoking the 
-        // delegate. Circular lock dependencies can occur if the delegate target 
-        // function itself attempts to acquire a lock that is held by the 
-        // thread invoking the delegate. 
-        // Use a small-buffer optimization to avoid heap allocation in the common case.
-        std::shared_ptr<DelegateType> small_buf[SIGNAL_SBO_COUNT];
-        xlist<std::shared_ptr<DelegateType>> large_buf;
-        size_t count = 0;
-
-        {
-            const dmq::LockGuard<RecursiveMutex> lock(m_lock);
-            count = this->m_delegates.size();
-            if (count <= SIGNAL_SBO_COUNT) {
-                size_t i = 0;
-                for (auto& d : this->m_delegates) {
-                    small_buf[i++] = d;
-                }
-            } else {
-                large_buf = this->m_delegates;
-            }
-        }
-
-        if (count <= SIGNAL_SBO_COUNT) {
-            for (size_t i = 0; i < count; ++i) {
-                if (small_buf[i])
-                    (*small_buf[i])(args...);
-                small_buf[i].reset(); // Clear to release shared_ptr immediately
-            }
-        } else {
-            for (auto& d : large_buf) {
-                if (d)
-                    (*d)(args...);
-            }
-        }
+        // No lock is held while invoking, so a target function may freely modify 
+        // this container or acquire its own locks without deadlock. Iterates the 
+        // published copy in place; no shared_ptr is copied per delegate.
+        m_slots.ForEach([&](DelegateType& delegate) { delegate(args...); });
     }
 
     /// Invoke all bound target functions. A void return value is used 
@@ -95,6 +72,7 @@ public:
     void operator+=(const Delegate<RetType(Args...)>& delegate) {
         const dmq::LockGuard<RecursiveMutex> lock(m_lock);
         BaseType::operator +=(delegate);
+        Publish();
     }
 
     /// Insert a delegate into the container.
@@ -102,6 +80,7 @@ public:
     void operator+=(Delegate<RetType(Args...)>&& delegate) {
         const dmq::LockGuard<RecursiveMutex> lock(m_lock);
         BaseType::operator +=(delegate);
+        Publish();
     }
 
     /// Remove a delegate from the container.
@@ -109,6 +88,7 @@ public:
     void operator-=(const Delegate<RetType(Args...)>& delegate) {
         const dmq::LockGuard<RecursiveMutex> lock(m_lock);
         BaseType::operator -=(delegate);
+        Publish();
     }
 
     /// Remove a delegate from the container.
@@ -116,6 +96,7 @@ public:
     void operator-=(Delegate<RetType(Args...)>&& delegate) {
         const dmq::LockGuard<RecursiveMutex> lock(m_lock);
         BaseType::operator -=(delegate);
+        Publish();
     }
 
     /// @brief Assignment operator that assigns the state of one object to another.
@@ -126,6 +107,7 @@ public:
             // Lock both instances safely to prevent modification of source during copy
             dmq::ScopedLock<RecursiveMutex, RecursiveMutex> lock(m_lock, rhs.m_lock);
             BaseType::operator=(rhs);
+            Publish();
         }
         return *this;
     }
@@ -137,6 +119,8 @@ public:
         if (this != &rhs) {
             dmq::ScopedLock<RecursiveMutex, RecursiveMutex> lock(m_lock, rhs.m_lock);
             BaseType::operator=(std::move(rhs));
+            Publish();
+            rhs.Publish();
         }
         return *this;
     }
@@ -145,6 +129,7 @@ public:
     virtual void operator=(std::nullptr_t) noexcept { 
         const dmq::LockGuard<RecursiveMutex> lock(m_lock);
         BaseType::Clear(); 
+        Publish();
     }
 
     /// Insert a delegate into the container.
@@ -152,6 +137,7 @@ public:
     void PushBack(const DelegateType& delegate) {
         const dmq::LockGuard<RecursiveMutex> lock(m_lock);
         BaseType::PushBack(delegate);
+        Publish();
     }
 
     /// Remove a delegate into the container.
@@ -159,6 +145,7 @@ public:
     void Remove(const DelegateType& delegate) {
         const dmq::LockGuard<RecursiveMutex> lock(m_lock);
         BaseType::Remove(delegate);
+        Publish();
     }
 
     /// Any registered delegates?
@@ -172,6 +159,7 @@ public:
     void Clear() {
        const dmq::LockGuard<RecursiveMutex> lock(m_lock);
        BaseType::Clear();
+       Publish();
     }
 
     /// Get the number of delegates stored.
@@ -189,8 +177,14 @@ public:
     }
 
 private:
+    /// Publish the delegate list for lock-free invocation. Call with `m_lock` held.
+    void Publish() { m_slots.Assign(this->m_delegates); }
+
     /// Lock to make the class thread-safe
     mutable RecursiveMutex m_lock;
+
+    /// Immutable copy of the delegate list read by operator()
+    detail::SlotArray<DelegateType> m_slots;
 };
 
 }
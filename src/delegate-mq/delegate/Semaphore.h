@@ -2,27 +2,42 @@
 #define _DELEGATE_SEMAPHORE_H
 
 /// @file
-/// @brief Delegate library semaphore wrapper class. 
+/// @brief Delegate library semaphore wrapper class.
+///
+/// @details `Semaphore` is a binary semaphore: `Signal()` sets the semaphore (repeated
+/// signals do not accumulate) and `Wait()` consumes it. On Linux stdlib builds it is a
+/// `FutexSemaphore`, otherwise a `CvSemaphore` built on the port mutex and condition
+/// variable.
 
 #include "DelegateOpt.h"
 
 #ifdef DMQ_HAS_CV
 
+#if defined(__linux__) && defined(DMQ_THREAD_STDLIB)
+    #include <atomic>
+    #include <cstdint>
+    #include <ctime>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define DMQ_FUTEX_SEMAPHORE
+#endif
+
 // Fix compiler error on Windows
 #undef max
 
 namespace dmq {
 
-/// @brief A semaphore wrapper class. 
-class Semaphore
+/// @brief A semaphore using the port mutex and condition variable.
+class CvSemaphore
 {
 public:
-	Semaphore() = default;
-	~Semaphore() = default;
+	CvSemaphore() = default;
+	~CvSemaphore() = default;
 
 	/// Called to wait on a semaphore to be signaled.
-	/// @param[in] timeout - semaphore timeout 
-	/// @return Return true if semaphore signaled, false if timeout occurred. 
+	/// @param[in] timeout - semaphore timeout
+	/// @return Return true if semaphore signaled, false if timeout occurred.
 	bool Wait(Duration timeout)
 	{
         dmq::UniqueLock<dmq::Mutex> lk(m_lock);
@@ -61,14 +76,118 @@ public:
 
 private:
 	// Prevent copying objects
-	Semaphore(const Semaphore&) = delete;
-	Semaphore& operator=(const Semaphore&) = delete;
+	CvSemaphore(const CvSemaphore&) = delete;
+	CvSemaphore& operator=(const CvSemaphore&) = delete;
 
 	dmq::ConditionVariable m_sema;
 	dmq::Mutex m_lock;
 	bool m_signaled = false;
 };
 
+#ifdef DMQ_FUTEX_SEMAPHORE
+/// @brief A semaphore built on a single atomic word and the Linux futex syscall.
+/// @details Bit 0 of the word is the signaled flag; the remaining bits count blocked
+/// waiters. `Signal()` is one atomic read-modify-write and only enters the kernel when
+/// it sets the flag while a waiter is blocked. `Wait()` on a signaled semaphore is one
+/// compare-and-swap.
+class FutexSemaphore
+{
+public:
+	FutexSemaphore() = default;
+	~FutexSemaphore() = default;
+
+	/// Called to wait on a semaphore to be signaled.
+	/// @param[in] timeout - semaphore timeout
+	/// @return Return true if semaphore signaled, false if timeout occurred.
+	bool Wait(Duration timeout)
+	{
+        // Fast path: consume an existing signal
+        int32_t state = m_state.load(std::memory_order_relaxed);
+        if (TryConsume(state, 0))
+            return true;
+
+        const bool infinite = (timeout == Duration::max());
+        const auto deadline = infinite ? TimePoint::max() : Clock::now() + timeout;
+
+        // Register as a waiter, then sleep until the signaled flag is set
+        state = m_state.fetch_add(WAITER, std::memory_order_relaxed) + WAITER;
+        for (;;)
+        {
+            if (TryConsume(state, WAITER))
+                return true;
+
+            timespec ts{};
+            timespec* pts = nullptr;
+            if (!infinite)
+            {
+                auto remaining = deadline - Clock::now();
+                if (remaining <= Duration::zero())
+                    break;
+                auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+                ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+                ts.tv_nsec = static_cast<long>(ns % 1000000000);
+                pts = &ts;
+            }
+
+            // Returns immediately if the word changed since it was read
+            syscall(SYS_futex, Word(), FUTEX_WAIT_PRIVATE, state, pts, nullptr, 0);
+            state = m_state.load(std::memory_order_relaxed);
+        }
+
+        // Timeout: unregister, unless a signal arrived in the meantime
+        state = m_state.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (TryConsume(state, WAITER))
+                return true;
+            if (m_state.compare_exchange_weak(state, state - WAITER, std::memory_order_relaxed))
+                return false;
+        }
+	}
+
+	/// Called to signal a semaphore.
+    void Signal()
+    {
+        const int32_t prev = m_state.fetch_or(SIGNALED, std::memory_order_release);
+        if (!(prev & SIGNALED) && prev >= WAITER)
+            syscall(SYS_futex, Word(), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+
+private:
+	// Prevent copying objects
+	FutexSemaphore(const FutexSemaphore&) = delete;
+	FutexSemaphore& operator=(const FutexSemaphore&) = delete;
+
+    static constexpr int32_t SIGNALED = 1;
+    static constexpr int32_t WAITER = 2;
+
+    /// Clear the signaled flag and remove `waiter` from the waiter count if the
+    /// flag is set. On failure `state` holds the current value.
+    bool TryConsume(int32_t& state, int32_t waiter)
+    {
+        while (state & SIGNALED)
+        {
+            if (m_state.compare_exchange_weak(state, (state & ~SIGNALED) - waiter,
+                std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    int32_t* Word() { return reinterpret_cast<int32_t*>(&m_state); }
+
+    static_assert(sizeof(std::atomic<int32_t>) == sizeof(int32_t), "futex word must be 32 bits");
+
+    std::atomic<int32_t> m_state{ 0 };
+};
+
+/// The library semaphore type
+using Semaphore = FutexSemaphore;
+#else
+/// The library semaphore type
+using Semaphore = CvSemaphore;
+#endif
+
 }
 
 #endif // DMQ_HAS_CV
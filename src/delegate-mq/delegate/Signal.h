@@ -17,9 +17,15 @@
 /// with the disconnect lambdas via `shared_ptr`. The destructor marks the block dead under
 /// the mutex, so any concurrent disconnect that races with destruction simply sees the
 /// dead flag and returns without touching the list.
+///
+/// Emit is lock-free. Every Connect/Disconnect/Clear publishes an immutable copy of the
+/// subscriber list (`detail::SlotArray`); `operator()` iterates the current copy in place
+/// without taking the mutex or copying any `shared_ptr`. A replaced copy is freed once no
+/// emit can still be iterating it.
 
 #include "DelegateOpt.h"
 #include "Delegate.h"
+#include "SlotArray.h"
 #include <functional>
 #include <memory>
 
@@ -151,6 +157,7 @@ public:
         dmq::LockGuard<RecursiveMutex> lock(m_state->mtx);
         m_state->alive = false;
         m_state->delegates.clear();
+        m_state->slots.Assign(m_state->delegates);
     }
 
     Signal(const Signal&) = delete;
@@ -171,26 +178,31 @@ public:
         {
             dmq::LockGuard<RecursiveMutex> lock(state->mtx);
             state->delegates.push_back(copy);
+            state->slots.Assign(state->delegates);
         }
         return ScopedConnection(detail::Connection(
             std::weak_ptr<void>(state),
             [state, copy]() {
                 dmq::LockGuard<RecursiveMutex> lock(state->mtx);
-                if (state->alive)
+                if (state->alive) {
                     state->delegates.remove(copy);  // shared_ptr identity comparison
+                    state->slots.Assign(state->delegates);
+                }
             }
         ));
     }
 
     /// @brief Invoke all connected delegates.
+    /// @details Lock-free; no per-subscriber reference counting. Subscribers
+    /// connected or disconnected during the call may or may not be invoked.
     void operator()(Args... args) {
-        auto snapshot = GetSnapshot();
-        InvokeSnapshot(snapshot, std::forward<Args>(args)...);
+        m_state->slots.ForEach([&](DelegateType& delegate) { delegate(args...); });
     }
 
     /// @brief Capture a snapshot of all current subscribers.
     /// @details The snapshot holds shared_ptrs to the delegates, ensuring they
-    /// stay alive even if the Signal is destroyed.
+    /// stay alive even if the Signal is destroyed. Use to invoke the subscribers
+    /// later, outside a lock the caller holds (see `Timer::ProcessTimers()`).
     struct Snapshot {
         std::shared_ptr<DelegateType> small_buf[SIGNAL_SBO_COUNT];
         xlist<std::shared_ptr<DelegateType>> large_buf;
@@ -230,9 +242,10 @@ public:
     }
 
     /// @brief Number of currently connected subscribers.
+    /// @details Lock-free; the count is updated under the lock on every change,
+    /// so it is exact once any concurrent Connect/Disconnect has returned.
     std::size_t Size() const {
-        dmq::LockGuard<RecursiveMutex> lock(m_state->mtx);
-        return m_state->delegates.size();
+        return m_state->slots.Size();
     }
 
     bool Empty() const { return Size() == 0; }
@@ -241,6 +254,7 @@ public:
     void Clear() {
         dmq::LockGuard<RecursiveMutex> lock(m_state->mtx);
         m_state->delegates.clear();
+        m_state->slots.Assign(m_state->delegates);
     }
 
     XALLOCATOR
@@ -250,6 +264,7 @@ private:
         mutable RecursiveMutex mtx;
         bool alive = true;
         xlist<std::shared_ptr<DelegateType>> delegates;
+        detail::SlotArray<DelegateType> slots;   // Published copy of delegates
         XALLOCATOR
     };
     std::shared_ptr<State> m_state = xmake_shared<State>();
@@ -0,0 +1,173 @@
+#ifndef _SLAB_POOL_H
+#define _SLAB_POOL_H
+
+// @see https://github.com/DelegateMQ/DelegateMQ
+// David Lafreniere, 2025.
+
+/// @file
+/// @brief Typed slab pool for fixed-size async delegate messages.
+///
+/// @details Every `DelegateAsyncInvokerMsg<>` and `DelegateAsyncWaitMsg<>` has a size
+/// fixed at compile time by the delegate signature. `SlabPool<T>` keeps one free list
+/// per object type `T`, created lazily on first use, carved from contiguous chunks of
+/// `SLAB_CHUNK_SIZE` blocks. Allocation and deallocation are O(1) and never search a
+/// size class or call the general-purpose heap once a chunk is in place.
+///
+/// `SlabAllocator<T>` adapts the pool for `std::allocate_shared()`. The standard library
+/// rebinds the allocator to its combined control block and object type, so each message
+/// type gets a dedicated slab holding both. Because the pool is a per-type singleton, the
+/// last `std::shared_ptr` owner may release the message on any thread and the block is
+/// returned to the slab it came from.
+///
+/// Slab memory is never returned to the system. The pool grows one chunk at a time to
+/// the peak number of messages simultaneously in flight for that type.
+///
+/// Enabled by defining `DMQ_SLAB_POOL`. Otherwise `make_slab_shared()` falls back to
+/// `xmake_shared()`.
+
+#include "DelegateOpt.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace dmq
+{
+
+/// @brief A thread-safe pool of fixed-size blocks, each large enough to hold a `T`.
+/// @tparam T The object type stored in each block.
+template <class T>
+class SlabPool
+{
+public:
+    /// Get the pool for type `T`. Created on first use.
+    /// @details The pool is intentionally never destroyed so messages released by
+    /// threads still running during static destruction return to a valid pool.
+    static SlabPool& Instance() {
+        static SlabPool* pool = new SlabPool();
+        return *pool;
+    }
+
+    /// Get a block from the free list, adding a new chunk if empty.
+    /// @return Uninitialized storage for one `T`, or `nullptr` if out of memory.
+    void* Allocate() {
+        LockGuard<Mutex> lock(m_lock);
+        if (!m_free && !AddChunk())
+            return nullptr;
+        Block* block = m_free;
+        m_free = block->next;
+        m_blocksInUse++;
+        m_allocations++;
+        return block;
+    }
+
+    /// Return a block to the free list. Safe to call from any thread.
+    /// @param[in] p A block previously returned by `Allocate()`.
+    void Deallocate(void* p) {
+        if (!p)
+            return;
+        LockGuard<Mutex> lock(m_lock);
+        Block* block = static_cast<Block*>(p);
+        block->next = m_free;
+        m_free = block;
+        m_blocksInUse--;
+        m_deallocations++;
+    }
+
+    /// Get the total number of blocks carved from chunks
+    size_t GetBlockCount() { LockGuard<Mutex> lock(m_lock); return m_blockCount; }
+
+    /// Get the number of blocks currently allocated
+    size_t GetBlocksInUse() { LockGuard<Mutex> lock(m_lock); return m_blocksInUse; }
+
+    /// Get the total number of allocations
+    size_t GetAllocations() { LockGuard<Mutex> lock(m_lock); return m_allocations; }
+
+    /// Get the total number of deallocations
+    size_t GetDeallocations() { LockGuard<Mutex> lock(m_lock); return m_deallocations; }
+
+    /// Get the size of each block in bytes
+    static constexpr size_t GetBlockSize() { return sizeof(Block); }
+
+private:
+    union Block {
+        Block* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    SlabPool() = default;
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    /// Allocate a chunk and thread its blocks onto the free list.
+    /// @pre m_lock is held.
+    bool AddChunk() {
+        Block* chunk = static_cast<Block*>(
+            ::operator new(sizeof(Block) * SLAB_CHUNK_SIZE, std::align_val_t(alignof(Block)), std::nothrow));
+        if (!chunk)
+            return false;
+        for (size_t i = 0; i < SLAB_CHUNK_SIZE; i++)
+            chunk[i].next = (i + 1 < SLAB_CHUNK_SIZE) ? &chunk[i + 1] : m_free;
+        m_free = chunk;
+        m_blockCount += SLAB_CHUNK_SIZE;
+        return true;
+    }
+
+    Mutex m_lock;
+    Block* m_free = nullptr;
+    size_t m_blockCount = 0;
+    size_t m_blocksInUse = 0;
+    size_t m_allocations = 0;
+    size_t m_deallocations = 0;
+};
+
+/// @brief Standard allocator that draws single objects from `SlabPool<T>`.
+/// @details Array requests (n != 1) fall through to the global heap.
+template <class T>
+class SlabAllocator
+{
+public:
+    using value_type = T;
+
+    SlabAllocator() noexcept = default;
+
+    template <class U>
+    SlabAllocator(const SlabAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        void* p = (n == 1) ? SlabPool<T>::Instance().Allocate() :
+            ::operator new(n * sizeof(T), std::align_val_t(alignof(T)), std::nothrow);
+        if (!p)
+            BAD_ALLOC();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (n == 1)
+            SlabPool<T>::Instance().Deallocate(p);
+        else
+            ::operator delete(p, std::align_val_t(alignof(T)));
+    }
+
+    template <class U>
+    bool operator==(const SlabAllocator<U>&) const noexcept { return true; }
+
+    template <class U>
+    bool operator!=(const SlabAllocator<U>&) const noexcept { return false; }
+};
+
+/// @brief Create a `std::shared_ptr<T>` with the object and control block stored
+/// within the `T` slab when `DMQ_SLAB_POOL` is defined.
+template <class T, class... Args>
+inline std::shared_ptr<T> make_slab_shared(Args&&... args)
+{
+#ifdef DMQ_SLAB_POOL
+    return std::allocate_shared<T>(SlabAllocator<T>(), std::forward<Args>(args)...);
+#else
+    return xmake_shared<T>(std::forward<Args>(args)...);
+#endif
+}
+
+} // namespace dmq
+
+#endif // _SLAB_POOL_H
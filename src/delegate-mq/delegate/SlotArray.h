@@ -0,0 +1,267 @@
+#ifndef _SLOT_ARRAY_H
+#define _SLOT_ARRAY_H
+
+/// @file
+/// @brief Copy-on-write slot array with epoch-based reclamation. Used by `Signal` and
+/// `MulticastDelegateSafe` for a lock-free invoke path.
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @details Writers (connect, disconnect, clear) build a new immutable array of slot
+/// pointers and atomically swap it in. Readers load the current array pointer and iterate
+/// it in place: no mutex and no per-slot `shared_ptr` copy. A replaced array is retired
+/// and freed only once every reader that could still be iterating it has finished.
+///
+/// Reclamation uses two reader counters selected by the parity of a global epoch. A
+/// reader registers on the counter for the current epoch. The epoch advances only when
+/// the counter for the previous epoch is zero, so an array retired at epoch `E` is
+/// unreachable once the epoch reaches `E + 2`. Retired arrays are collected by the next
+/// writer, or by the last reader to leave if garbage is pending.
+///
+/// The owner may be destroyed by a slot while a read is in progress (e.g. an object that
+/// deletes itself from its own callback). The shared state then stays alive until the
+/// last in-flight reader leaves. Destroying the owner while another thread is invoking it
+/// is a data race on the owner itself, as with any object.
+
+#include "DelegateOpt.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dmq {
+namespace detail {
+
+/// @brief Immutable, atomically replaced array of `shared_ptr<T>` slots.
+/// @details `Assign()` must be serialized by the owner (it is called with the owner's
+/// lock held). `ForEach()` and `Size()` are lock-free and may be called concurrently
+/// with `Assign()` from any thread.
+template <class T>
+class SlotArray
+{
+public:
+    using SlotPtr = std::shared_ptr<T>;
+
+    SlotArray() : m_core(xmake_shared<Core>()) {
+        if (!m_core)
+            BAD_ALLOC();
+    }
+
+    ~SlotArray() { Core::Shutdown(m_core); }
+
+    SlotArray(const SlotArray&) = delete;
+    SlotArray& operator=(const SlotArray&) = delete;
+
+    /// Publish a copy of `slots` as the new slot array. Null entries are skipped.
+    /// @param[in] slots Any range of `shared_ptr<T>`.
+    template <class Range>
+    void Assign(const Range& slots) {
+        Array* array = nullptr;
+        size_t count = 0;
+        for (auto& slot : slots) {
+            if (slot)
+                count++;
+        }
+        if (count > 0) {
+            array = new(std::nothrow) Array();
+            if (!array)
+                BAD_ALLOC();
+            array->slots.reserve(count);
+            for (auto& slot : slots) {
+                if (slot)
+                    array->slots.push_back(slot);
+            }
+        }
+        m_core->Publish(array, count);
+    }
+
+    /// Invoke `func(T&)` for every slot in the current array. Lock-free.
+    /// @details Slots removed during iteration are still visited by this call, the
+    /// same semantics as iterating a copied snapshot.
+    template <class Func>
+    void ForEach(Func&& func) const {
+        Core* core = m_core.get();
+        const unsigned idx = core->Enter();
+        const Array* array = core->current.load(std::memory_order_seq_cst);
+        if (array) {
+            for (const SlotPtr& slot : array->slots)
+                func(*slot);
+        }
+        // Note: a slot may have destroyed the owner, so only `core` is touched here
+        Core::Exit(core, idx);
+    }
+
+    /// @return Number of slots in the current array. Lock-free.
+    size_t Size() const { return m_core->size.load(std::memory_order_relaxed); }
+
+    XALLOCATOR
+
+private:
+#ifdef DMQ_ALLOCATOR
+    using Storage = std::vector<SlotPtr, stl_allocator<SlotPtr>>;
+#else
+    using Storage = std::vector<SlotPtr>;
+#endif
+
+    struct Array {
+        Storage slots;
+        uint32_t epoch = 0;         // Epoch at retirement
+        Array* next = nullptr;      // Retired list link
+        XALLOCATOR
+    };
+
+    struct Core {
+        // Reader counters: bits 0-30 epoch parity 0, bits 32-62 parity 1, bit 63 dead.
+        // 31 bits per parity, so concurrent and nested readers cannot overflow into
+        // the other counter.
+        static constexpr uint64_t COUNT_MASK = 0x7FFFFFFFu;
+        static constexpr uint64_t DEAD = 0x8000000000000000ull;
+
+        std::atomic<const Array*> current{ nullptr };
+        std::atomic<uint32_t> epoch{ 0 };
+        std::atomic<uint64_t> readers{ 0 };
+        std::atomic<bool> pending{ false };
+        std::atomic<size_t> size{ 0 };
+
+        dmq::Mutex mtx;                     // Guards retired and self
+        Array* retired = nullptr;
+        std::shared_ptr<Core> self;         // Pins the core after shutdown with readers active
+
+        ~Core() {
+            FreeList(retired);
+            delete current.load();
+        }
+
+        static uint64_t ReaderBit(unsigned idx) { return uint64_t(1) << (idx * 32); }
+        static uint64_t ReaderCount(uint64_t value, unsigned idx) {
+            return (value >> (idx * 32)) & COUNT_MASK;
+        }
+
+        /// Register a reader on the current epoch.
+        /// @return The counter index to pass to `Exit()`.
+        unsigned Enter() {
+            for (;;) {
+                const uint32_t e = epoch.load(std::memory_order_seq_cst);
+                const unsigned idx = e & 1u;
+                readers.fetch_add(ReaderBit(idx), std::memory_order_seq_cst);
+                if (epoch.load(std::memory_order_seq_cst) == e)
+                    return idx;
+                readers.fetch_sub(ReaderBit(idx), std::memory_order_seq_cst);
+            }
+        }
+
+        static void Exit(Core* core, unsigned idx) {
+            const uint64_t bit = ReaderBit(idx);
+            const uint64_t prev = core->readers.fetch_sub(bit, std::memory_order_seq_cst);
+            if (prev - bit == DEAD) {
+                // Last reader after the owner was destroyed; releases the core
+                std::shared_ptr<Core> release;
+                {
+                    dmq::LockGuard<dmq::Mutex> lock(core->mtx);
+                    release = std::move(core->self);
+                }
+                return;
+            }
+            if (core->pending.load(std::memory_order_seq_cst))
+                core->TryCollect();
+        }
+
+        void Publish(Array* array, size_t count) {
+            Array* garbage = nullptr;
+            {
+                dmq::LockGuard<dmq::Mutex> lock(mtx);
+                const Array* old = current.exchange(array, std::memory_order_seq_cst);
+                size.store(count, std::memory_order_relaxed);
+                Retire(const_cast<Array*>(old));
+                garbage = Collect();
+            }
+            FreeList(garbage);
+        }
+
+        static void Shutdown(std::shared_ptr<Core>& core) {
+            if (!core)
+                return;
+            Array* garbage = nullptr;
+            {
+                dmq::LockGuard<dmq::Mutex> lock(core->mtx);
+                const Array* old = core->current.exchange(nullptr, std::memory_order_seq_cst);
+                core->size.store(0, std::memory_order_relaxed);
+                core->Retire(const_cast<Array*>(old));
+                garbage = core->Collect();
+                const uint64_t prev = core->readers.fetch_or(DEAD, std::memory_order_seq_cst);
+                if ((prev & ~DEAD) != 0)
+                    core->self = core;  // A slot destroyed the owner mid-invoke
+            }
+            FreeList(garbage);
+            core.reset();
+        }
+
+        /// Collect from a reader without blocking. Skipped if a writer holds the lock;
+        /// that writer collects instead.
+        void TryCollect() {
+            Array* garbage = nullptr;
+            if (!mtx.try_lock())
+                return;
+            garbage = Collect();
+            mtx.unlock();
+            FreeList(garbage);
+        }
+
+        void Retire(Array* array) {
+            if (!array)
+                return;
+            array->epoch = epoch.load(std::memory_order_seq_cst);
+            array->next = retired;
+            retired = array;
+            pending.store(true, std::memory_order_seq_cst);
+        }
+
+        /// Advance the epoch where possible and unlink retired arrays no reader can see.
+        /// Called with `mtx` held.
+        /// @return The unlinked arrays, to be freed after unlocking.
+        Array* Collect() {
+            if (!retired)
+                return nullptr;
+
+            for (int i = 0; i < 2; i++) {
+                const uint32_t e = epoch.load(std::memory_order_seq_cst);
+                if (ReaderCount(readers.load(std::memory_order_seq_cst), (e + 1) & 1u) != 0)
+                    break;
+                epoch.store(e + 1, std::memory_order_seq_cst);
+            }
+
+            const uint32_t e = epoch.load(std::memory_order_seq_cst);
+            Array* garbage = nullptr;
+            Array** pp = &retired;
+            while (*pp) {
+                Array* array = *pp;
+                if (e - array->epoch >= 2) {
+                    *pp = array->next;
+                    array->next = garbage;
+                    garbage = array;
+                } else {
+                    pp = &array->next;
+                }
+            }
+            pending.store(retired != nullptr, std::memory_order_seq_cst);
+            return garbage;
+        }
+
+        static void FreeList(Array* list) {
+            while (list) {
+                Array* next = list->next;
+                delete list;
+                list = next;
+            }
+        }
+
+        XALLOCATOR
+    };
+
+    std::shared_ptr<Core> m_core;
+};
+
+} // namespace detail
+} // namespace dmq
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef _ASYNC_ARG_H
+#define _ASYNC_ARG_H
+
+// @see https://github.com/DelegateMQ/DelegateMQ
+// David Lafreniere, 2025.
+
+/// @file
+/// @brief Inline storage for asynchronous function arguments.
+///
+/// @details `async_arg<Arg>` holds a copy of one target function argument inside the
+/// delegate message itself, so a non-blocking async call does not allocate per argument.
+/// It supports the same argument styles as `make_tuple_heap()`: by value, reference,
+/// pointer and pointer-to-pointer.
+///
+/// Each `async_arg` is constructed from the source thread argument, then `Bind()` returns
+/// the value placed within the message `std::tuple<Args...>`. Value arguments are moved
+/// directly into the tuple. Reference and pointer arguments are deep copied into the
+/// `async_arg` and the tuple element refers to that copy. The copy lives as long as the
+/// owning message, so the storage must not be moved or copied once bound. See
+/// `DelegateAsyncMsg` within `DelegateAsync.h`.
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dmq
+{
+
+/// @brief Storage for a by-value argument. The value itself lives in the tuple.
+template <typename Arg>
+class async_arg
+{
+public:
+    static_assert(!std::is_rvalue_reference_v<Arg>, "rvalue reference argument not allowed");
+
+    explicit async_arg(const Arg&) noexcept {}
+    Arg&& Bind(Arg& arg) noexcept { return std::move(arg); }
+};
+
+/// @brief Storage for a reference argument
+template <typename T>
+class async_arg<T&>
+{
+public:
+    explicit async_arg(T& arg) : m_value(arg) {}
+    T& Bind(T&) noexcept { return m_value; }
+
+private:
+    std::remove_const_t<T> m_value;
+};
+
+/// @brief Storage for a pointer argument. A nullptr argument is passed as nullptr.
+template <typename T>
+class async_arg<T*>
+{
+public:
+    static_assert(!std::is_void_v<T>, "void* argument not allowed");
+
+    explicit async_arg(T* arg) {
+        if (arg != nullptr)
+            m_value.emplace(*arg);
+    }
+    T* Bind(T*) noexcept { return m_value ? &*m_value : nullptr; }
+
+private:
+    std::optional<std::remove_const_t<T>> m_value;
+};
+
+/// @brief Storage for a pointer to pointer argument. The target always receives a
+/// valid outer pointer; the inner pointer is nullptr if the source argument was null.
+template <typename T>
+class async_arg<T**>
+{
+public:
+    explicit async_arg(T** arg) {
+        if (arg != nullptr && *arg != nullptr) {
+            m_value.emplace(**arg);
+            m_ptr = &*m_value;
+        }
+    }
+    T** Bind(T**) noexcept { return &m_ptr; }
+
+private:
+    std::optional<std::remove_const_t<T>> m_value;
+    T* m_ptr = nullptr;
+};
+
+}
+
+#endif
@@ -14,8 +14,8 @@
 /// pointer, pointer-to-pointer, and reference.
 /// 
 /// The destination thread uses `std::apply()` to invoke the target function using
-/// the tuple of arguments. See `Invoke()` and `DelegateAsyncMsg()` in the
-/// file `DelegateAsync.h` for example usage.
+/// the tuple of arguments. The async delegates store arguments inline within the 
+/// message instead; see `async_arg.h`. `make_tuple_heap()` remains for custom messages.
 
 #include <tuple>
 #include <list>
@@ -13,6 +13,8 @@ Allocator::Allocator(size_t size, uint32_t objects, char* memory, const char* na
     m_poolIndex(0),
     m_blockCnt(0),
     m_blocksInUse(0),
+    m_blocksInUseMax(0),
+    m_exhaustedCount(0),
     m_allocations(0),
     m_deallocations(0),
     m_name(name)
@@ -74,6 +76,8 @@ void* Allocator::Allocate(size_t size)
             }
             else
             {
+                m_exhaustedCount++;
+
                 // Get the pointer to the new handler
                 std::new_handler handler = std::set_new_handler(0);
                 std::set_new_handler(handler);
@@ -93,6 +97,8 @@ void* Allocator::Allocate(size_t size)
     }
 
     m_blocksInUse++;
+    if (m_blocksInUse > m_blocksInUseMax)
+        m_blocksInUseMax = m_blocksInUse;
     m_allocations++;
 	
     return pBlock;
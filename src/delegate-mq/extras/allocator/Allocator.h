@@ -47,6 +47,18 @@ public:
     /// @return		The number of blocks in use by the application.
     uint32_t GetBlocksInUse() { return m_blocksInUse; }
 
+    /// Gets the high-water mark of blocks in use.
+    /// @return		The maximum number of blocks in use at any one time.
+    uint32_t GetBlocksInUseMax() { return m_blocksInUseMax; }
+
+    /// Gets the maximum number of blocks of a fixed memory pool.
+    /// @return		The pool size in blocks, or 0 if blocks are created off the heap.
+    uint32_t GetMaxBlocks() { return m_maxObjects; }
+
+    /// Gets the number of allocations that failed because the pool was exhausted.
+    /// @return		The number of failed allocations.
+    uint32_t GetExhaustedCount() { return m_exhaustedCount; }
+
     /// Gets the total number of allocations for this allocator instance.
     /// @return		The total number of allocations.
     uint32_t GetAllocations() { return m_allocations; }
@@ -80,6 +92,8 @@ private:
     uint32_t m_poolIndex;
     uint32_t m_blockCnt;
     uint32_t m_blocksInUse;
+    uint32_t m_blocksInUseMax;
+    uint32_t m_exhaustedCount;
     uint32_t m_allocations;
     uint32_t m_deallocations;
     const char* m_name;
@@ -1,6 +1,8 @@
 #include "Allocator.h"
 #include "xallocator.h"
 #include "delegate/DelegateOpt.h"
+#include <atomic>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <mutex>
@@ -53,10 +55,37 @@ static const size_t BLOCK_HEADER_SIZE = sizeof(void*) > 4 ? 16 : 8;
 	static Allocator* _allocators[MAX_ALLOCATORS];
 
 #else
-	#define MAX_ALLOCATORS  15
+	// One allocator per size class, created on first use. The largest block
+	// size is 2^MAX_ALLOCATORS bytes. Larger requests come from malloc().
+	#define MAX_ALLOCATORS  24
 	static Allocator* _allocators[MAX_ALLOCATORS];
 #endif	// STATIC_POOLS
 
+// Largest client size served by a size class
+static const size_t MAX_CLASS_SIZE = ((size_t)1 << MAX_ALLOCATORS) - BLOCK_HEADER_SIZE;
+
+// @TODO: Comment out to disable the per-thread block cache. Each thread keeps a
+// small free list of blocks per size class, so most xmalloc()/xfree() calls take
+// no lock. The cache needs thread_local storage, and is disabled with STATIC_POOLS
+// because a bounded pool must not strand blocks in another thread's cache.
+#if defined(DMQ_THREAD_STDLIB) && !defined(STATIC_POOLS)
+	#define THREAD_CACHE
+#endif
+
+#ifdef THREAD_CACHE
+	// Maximum blocks cached per size class per thread
+	#define CACHE_MAX_BLOCKS	32
+	// Blocks moved between a thread cache and the shared allocator at once
+	#define CACHE_BATCH		16
+	// Largest block size, in bytes, kept in a thread cache. Larger size classes
+	// always use the shared allocator, so a thread never holds a batch of them.
+	#define CACHE_MAX_BLOCK_SIZE	4096
+
+	// Incremented by xalloc_destroy(). A thread cache filled under an older 
+	// generation holds blocks of deleted allocators.
+	static std::atomic<uint32_t> _generation(0);
+#endif
+
 // For C++ applications, must define AUTOMATIC_XALLOCATOR_INIT_DESTROY to 
 // correctly ensure allocators are initialized before any static user C++ 
 // construtor/destructor executes which might call into the xallocator API. 
@@ -154,38 +183,79 @@ static inline void *get_block_ptr(void* block)
 	return (char*)block - BLOCK_HEADER_SIZE;
 }
 
-/// Returns an allocator instance matching the size provided
-/// @param[in] size - allocator block size
-/// @return Allocator instance handling requested block size or NULL
-/// if no allocator exists. 
-static inline Allocator* find_allocator(size_t size)
+/// Returns log2 of the next higher power of two. For instance, pass in 12 and
+/// the value returned would be 4 (16 bytes).
+/// @param[in] k - numeric value, greater than 1.
+static inline int ceil_log2(size_t k)
 {
-	for (int i=0; i<MAX_ALLOCATORS; i++)
-	{
-		if (_allocators[i] == 0)
-			break;
-		
-		if (_allocators[i]->GetBlockSize() == size)
-			return _allocators[i];
-	}
-	
-	return NULL;
+#if defined(__GNUC__) || defined(__clang__)
+	return (int)(sizeof(unsigned long long) * char_BIT) - __builtin_clzll((unsigned long long)(k - 1));
+#else
+	int n = 0;
+	for (k--; k; k >>= 1)
+		n++;
+	return n;
+#endif
 }
 
-/// Insert an allocator instance into the array
-/// @param[in] allocator - An allocator instance
-static inline void insert_allocator(Allocator* allocator)
+/// Allocates a block too large for any size class from the heap. The block header
+/// holds a NULL allocator followed by the client requested size.
+/// @param[in] size - the client requested size, greater than MAX_CLASS_SIZE.
+/// @return	A pointer to the client's memory block, or NULL if out of memory.
+static void* oversize_malloc(size_t size)
 {
-	for (int i=0; i<MAX_ALLOCATORS; i++)
-	{
-		if (_allocators[i] == 0)
-		{
-			_allocators[i] = allocator;
-			return;
-		}
-	}
-	
-	ASSERT();
+	if (size > SIZE_MAX - BLOCK_HEADER_SIZE)
+		return NULL;
+	void* block = malloc(size + BLOCK_HEADER_SIZE);
+	if (block == NULL)
+		return NULL;
+	*(size_t*)((char*)block + sizeof(Allocator*)) = size;
+	return set_block_allocator(block, NULL);
+}
+
+/// Returns the client requested size of a block from oversize_malloc().
+static inline size_t get_oversize_size(void* block)
+{
+	return *(size_t*)((char*)get_block_ptr(block) + sizeof(Allocator*));
+}
+
+/// Returns the block size for a client requested size. Most blocks are powers 
+/// of two, however some common allocator block sizes can be explicitly defined
+/// to minimize wasted storage. This offers application specific tuning.
+/// @param[in] size - the client requested size, not including the block header.
+static inline size_t get_block_size(size_t size)
+{
+	// Add BLOCK_HEADER_SIZE to the requested block size to hold the 
+	// allocator pointer within the block memory region.
+	size_t blockSize = size + BLOCK_HEADER_SIZE;
+	if (blockSize > 256 && blockSize <= 396)
+		return 396;
+	else if (blockSize > 512 && blockSize <= 768)
+		return 768;
+	return nexthigher<size_t>(blockSize);
+}
+
+/// Returns the size class index of a block size returned by get_block_size().
+/// Classes are ordered by size: 8, 16, 32, 64, 128, 256, 396, 512, 768, 1024, 
+/// 2048, ... so the index is computed in constant time.
+/// @param[in] blockSize - the allocator block size.
+/// @return The index into _allocators, or -1 if the block size is too large.
+static inline int get_size_class(size_t blockSize)
+{
+	int index;
+	if (blockSize <= 8)
+		index = 0;
+	else if (blockSize <= 256)
+		index = ceil_log2(blockSize) - 3;
+	else if (blockSize <= 396)
+		index = 6;
+	else if (blockSize <= 512)
+		index = 7;
+	else if (blockSize <= 768)
+		index = 8;
+	else
+		index = ceil_log2(blockSize) - 1;
+	return index < MAX_ALLOCATORS ? index : -1;
 }
 
 /// This function must be called exactly one time *before* any other xallocator
@@ -235,6 +305,10 @@ extern "C" void xalloc_destroy()
 {
 	get_mutex().lock();
 
+#ifdef THREAD_CACHE
+	_generation.fetch_add(1, std::memory_order_release);
+#endif
+
 #ifdef STATIC_POOLS
 	for (int i=0; i<MAX_ALLOCATORS; i++)
 	{
@@ -244,8 +318,6 @@ extern "C" void xalloc_destroy()
 #else
 	for (int i=0; i<MAX_ALLOCATORS; i++)
 	{
-		if (_allocators[i] == 0)
-			break;
 		delete _allocators[i];
 		_allocators[i] = 0;
 	}
@@ -254,28 +326,21 @@ extern "C" void xalloc_destroy()
 	get_mutex().unlock();
 }
 
-/// Get an Allocator instance based upon the client's requested block size.
-/// If a Allocator instance is not currently available to handle the size,
-///	then a new Allocator instance is create.
-///	@param[in] size - the client's requested block size.
-///	@return An Allocator instance that handles blocks of the requested
-///	size.
-extern "C" Allocator* xallocator_get_allocator(size_t size)
+/// Get the Allocator instance of a size class. If a Allocator instance is not 
+/// currently available to handle the size class, then a new Allocator instance 
+/// is created. Called with the mutex held.
+///	@param[in] sizeClass - the size class index.
+///	@param[in] blockSize - the block size of the size class.
+///	@return An Allocator instance that handles blocks of the size class.
+static Allocator* get_class_allocator(int sizeClass, size_t blockSize)
 {
-	// Based on the size, find the next higher powers of two value.
-	// Add sizeof(Allocator*) to the requested block size to hold the size
-	// within the block memory region. Most blocks are powers of two,
-	// however some common allocator block sizes can be explicitly defined
-	// to minimize wasted storage. This offers application specific tuning.
-	size_t blockSize = size + BLOCK_HEADER_SIZE;
-	if (blockSize > 256 && blockSize <= 396)
-		blockSize = 396;
-	else if (blockSize > 512 && blockSize <= 768)
-		blockSize = 768;
-	else
-		blockSize = nexthigher<size_t>(blockSize);
+	if (sizeClass < 0)
+	{
+		ASSERT();
+		return NULL;
+	}
 
-	Allocator* allocator = find_allocator(blockSize);
+	Allocator* allocator = _allocators[sizeClass];
 
 #ifdef STATIC_POOLS
 	ASSERT_TRUE(allocator != NULL);
@@ -285,26 +350,196 @@ extern "C" Allocator* xallocator_get_allocator(size_t size)
 	{
 		// Create a new allocator to handle blocks of the size required
 		allocator = new Allocator(blockSize, 0, 0, "xallocator");
-
-		// Insert allocator into array
-		insert_allocator(allocator);
+		_allocators[sizeClass] = allocator;
 	}
 #endif
 	
 	return allocator;
 }
 
+/// Get an Allocator instance based upon the client's requested block size.
+/// If a Allocator instance is not currently available to handle the size,
+///	then a new Allocator instance is create.
+///	@param[in] size - the client's requested block size.
+///	@return An Allocator instance that handles blocks of the requested
+///	size, or NULL if the size is too large for any size class.
+extern "C" Allocator* xallocator_get_allocator(size_t size)
+{
+	if (size > MAX_CLASS_SIZE)
+		return NULL;
+	size_t blockSize = get_block_size(size);
+	return get_class_allocator(get_size_class(blockSize), blockSize);
+}
+
+#ifdef THREAD_CACHE
+/// Per-thread free list of one size class. Blocks are linked through their 
+/// first word, which holds the Allocator* while the block is in use.
+struct CacheClass
+{
+	void* head;
+	Allocator* allocator;
+	uint32_t count;
+};
+
+// Trivially destructible, so still usable after the thread cache is flushed
+static thread_local CacheClass _cache[MAX_ALLOCATORS];
+static thread_local bool _cacheRegistered = false;
+static thread_local bool _cacheClosed = false;
+static thread_local uint32_t _cacheGeneration = 0;
+
+static inline void cache_push(CacheClass& cache, void* block)
+{
+	*static_cast<void**>(block) = cache.head;
+	cache.head = block;
+	cache.count++;
+}
+
+static inline void* cache_pop(CacheClass& cache)
+{
+	void* block = cache.head;
+	cache.head = *static_cast<void**>(block);
+	cache.count--;
+	return block;
+}
+
+/// Return up to count cached blocks to the shared allocator. Called with the 
+/// mutex held.
+static void cache_release(CacheClass& cache, uint32_t count)
+{
+	while (cache.count && count--)
+		cache.allocator->Deallocate(cache_pop(cache));
+}
+
+/// Fill the cache with up to CACHE_BATCH - 1 blocks from allocator. Stops early if
+/// the allocator cannot supply a block; the refill is opportunistic. Called with the
+/// mutex held.
+static void cache_refill(CacheClass& cache, Allocator* allocator, size_t blockSize)
+{
+	cache.allocator = allocator;
+#if defined(__cpp_exceptions)
+	try
+	{
+#endif
+		for (int i=1; i<CACHE_BATCH; i++)
+		{
+			void* block = allocator->Allocate(blockSize);
+			if (block == NULL)
+				break;
+			cache_push(cache, block);
+		}
+#if defined(__cpp_exceptions)
+	}
+	catch (const std::bad_alloc&)
+	{
+		// Keep the blocks obtained so far; the caller's block is already allocated
+	}
+#endif
+}
+
+/// Frees the blocks of a cache filled before xalloc_destroy(). Their allocators are
+/// gone, so the heap blocks are deleted directly.
+static void cache_discard()
+{
+	for (int i=0; i<MAX_ALLOCATORS; i++)
+	{
+		while (_cache[i].count)
+			delete [] (char*)cache_pop(_cache[i]);
+		_cache[i].head = NULL;
+		_cache[i].allocator = NULL;
+	}
+}
+
+/// Returns true if the calling thread's cache predates the last xalloc_destroy().
+static inline bool cache_stale()
+{
+	return _cacheGeneration != _generation.load(std::memory_order_acquire);
+}
+
+/// Returns the calling thread's cached blocks to the shared allocators when the
+/// thread exits. Blocks freed afterwards (e.g. by static destructors on the main
+/// thread) bypass the cache.
+class ThreadCacheFlush
+{
+public:
+	~ThreadCacheFlush()
+	{
+		get_mutex().lock();
+		if (cache_stale())
+			cache_discard();
+		for (int i=0; i<MAX_ALLOCATORS; i++)
+			cache_release(_cache[i], _cache[i].count);
+		get_mutex().unlock();
+		_cacheClosed = true;
+	}
+};
+
+/// Returns true if the calling thread may use its cache. The first call creates
+/// the thread exit flush.
+static inline bool cache_open()
+{
+	if (_cacheRegistered)
+	{
+		if (cache_stale())
+		{
+			cache_discard();
+			_cacheGeneration = _generation.load(std::memory_order_acquire);
+		}
+		return !_cacheClosed;
+	}
+	static thread_local ThreadCacheFlush flush;
+	(void)flush;
+	_cacheRegistered = true;
+	_cacheGeneration = _generation.load(std::memory_order_acquire);
+	return true;
+}
+#endif	// THREAD_CACHE
+
 /// Allocates a memory block of the requested size. The blocks are created from
 ///	the fixed block allocators.
 ///	@param[in] size - the client requested size of the block.
 /// @return	A pointer to the client's memory block.
 extern "C" void *xmalloc(size_t size)
 {
+	if (size > MAX_CLASS_SIZE)
+	{
+#ifdef STATIC_POOLS
+		ASSERT();
+		return NULL;
+#else
+		return oversize_malloc(size);
+#endif
+	}
+
+	size_t blockSize = get_block_size(size);
+	int sizeClass = get_size_class(blockSize);
+	Allocator* allocator;
+	void* blockMemoryPtr;
+
+#ifdef THREAD_CACHE
+	CacheClass* cache = NULL;
+	if (blockSize <= CACHE_MAX_BLOCK_SIZE && cache_open())
+	{
+		cache = &_cache[sizeClass];
+		if (cache->count)
+		{
+			// Fast path: no lock
+			blockMemoryPtr = cache_pop(*cache);
+			return set_block_allocator(blockMemoryPtr, cache->allocator);
+		}
+	}
+#endif
+
 	get_mutex().lock();
 
 	// Allocate a raw memory block 
-	Allocator* allocator = xallocator_get_allocator(size);
-	void* blockMemoryPtr = allocator->Allocate(size + BLOCK_HEADER_SIZE);
+	allocator = get_class_allocator(sizeClass, blockSize);
+	blockMemoryPtr = allocator->Allocate(blockSize);
+
+#ifdef THREAD_CACHE
+	// Refill the thread cache in the same lock
+	if (cache && blockMemoryPtr)
+		cache_refill(*cache, allocator, blockSize);
+#endif
 
 	get_mutex().unlock();
 
@@ -334,6 +569,31 @@ extern "C" void xfree(void* ptr)
 	// Convert the client pointer into the original raw block pointer
 	void* blockPtr = get_block_ptr(ptr);
 
+	// Oversize blocks come from the heap
+	if (allocator == NULL)
+	{
+		free(blockPtr);
+		return;
+	}
+
+#ifdef THREAD_CACHE
+	if (allocator->GetBlockSize() <= CACHE_MAX_BLOCK_SIZE && cache_open())
+	{
+		CacheClass& cache = _cache[get_size_class(allocator->GetBlockSize())];
+		cache.allocator = allocator;
+		cache_push(cache, blockPtr);
+
+		// Fast path: no lock until the cache is full
+		if (cache.count <= CACHE_MAX_BLOCKS)
+			return;
+
+		get_mutex().lock();
+		cache_release(cache, CACHE_BATCH);
+		get_mutex().unlock();
+		return;
+	}
+#endif
+
 	get_mutex().lock();
 
 	// Deallocate the block 
@@ -363,7 +623,8 @@ extern "C" void *xrealloc(void *oldMem, size_t size)
 		{
 			// Get the original allocator instance from the old memory block
 			Allocator* oldAllocator = get_block_allocator(oldMem);
-			size_t oldSize = oldAllocator->GetBlockSize() - BLOCK_HEADER_SIZE;
+			size_t oldSize = oldAllocator ? oldAllocator->GetBlockSize() - BLOCK_HEADER_SIZE :
+				get_oversize_size(oldMem);
 
 			// Copy the bytes from the old memory block into the new (as much as will fit)
 			memcpy(newMem, oldMem, (oldSize < size) ? oldSize : size);
@@ -386,17 +647,46 @@ extern "C" void xalloc_stats()
 	for (int i=0; i<MAX_ALLOCATORS; i++)
 	{
 		if (_allocators[i] == 0)
-			break;
+			continue;
 
 		if (_allocators[i]->GetName() != NULL)
 			cout << _allocators[i]->GetName();
 		cout << " Block Size: " << _allocators[i]->GetBlockSize();
 		cout << " Block Count: " << _allocators[i]->GetBlockCount();
 		cout << " Blocks In Use: " << _allocators[i]->GetBlocksInUse();
+		cout << " Max In Use: " << _allocators[i]->GetBlocksInUseMax();
 		cout << endl;
 	}
 
 	get_mutex().unlock();
 }
 
+/// Take a snapshot of the statistics of every size class in use
+extern "C" size_t xalloc_get_stats(XallocStats* stats, size_t maxCount)
+{
+	size_t count = 0;
+
+	get_mutex().lock();
+
+	for (int i=0; i<MAX_ALLOCATORS && count < maxCount; i++)
+	{
+		Allocator* allocator = _allocators[i];
+		if (allocator == 0)
+			continue;
+
+		XallocStats& s = stats[count++];
+		s.blockSize = allocator->GetBlockSize();
+		s.maxBlocks = allocator->GetMaxBlocks();
+		s.blockCount = allocator->GetBlockCount();
+		s.blocksInUse = allocator->GetBlocksInUse();
+		s.blocksInUseMax = allocator->GetBlocksInUseMax();
+		s.allocations = allocator->GetAllocations();
+		s.deallocations = allocator->GetDeallocations();
+		s.exhaustedCount = allocator->GetExhaustedCount();
+	}
+
+	get_mutex().unlock();
+	return count;
+}
+
 
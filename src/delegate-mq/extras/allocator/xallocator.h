@@ -54,7 +54,8 @@ void xalloc_init();
 /// Embedded systems that never exit need not call this function at all. 
 void xalloc_destroy();
 
-/// Allocate a block of memory
+/// Allocate a block of memory. Sizes too large for any size class are allocated
+/// from the heap.
 /// @param[in] size - the size of the block to allocate. 
 void *xmalloc(size_t size);
 
@@ -67,9 +68,30 @@ void xfree(void* ptr);
 /// @param[in] size - the size of the new block
 void *xrealloc(void *ptr, size_t size);	
 
-/// Output allocator statistics to the standard output
+/// Output allocator statistics to the standard output. Blocks held in a thread's
+/// block cache (see THREAD_CACHE in xallocator.cpp) are counted as in use.
 void xalloc_stats();
 
+/// Statistics of one xallocator size class
+typedef struct
+{
+	size_t blockSize;			///< Block size in bytes, including the block header
+	uint32_t maxBlocks;			///< Pool size in blocks, or 0 if blocks come from the heap
+	uint32_t blockCount;		///< Blocks created off the heap
+	uint32_t blocksInUse;		///< Blocks currently in use
+	uint32_t blocksInUseMax;	///< High-water mark of blocksInUse
+	uint32_t allocations;		///< Total allocations
+	uint32_t deallocations;		///< Total deallocations
+	uint32_t exhaustedCount;	///< Allocations failed because the pool was exhausted
+} XallocStats;
+
+/// Take a snapshot of the statistics of every size class in use, smallest block
+/// size first. Blocks held in a thread's block cache are counted as in use.
+/// @param[out] stats - array to receive one entry per size class.
+/// @param[in] maxCount - number of entries in the stats array.
+/// @return The number of entries written.
+size_t xalloc_get_stats(XallocStats* stats, size_t maxCount);
+
 #ifdef DMQ_ALLOCATOR
     // Macro to overload new/delete with xalloc/xfree. Add macro to any class to enable
     // fixed-block memory allocation. Add to a base class provides fixed-block memory
@@ -28,6 +28,12 @@ namespace dmq::databus {
 // LIFETIME NOTE: This class assumes that any external ISerializer or ITransport objects 
 // passed to it (e.g., via AddParticipant or RegisterSerializer) will outlive 
 // the DataBus instance or its Reset() calls.
+//
+// THREADING NOTE: The topic registry is read-mostly. Registration calls (Subscribe
+// creating a topic, RegisterSerializer, AddParticipant, ...) take the DataBus lock
+// and increment a generation counter. Publish finds the topic in a lock-free
+// table and reuses the topic's resolved route until the generation changes, so
+// publishers on disjoint topics share no lock.
 class DataBus {
 public:
     // Subscribe to a topic with optional QoS and thread dispatching.
@@ -49,6 +55,21 @@ public:
         return GetInstance().InternalSubscribe<T>(topic, std::move(filterFunc), thread, qos);
     }
 
+    template <typename T>
+    class Topic;
+
+    // Get a handle to a topic for repeated publishing. The handle caches the
+    // resolved signal, serializer, LVC slot and remote routes, so Topic::Publish()
+    // performs no topic name lookups and takes no DataBus lock. The cache is
+    // re-resolved automatically when the bus registration changes.
+    template <typename T>
+    static Topic<T> GetTopic(const std::string& topic) {
+        DataBus& instance = GetInstance();
+        auto node = instance.GetOrCreateTopic(topic);
+        auto route = instance.GetRoute<T>(*node, true);
+        return Topic<T>(std::move(node), std::move(route));
+    }
+
     // Publish data to a topic.
     template <typename T>
     static void Publish(const std::string& topic, const T& data) {
@@ -145,7 +166,8 @@ public:
         return GetInstance().m_errorSignal.Connect(dmq::MakeDelegate(std::move(func)));
     }
 
-    // Reset the DataBus (mostly for testing).
+    // Reset the DataBus (mostly for testing). Safe to call while other threads
+    // publish; topic nodes a publisher may be walking are retired, not freed.
     static void ResetForTesting() {
         GetInstance().InternalReset();
     }
@@ -158,6 +180,7 @@ private:
     void InternalLastValueCache(const std::string& topic, bool enabled) {
         std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
         m_topicQos[topic].lastValueCache = enabled;
+        BumpGeneration();
     }
 
     DataBus() = default;
@@ -174,6 +197,210 @@ private:
     template <typename T>
     using SignalPtr = std::shared_ptr<dmq::Signal<void(T)>>;
 
+    template <typename T>
+    using ChannelPtr = std::shared_ptr<dmq::RemoteChannel<void(T)>>;
+
+    // Last published value of a topic. Each topic has its own slot and lock so
+    // LVC updates on unrelated topics do not contend.
+    struct LvcSlot {
+        dmq::Mutex mutex;
+        std::shared_ptr<void> value;
+        dmq::TimePoint timestamp;
+    };
+
+    // Everything a publish needs for one topic, resolved from the registry.
+    // Immutable once resolved; shared by all publishers of the topic.
+    template <typename T>
+    struct TopicRoute {
+        // Remote participant, the topic remote ID and the send channel. The
+        // channel is null if the participant is not interested in the topic
+        // or the topic has no serializer.
+        struct Remote {
+            std::shared_ptr<Participant> participant;
+            uint32_t topicVersion = 0;
+            dmq::DelegateRemoteId remoteId = 0;
+            ChannelPtr<T> channel;
+        };
+
+        uint64_t generation = 0;
+        SignalPtr<T> signal;
+        std::shared_ptr<void> serializerPtr;
+        dmq::ISerializer<void(T)>* serializer = nullptr;
+        std::shared_ptr<LvcSlot> lvc;
+        std::shared_ptr<void> stringifier;
+        std::array<Remote, dmq::MAX_PARTICIPANTS> remotes;
+        size_t remoteCount = 0;
+        size_t interestedCount = 0;
+    };
+
+    template <typename T>
+    using RoutePtr = std::shared_ptr<const TopicRoute<T>>;
+
+    // A topic in the lock-free topic table. Nodes are created only for topics
+    // with a registration (subscriber, serializer, Topic<T> handle, remote
+    // interest, LVC or stringifier), inserted at the head of a bucket chain and
+    // never removed or moved, so publishers walk the chains without a lock.
+    // ResetForTesting() empties the table but keeps the nodes alive. The node caches the most recently resolved route
+    // under its own mutex, so publishers on different topics do not contend.
+    // Topic<T> handles share ownership so a handle outlives a reset.
+    struct TopicNode {
+        TopicNode(const std::string& n, size_t h) : name(n), hash(h) {}
+
+        const std::string name;
+        const size_t hash;
+        TopicNode* next = nullptr;      // Immutable once the node is inserted
+
+        dmq::Mutex mutex;               // Guards route and routeType
+        std::shared_ptr<const void> route;
+        const std::type_info* routeType = nullptr;
+
+        XALLOCATOR
+    };
+
+    // The most recent route resolved for a topic without a node, i.e. a topic
+    // with no registration. Publishing such a topic reuses the route until the
+    // generation or a participant's topics change, instead of resolving it under
+    // the DataBus lock every time. One slot per table bucket bounds the memory
+    // regardless of how many topic names are published.
+    struct UnregisteredRoute {
+        dmq::Mutex mutex;               // Guards all fields
+        std::string name;
+        std::shared_ptr<const void> route;
+        const std::type_info* routeType = nullptr;
+    };
+
+    // Increment after any registry change that affects a TopicRoute.
+    // Assume lock is held by caller.
+    void BumpGeneration() {
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    template <typename T>
+    bool IsCurrent(const TopicRoute<T>& route) const {
+        if (route.generation != m_generation.load(std::memory_order_acquire))
+            return false;
+        for (size_t i = 0; i < route.remoteCount; ++i) {
+            if (route.remotes[i].topicVersion != route.remotes[i].participant->GetTopicVersion())
+                return false;
+        }
+        return true;
+    }
+
+    // Find a topic node without locking.
+    TopicNode* FindTopic(const std::string& topic, size_t hash) const {
+        TopicNode* node = m_topics[hash % dmq::DATABUS_TOPIC_BUCKETS].load(std::memory_order_acquire);
+        for (; node; node = node->next) {
+            if (node->hash == hash && node->name == topic)
+                return node;
+        }
+        return nullptr;
+    }
+
+    // Find or insert a topic node. Called on registration, not per publish.
+    std::shared_ptr<TopicNode> GetOrCreateTopic(const std::string& topic) {
+        std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
+        auto& node = m_topicNodes[topic];
+        if (!node) {
+            const size_t hash = std::hash<std::string>()(topic);
+            auto& bucket = m_topics[hash % dmq::DATABUS_TOPIC_BUCKETS];
+            node = std::shared_ptr<TopicNode>(new TopicNode(topic, hash));
+            node->next = bucket.load(std::memory_order_relaxed);
+            bucket.store(node.get(), std::memory_order_release);
+        }
+        return node;
+    }
+
+    // @return true if a route has anything to deliver to or record.
+    template <typename T>
+    static bool IsRegistered(const TopicRoute<T>& route) {
+        return route.signal || route.serializer || route.lvc || route.stringifier || route.interestedCount > 0;
+    }
+
+    // Get the topic route cached on the node, re-resolving it if the registry
+    // changed. The DataBus lock is taken only to re-resolve.
+    // @return nullptr on a topic type mismatch.
+    template <typename T>
+    RoutePtr<T> GetRoute(TopicNode& node, bool registerType) {
+        {
+            std::lock_guard<dmq::Mutex> lock(node.mutex);
+            if (node.routeType && *node.routeType == typeid(T)) {
+                auto route = std::static_pointer_cast<const TopicRoute<T>>(node.route);
+                if (IsCurrent(*route))
+                    return route;
+            }
+        }
+
+        auto route = ResolveRoute<T>(node.name, registerType);
+        if (route) {
+            std::lock_guard<dmq::Mutex> lock(node.mutex);
+            node.route = route;
+            node.routeType = &typeid(T);
+        }
+        return route;
+    }
+
+    // Resolve the publish route for a topic from the registry. If registerType
+    // is true, the topic type is registered when not yet known.
+    // @return nullptr on a topic type mismatch.
+    template <typename T>
+    RoutePtr<T> ResolveRoute(const std::string& topic, bool registerType) {
+        auto route = std::make_shared<TopicRoute<T>>();
+
+        std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
+
+        // Type safety: verify T matches the registered type for this topic.
+        auto itType = m_typeIndices.find(topic);
+        if (itType != m_typeIndices.end()) {
+            if (itType->second != std::type_index(typeid(T))) {
+                ::dmq::util::FaultHandler(__FILE__, (unsigned short)__LINE__);
+                return nullptr;
+            }
+        } else if (registerType) {
+            m_typeIndices.emplace(topic, std::type_index(typeid(T)));
+        }
+
+        route->generation = m_generation.load(std::memory_order_acquire);
+
+        // Only create Signal if there is local interest.
+        auto itSig = m_signals.find(topic);
+        if (itSig != m_signals.end()) {
+            route->signal = std::static_pointer_cast<dmq::Signal<void(T)>>(itSig->second);
+        }
+
+        auto itSer = m_serializers.find(topic);
+        if (itSer != m_serializers.end()) {
+            route->serializerPtr = itSer->second;
+            route->serializer = static_cast<dmq::ISerializer<void(T)>*>(route->serializerPtr.get());
+        }
+
+        // NOTE: QoS lastValueCache is "sticky" per topic. Once enabled
+        // by any subscriber, it remains active for that topic until ResetForTesting().
+        auto itQos = m_topicQos.find(topic);
+        if (itQos != m_topicQos.end() && itQos->second.lastValueCache) {
+            route->lvc = GetOrCreateLvcSlot(topic);
+        }
+
+        auto itStr = m_stringifiers.find(topic);
+        if (itStr != m_stringifiers.end()) {
+            route->stringifier = itStr->second;
+        }
+
+        // Snapshot participants while locked to ensure atomicity between
+        // local and remote dispatch sets.
+        for (size_t i = 0; i < m_participantCount; ++i) {
+            auto& remote = route->remotes[i];
+            remote.participant = m_participants[i];
+            remote.topicVersion = remote.participant->GetTopicVersion();
+            if (remote.participant->GetRemoteId(topic, remote.remoteId)) {
+                route->interestedCount++;
+                if (route->serializer)
+                    remote.channel = remote.participant->template GetOrCreateChannel<T>(remote.remoteId, *route->serializer);
+            }
+        }
+        route->remoteCount = m_participantCount;
+        return route;
+    }
+
     template <typename T, typename F>
     dmq::ScopedConnection InternalSubscribe(const std::string& topic, F&& func, dmq::IThread* thread, QoS qos) {
         SignalPtr<T> signal;
@@ -207,11 +434,17 @@ private:
 
             // 1. Enable LVC if requested (persists for topic lifetime until ResetForTesting)
             if (qos.lastValueCache) {
-                m_topicQos[topic].lastValueCache = true;
+                auto& topicQos = m_topicQos[topic];
+                if (!topicQos.lastValueCache) {
+                    topicQos.lastValueCache = true;
+                    BumpGeneration();
+                }
             }
 
             // 2. Get or create signal with type safety check (std::type_index)
             signal = GetOrCreateSignal<T>(topic);
+            if (signal)
+                GetOrCreateTopic(topic);
         }
 
         if (!signal) {
@@ -229,20 +462,27 @@ private:
             conn = signal->Connect(dmq::MakeDelegate(typedFunc));
         }
 
-        {
-            std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
-            // 4. Prepare LVC delivery if enabled and available
-            if (qos.lastValueCache) {
+        // 4. Prepare LVC delivery if enabled and available
+        if (qos.lastValueCache) {
+            std::shared_ptr<LvcSlot> slot;
+            {
+                std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
                 auto it = m_lastValues.find(topic);
                 if (it != m_lastValues.end()) {
+                    slot = it->second;
+                }
+            }
+            if (slot) {
+                std::lock_guard<dmq::Mutex> slotLock(slot->mutex);
+                if (slot->value) {
                     // Check lifespan: skip delivery if the cached value is too old
                     bool expired = false;
                     if (qos.lifespan.has_value()) {
-                        auto age = dmq::Clock::now() - it->second.timestamp;
+                        auto age = dmq::Clock::now() - slot->timestamp;
                         expired = (age > qos.lifespan.value());
                     }
                     if (!expired) {
-                        cachedVal = *std::static_pointer_cast<T>(it->second.value);
+                        cachedVal = *std::static_pointer_cast<T>(slot->value);
                         cachedValPtr = &cachedVal;
                     }
                 }
@@ -276,116 +516,172 @@ private:
         // Capture timestamp before lock acquisition for maximum accuracy and 
         // monotonic ordering using dmq::Clock.
         auto now = dmq::Clock::now();
-        uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
 
-        SignalPtr<T> signal;
-        std::shared_ptr<void> serializerPtr;
-        dmq::ISerializer<void(T)>* serializer = nullptr;
-        std::array<std::shared_ptr<Participant>, dmq::MAX_PARTICIPANTS> participantsSnapshot;
-        size_t participantSnapshotCount = 0;
-        std::string strVal = "?";
-        bool hasMonitor = false;
+        // Topics without a registration get no node, so publishing arbitrary
+        // topic names does not grow the topic table
+        const size_t hash = std::hash<std::string>()(topic);
+        RoutePtr<T> route;
+        TopicNode* node = FindTopic(topic, hash);
+        if (node) {
+            route = GetRoute<T>(*node, false);
+        } else {
+            route = GetUnregisteredRoute<T>(topic, hash);
+        }
+        if (!route)
+            return;
+        Dispatch<T>(topic, *route, data, now, localOnly);
+    }
 
+    // Get the route of a topic without a node. A topic found to be registered
+    // gets a node; an unregistered one is cached in its UnregisteredRoute slot.
+    // @return nullptr on a topic type mismatch.
+    template <typename T>
+    RoutePtr<T> GetUnregisteredRoute(const std::string& topic, size_t hash) {
+        auto& slot = m_unregistered[hash % dmq::DATABUS_TOPIC_BUCKETS];
         {
-            std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
-
-            // 1. Type safety: verify T matches the registered type for this topic.
-            // Must be first — before any writes — so a mismatch never corrupts LVC.
-            auto itType = m_typeIndices.find(topic);
-            if (itType != m_typeIndices.end() && itType->second != std::type_index(typeid(T))) {
-                ::dmq::util::FaultHandler(__FILE__, (unsigned short)__LINE__);
-                return;
-            }
-
-            // 2. Update LVC ONLY if enabled for this topic to save memory.
-            // NOTE: QoS lastValueCache is currently "sticky" per topic. Once enabled
-            // by any subscriber, it remains active for that topic until ResetForTesting().
-            auto itQos = m_topicQos.find(topic);
-            if (itQos != m_topicQos.end() && itQos->second.lastValueCache) {
-                m_lastValues[topic] = LvcEntry{ std::make_shared<T>(data), now };
+            std::lock_guard<dmq::Mutex> lock(slot.mutex);
+            if (slot.routeType && *slot.routeType == typeid(T) && slot.name == topic) {
+                auto route = std::static_pointer_cast<const TopicRoute<T>>(slot.route);
+                if (IsCurrent(*route))
+                    return route;
             }
+        }
 
-            // 3. Prepare monitor data
-            if (!m_monitorSignal.Empty()) {
-                hasMonitor = true;
-                auto itStr = m_stringifiers.find(topic);
-                if (itStr != m_stringifiers.end()) {
-                    auto func = static_cast<std::function<std::string(const T&)>*>(itStr->second.get());
-                    strVal = (*func)(data);
-                }
-            }
+        auto route = ResolveRoute<T>(topic, false);
+        if (!route)
+            return nullptr;
+        if (IsRegistered(*route)) {
+            auto created = GetOrCreateTopic(topic);
+            std::lock_guard<dmq::Mutex> lock(created->mutex);
+            created->route = route;
+            created->routeType = &typeid(T);
+        } else {
+            std::lock_guard<dmq::Mutex> lock(slot.mutex);
+            slot.name = topic;
+            slot.route = route;
+            slot.routeType = &typeid(T);
+        }
+        return route;
+    }
 
-            // 4. Get signal and remote info. Only create Signal if there is local interest.
-            auto itSig = m_signals.find(topic);
-            if (itSig != m_signals.end()) {
-                signal = std::static_pointer_cast<dmq::Signal<void(T)>>(itSig->second);
-            }
+    template <typename T>
+    void TopicPublish(Topic<T>& handle, const T& data, bool localOnly) {
+        if (!handle.m_node)
+            return;
+        auto now = dmq::Clock::now();
 
-            auto itSer = m_serializers.find(topic);
-            if (itSer != m_serializers.end()) {
-                serializerPtr = itSer->second;
-                serializer = static_cast<dmq::ISerializer<void(T)>*>(serializerPtr.get());
-            }
+        // Refresh only when a registration changed since the last publish
+        if (!handle.m_route || !IsCurrent(*handle.m_route)) {
+            handle.m_route = GetRoute<T>(*handle.m_node, true);
+            if (!handle.m_route)
+                return;
+        }
+        Dispatch<T>(handle.m_node->name, *handle.m_route, data, now, localOnly);
+    }
 
-            // 5. Snapshot participants while locked to ensure atomicity between
-            // local and remote dispatch sets.
-            for (size_t i = 0; i < m_participantCount; ++i)
-                participantsSnapshot[i] = m_participants[i];
-            participantSnapshotCount = m_participantCount;
+    // Deliver data using a resolved route. Called without the DataBus lock held.
+    template <typename T>
+    void Dispatch(const std::string& topic, const TopicRoute<T>& route, const T& data, dmq::TimePoint now, bool localOnly) {
+        // 1. Update LVC ONLY if enabled for this topic to save memory.
+        if (route.lvc) {
+            auto value = std::make_shared<T>(data);
+            std::lock_guard<dmq::Mutex> slotLock(route.lvc->mutex);
+            route.lvc->value = std::move(value);
+            route.lvc->timestamp = now;
         }
 
-        // 6. Dispatch Monitor outside lock to allow re-entry/prevent deadlocks
-        if (hasMonitor) {
+        // 2. Dispatch Monitor to allow re-entry/prevent deadlocks
+        if (!m_monitorSignal.Empty()) {
+            std::string strVal = "?";
+            if (route.stringifier) {
+                auto func = static_cast<std::function<std::string(const T&)>*>(route.stringifier.get());
+                strVal = (*func)(data);
+            }
+            uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
             SpyPacket packet{ topic, strVal, timestamp };
             m_monitorSignal(packet);
         }
 
-        // 7. Local distribution
+        // 3. Local distribution
         bool handled = false;
-        if (signal) {
-            (*signal)(data);
+        if (route.signal) {
+            (*route.signal)(data);
             handled = true;
         }
 
-        // 8. Remote distribution using the snapshot
-        if (!localOnly) {
-            Participant* interested[dmq::MAX_PARTICIPANTS];
-            size_t interestedCount = 0;
-            for (size_t i = 0; i < participantSnapshotCount; ++i) {
-                dmq::DelegateRemoteId rid;
-                if (participantsSnapshot[i]->GetRemoteId(topic, rid)) {
-                    interested[interestedCount++] = participantsSnapshot[i].get();
-                }
-            }
-
-            if (interestedCount > 0) {
-                if (serializer) {
-                    for (size_t i = 0; i < interestedCount; ++i) {
-                        interested[i]->Send<T>(topic, data, *serializer);
-                        handled = true;
+        // 4. Remote distribution using the snapshot
+        if (!localOnly && route.interestedCount > 0) {
+            if (route.serializer) {
+                if (route.interestedCount == 1) {
+                    // Single destination: serialize into the channel's reusable buffer
+                    for (size_t i = 0; i < route.remoteCount; ++i) {
+                        auto& remote = route.remotes[i];
+                        if (remote.channel) {
+                            remote.participant->template SendChannel<T>(remote.channel, data);
+                        }
                     }
                 } else {
-                    // HAZARD 3: Topic has remote interest but no serializer — fire once per topic.
-                    bool shouldFire = false;
-                    {
-                        std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
-                        constexpr uint8_t bit = uint8_t(1u << static_cast<int>(dmq::DelegateError::ERR_NO_SERIALIZER));
-                        auto& bits = m_reportedErrors[topic];
-                        if (!(bits & bit)) { bits |= bit; shouldFire = true; }
+                    // Fan-out: serialize once and share the immutable payload with
+                    // every interested participant (and its send thread, if any).
+                    auto payload = Serialize<T>(topic, *route.serializer, data);
+                    if (payload) {
+                        for (size_t i = 0; i < route.remoteCount; ++i) {
+                            auto& remote = route.remotes[i];
+                            if (remote.channel) {
+                                remote.participant->template SendSerialized<T>(remote.channel, payload);
+                            }
+                        }
                     }
-                    if (shouldFire)
-                        m_errorSignal(topic, dmq::DelegateError::ERR_NO_SERIALIZER);
-                    handled = true;
                 }
+                handled = true;
+            } else {
+                // HAZARD 3: Topic has remote interest but no serializer — fire once per topic.
+                ReportErrorOnce(topic, dmq::DelegateError::ERR_NO_SERIALIZER);
+                handled = true;
             }
         }
 
-        // 9. Notify if no one received the message
+        // 5. Notify if no one received the message
         if (!handled) {
             m_unhandledSignal(topic);
         }
     }
 
+    // Serialize data into a new shared buffer for fan-out to several participants.
+    // @return nullptr if serialization failed.
+    template <typename T>
+    std::shared_ptr<const dmq::ByteBuffer> Serialize(const std::string& topic, dmq::ISerializer<void(T)>& serializer, const T& data) {
+        auto buffer = std::make_shared<dmq::ByteBuffer>();
+#if !defined(__cpp_exceptions) || defined(DMQ_ASSERTS)
+        serializer.WriteBuffer(*buffer, data);
+#else
+        try {
+            serializer.WriteBuffer(*buffer, data);
+        }
+        catch (std::exception&) {
+            buffer->SetFail();
+        }
+#endif
+        if (!buffer->Good()) {
+            ReportErrorOnce(topic, dmq::DelegateError::ERR_SERIALIZE);
+            return nullptr;
+        }
+        return buffer;
+    }
+
+    // Fire the error signal the first time an error occurs on a topic.
+    void ReportErrorOnce(const std::string& topic, dmq::DelegateError error) {
+        bool shouldFire = false;
+        {
+            std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
+            const uint8_t bit = uint8_t(1u << static_cast<int>(error));
+            auto& bits = m_reportedErrors[topic];
+            if (!(bits & bit)) { bits |= bit; shouldFire = true; }
+        }
+        if (shouldFire)
+            m_errorSignal(topic, error);
+    }
+
     void InternalAddParticipant(std::shared_ptr<Participant> participant) {
         std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
         if (m_participantCount < dmq::MAX_PARTICIPANTS) {
@@ -395,6 +691,7 @@ private:
             });
 
             m_participants[m_participantCount++] = participant;
+            BumpGeneration();
         }
         else
             ::dmq::util::FaultHandler(__FILE__, (unsigned short)__LINE__);
@@ -416,6 +713,8 @@ private:
 
         // Use shared_ptr with no-op deleter because serializer is owned by caller
         m_serializers[topic] = std::shared_ptr<void>(&serializer, [](void*) {});
+        GetOrCreateTopic(topic);
+        BumpGeneration();
     }
 
     template <typename T>
@@ -438,6 +737,7 @@ private:
             new std::function<std::string(const T&)>(std::move(func)),
             [](void* ptr) { delete static_cast<std::function<std::string(const T&)>*>(ptr); }
         );
+        BumpGeneration();
     }
 
     void InternalReset() {
@@ -456,6 +756,26 @@ private:
         m_typeIndices.clear();
         m_monitorSignal.Clear();
         m_reportedErrors.clear();
+
+        // Empty the topic table. A concurrent publisher may still be walking a
+        // bucket chain, so the nodes are retired rather than freed. Retired nodes
+        // and nodes held by Topic<T> handles drop their cached route and
+        // re-resolve on the next publish.
+        for (auto& bucket : m_topics)
+            bucket.store(nullptr, std::memory_order_release);
+        for (auto& entry : m_topicNodes) {
+            std::lock_guard<dmq::Mutex> nodeLock(entry.second->mutex);
+            entry.second->route.reset();
+            entry.second->routeType = nullptr;
+            m_retiredNodes.push_back(std::move(entry.second));
+        }
+        m_topicNodes.clear();
+        for (auto& slot : m_unregistered) {
+            std::lock_guard<dmq::Mutex> slotLock(slot.mutex);
+            slot.route.reset();
+            slot.routeType = nullptr;
+        }
+        BumpGeneration();
     }
 
     template <typename T>
@@ -479,13 +799,17 @@ private:
 
         auto signal = std::make_shared<dmq::Signal<void(T)>>();
         m_signals[topic] = std::static_pointer_cast<void>(signal);
+        BumpGeneration();
         return signal;
     }
 
-    struct LvcEntry {
-        std::shared_ptr<void> value;
-        dmq::TimePoint timestamp;
-    };
+    std::shared_ptr<LvcSlot> GetOrCreateLvcSlot(const std::string& topic) {
+        // Assume lock is held by caller
+        auto& slot = m_lastValues[topic];
+        if (!slot)
+            slot = std::make_shared<LvcSlot>();
+        return slot;
+    }
 
     dmq::RecursiveMutex m_mutex;
     xmap<std::string, uint8_t> m_reportedErrors;
@@ -494,13 +818,56 @@ private:
     std::array<std::shared_ptr<Participant>, dmq::MAX_PARTICIPANTS> m_participants{};
     size_t m_participantCount = 0;
     xmap<std::string, std::shared_ptr<void>> m_serializers;
-    xmap<std::string, LvcEntry> m_lastValues;
+    xmap<std::string, std::shared_ptr<LvcSlot>> m_lastValues;
     xmap<std::string, QoS> m_topicQos;
     xmap<std::string, std::shared_ptr<void>> m_stringifiers;
     dmq::Signal<void(const SpyPacket&)> m_monitorSignal;
     dmq::Signal<void(const std::string& topic)> m_unhandledSignal;
     dmq::Signal<void(const std::string& topic, dmq::DelegateError error)> m_errorSignal;
     std::array<dmq::ScopedConnection, dmq::MAX_PARTICIPANTS> m_participantErrorConnections;
+    std::atomic<uint64_t> m_generation{ 1 };
+    std::array<std::atomic<TopicNode*>, dmq::DATABUS_TOPIC_BUCKETS> m_topics{};
+    xmap<std::string, std::shared_ptr<TopicNode>> m_topicNodes;    // Owns the nodes in m_topics
+    xlist<std::shared_ptr<TopicNode>> m_retiredNodes;               // Nodes removed by InternalReset()
+    std::array<UnregisteredRoute, dmq::DATABUS_TOPIC_BUCKETS> m_unregistered;
+};
+
+// A handle to a DataBus topic. Obtain with DataBus::GetTopic<T>("name").
+//
+// Publish() uses the route cached in the handle: no topic string hashing, no
+// registry map lookups and no lock. A handle detects registry changes
+// (Subscribe creating the topic signal, RegisterSerializer, AddParticipant,
+// Participant::AddRemoteTopic, LVC enable, ResetForTesting) with a generation
+// check and refreshes its route on the next publish.
+//
+// A handle is not thread safe. Give each publishing thread its own copy.
+template <typename T>
+class DataBus::Topic {
+public:
+    Topic() = default;
+
+    // Publish data to the topic.
+    void Publish(const T& data) {
+        DataBus::GetInstance().TopicPublish<T>(*this, data, false);
+    }
+
+    // Publish data to local subscribers only. See DataBus::PublishLocal().
+    void PublishLocal(const T& data) {
+        DataBus::GetInstance().TopicPublish<T>(*this, data, true);
+    }
+
+    const std::string& GetName() const {
+        static const std::string empty;
+        return m_node ? m_node->name : empty;
+    }
+
+private:
+    friend class DataBus;
+
+    Topic(std::shared_ptr<TopicNode> node, RoutePtr<T> route) : m_node(std::move(node)), m_route(std::move(route)) {}
+
+    std::shared_ptr<TopicNode> m_node;
+    RoutePtr<T> m_route;
 };
 
 } // namespace dmq::databus
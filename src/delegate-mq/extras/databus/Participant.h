@@ -6,12 +6,14 @@
 #include "delegate/DelegateOpt.h"
 #include "port/transport/ITransport.h"
 #include "port/transport/DmqHeader.h"
+#include "port/transport/BatchFrame.h"
 #include "extras/dispatcher/RemoteChannel.h"
 #include "extras/util/Fault.h"
 #include <algorithm>
 #include <string>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <typeindex>
 
 namespace dmq::databus {
@@ -37,11 +39,21 @@ public:
     // are a data race on the channel's internal stream buffer.
     void SetSendThread(dmq::IThread* thread) { m_sendThread = thread; }
 
+    // Set a dispatcher shared by all channels created after this call, e.g. a
+    // BatchDispatcher to coalesce small messages. The dispatcher must already be
+    // connected to a transport and must outlive the Participant. By default each
+    // channel sends directly on the participant's transport.
+    void SetDispatcher(dmq::IDispatcher* dispatcher) {
+        std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
+        m_dispatcher = dispatcher;
+    }
+
     // Add a remote topic mapping.
     // When local DataBus publishes to 'topic', it will be sent to this participant using 'remoteId'.
     void AddRemoteTopic(const std::string& topic, dmq::DelegateRemoteId remoteId) {
         std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
         m_topicToRemoteId[topic] = remoteId;
+        m_topicVersion.fetch_add(1, std::memory_order_release);
     }
 
     // Subscribe to technical errors (serialization/dispatch) for this participant.
@@ -50,44 +62,29 @@ public:
     }
 
     // Process incoming data from the transport.
-    // @return The result code from ITransport::Receive.
+    // Waits for one message, then dispatches every further message the transport
+    // already holds (see ITransport::HasPending()) in the same call, reusing one
+    // stream. A batching transport thus delivers a whole recvmmsg() burst per call.
+    // If the transport supports ITransport::ReceiveView(), each payload is
+    // deserialized where it lies in the transport buffer instead (no stream copy).
+    // @return The result code from ITransport::Receive for the first message.
     int ProcessIncoming() {
+        if (m_transport->SupportsReceiveView())
+            return ProcessIncomingView();
+
         dmq::xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
         dmq::transport::DmqHeader header;
-        dmq::IRemoteInvoker* invoker = nullptr;
 
         int result = m_transport->Receive(is, header);
-        if (result == 0) {
-            // Validate header marker
-            if (header.GetMarker() != dmq::transport::DmqHeader::MARKER) {
-                return -1; // Protocol error
-            }
-
-            dmq::DelegateRemoteId id = header.GetId();
-            uint16_t seqNum = header.GetSeqNum();
-
-            // Filter out duplicate messages (retries)
-            if (id != dmq::ACK_REMOTE_ID) {
-                std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
-                if (m_history[id].is_duplicate(seqNum)) {
-                    return 0; // Silently drop duplicate
-                }
-            }
-
-            std::shared_ptr<void> channelLifetime; // keeps channel alive across lock gap
-            {
-                std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
-                auto it = m_channels.find(id);
-                if (it != m_channels.end()) {
-                    channelLifetime = it->second.channel;
-                    invoker = it->second.invoker;
-                }
-            }
-
-            // Invoke outside the lock to prevent deadlocks and allow re-entry
-            if (invoker) {
-                invoker->Invoke(is);
-            }
+        if (result != 0)
+            return result;
+        result = Dispatch(is, header);
+
+        while (m_transport->HasPending()) {
+            is.str("");
+            is.clear();
+            if (m_transport->Receive(is, header) == 0)
+                Dispatch(is, header);
         }
         return result;
     }
@@ -101,13 +98,7 @@ public:
         if (GetRemoteId(topic, remoteId)) {
             auto channel = GetOrCreateChannel<T>(remoteId, serializer);
             if (channel) {
-                if (m_sendThread) {
-                    auto ch = channel;
-                    T d = data;
-                    (void)dmq::MakeDelegate([ch, d]() { (*ch)(d); }, *m_sendThread).AsyncInvoke();
-                } else {
-                    (*channel)(data);
-                }
+                SendChannel<T>(channel, data);
             }
         }
     }
@@ -116,7 +107,7 @@ public:
     template <typename T>
     void RegisterHandler(dmq::DelegateRemoteId remoteId, dmq::ISerializer<void(T)>& serializer, std::function<void(T)> func) {
         std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
-        auto channel = std::make_shared<dmq::RemoteChannel<void(T)>>(*m_transport, serializer);
+        auto channel = MakeChannel<T>(serializer);
 
         // Use Bind() to register the callback for incoming calls.
         channel->Bind(func, remoteId);
@@ -131,7 +122,7 @@ public:
     template <typename T, typename F, typename = std::enable_if_t<dmq::trait::is_callable<F>::value>>
     void RegisterHandler(dmq::DelegateRemoteId remoteId, dmq::ISerializer<void(T)>& serializer, F&& func) {
         std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
-        auto channel = std::make_shared<dmq::RemoteChannel<void(T)>>(*m_transport, serializer);
+        auto channel = MakeChannel<T>(serializer);
 
         // Use Bind() to register the callback for incoming calls.
         channel->Bind(std::forward<F>(func), remoteId);
@@ -143,6 +134,38 @@ public:
     }
 
 private:
+    // Send data on an already resolved channel. Used by DataBus topic handles,
+    // which cache the channel and skip the topic name lookup.
+    template <typename T>
+    void SendChannel(const std::shared_ptr<dmq::RemoteChannel<void(T)>>& channel, const T& data) {
+        if (m_sendThread) {
+            auto ch = channel;
+            T d = data;
+            (void)dmq::MakeDelegate([ch, d]() { (*ch)(d); }, *m_sendThread).AsyncInvoke();
+        } else {
+            (*channel)(data);
+        }
+    }
+
+    // Send a payload serialized once by the DataBus for several participants.
+    // The buffer is shared with the other participants and must not be modified.
+    template <typename T>
+    void SendSerialized(const std::shared_ptr<dmq::RemoteChannel<void(T)>>& channel, const std::shared_ptr<const dmq::ByteBuffer>& payload) {
+        if (m_sendThread) {
+            auto ch = channel;
+            auto buf = payload;
+            (void)dmq::MakeDelegate([ch, buf]() { ch->SendSerialized(*buf); }, *m_sendThread).AsyncInvoke();
+        } else {
+            channel->SendSerialized(*payload);
+        }
+    }
+
+    // Incremented when the topic to remote ID mapping changes. DataBus topic
+    // handles compare it to detect a stale cached route.
+    uint32_t GetTopicVersion() const {
+        return m_topicVersion.load(std::memory_order_acquire);
+    }
+
     // Get the remote ID for a topic.
     bool GetRemoteId(const std::string& topic, dmq::DelegateRemoteId& remoteId) {
         std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
@@ -163,6 +186,13 @@ private:
         return false;
     }
 
+    template <typename T>
+    std::shared_ptr<dmq::RemoteChannel<void(T)>> MakeChannel(dmq::ISerializer<void(T)>& serializer) {
+        if (m_dispatcher)
+            return std::make_shared<dmq::RemoteChannel<void(T)>>(*m_dispatcher, serializer);
+        return std::make_shared<dmq::RemoteChannel<void(T)>>(*m_transport, serializer);
+    }
+
     template <typename T>
     void AttachErrorHandler(std::shared_ptr<dmq::RemoteChannel<void(T)>>& channel) {
         channel->SetErrorHandler(dmq::MakeDelegate([this](dmq::DelegateRemoteId id, dmq::DelegateError error, dmq::DelegateErrorAux) {
@@ -193,6 +223,93 @@ private:
         m_reportedErrors.clear();
     }
 
+    // Zero-copy variant of ProcessIncoming(). Each view is dispatched before the
+    // next receive call invalidates it.
+    int ProcessIncomingView() {
+        dmq::transport::TransportBuffer payload;
+        dmq::transport::DmqHeader header;
+
+        int result = m_transport->ReceiveView(payload, header);
+        if (result != 0)
+            return result;
+        dmq::ByteSpan span(payload.data, payload.size);
+        result = Dispatch(span, header);
+
+        while (m_transport->HasPending()) {
+            if (m_transport->ReceiveView(payload, header) == 0) {
+                dmq::ByteSpan next(payload.data, payload.size);
+                Dispatch(next, header);
+            }
+        }
+        return result;
+    }
+
+    // Unpack a batch frame held in a stream or viewed in place
+    template <typename Handler>
+    static int UnpackBatch(dmq::xstringstream& is, Handler&& handler) {
+        return dmq::transport::UnpackBatch(is, std::forward<Handler>(handler));
+    }
+
+    template <typename Handler>
+    static int UnpackBatch(dmq::ByteSpan& span, Handler&& handler) {
+        dmq::transport::TransportBuffer frame;
+        frame.data = span.ReadData();
+        frame.size = span.Remaining();
+        return dmq::transport::UnpackBatch(frame, std::forward<Handler>(handler));
+    }
+
+    // Invoke a channel with a payload held in a stream or viewed in place
+    static void Invoke(dmq::IRemoteInvoker& invoker, std::istream& is) { invoker.Invoke(is); }
+    static void Invoke(dmq::IRemoteInvoker& invoker, dmq::ByteSpan& span) { invoker.InvokeSpan(span); }
+
+    // Route one received message to its channel. `Source` is the received payload:
+    // an `xstringstream`, or a `ByteSpan` over the transport buffer.
+    // @return 0 if handled or dropped as a duplicate, -1 on a protocol error.
+    template <typename Source>
+    int Dispatch(Source& source, const dmq::transport::DmqHeader& header) {
+        // Validate header marker
+        if (header.GetMarker() != dmq::transport::DmqHeader::MARKER) {
+            return -1; // Protocol error
+        }
+
+        dmq::DelegateRemoteId id = header.GetId();
+        uint32_t seqNum = header.GetSeqNum32();   // 16 bits from a standard header
+
+        // Unpack a frame coalesced by BatchDispatcher; each record is filtered
+        // and routed as if it had arrived on its own
+        if (id == dmq::BATCH_REMOTE_ID) {
+            int records = UnpackBatch(source, [this](const dmq::transport::DmqHeader& h, auto& record) {
+                Dispatch(record, h);
+            });
+            return records < 0 ? -1 : 0;
+        }
+
+        // Filter out duplicate messages (retries)
+        if (id != dmq::ACK_REMOTE_ID) {
+            std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
+            if (m_history[id].is_duplicate(seqNum)) {
+                return 0; // Silently drop duplicate
+            }
+        }
+
+        dmq::IRemoteInvoker* invoker = nullptr;
+        std::shared_ptr<void> channelLifetime; // keeps channel alive across lock gap
+        {
+            std::lock_guard<dmq::RecursiveMutex> lock(m_mutex);
+            auto it = m_channels.find(id);
+            if (it != m_channels.end()) {
+                channelLifetime = it->second.channel;
+                invoker = it->second.invoker;
+            }
+        }
+
+        // Invoke outside the lock to prevent deadlocks and allow re-entry
+        if (invoker) {
+            Invoke(*invoker, source);
+        }
+        return 0;
+    }
+
     struct ChannelInvoker {
         std::shared_ptr<void> channel;
         dmq::IRemoteInvoker* invoker = nullptr;
@@ -213,7 +330,7 @@ private:
             }
             channel = std::static_pointer_cast<dmq::RemoteChannel<void(T)>>(it->second.channel);
         } else {
-            channel = std::make_shared<dmq::RemoteChannel<void(T)>>(*m_transport, serializer);
+            channel = MakeChannel<T>(serializer);
 
             // Establish the remote ID for sending via operator().
             channel->SetRemoteId(remoteId);
@@ -230,8 +347,10 @@ private:
 
     dmq::transport::ITransport* m_transport;
     dmq::IThread* m_sendThread = nullptr;
+    dmq::IDispatcher* m_dispatcher = nullptr;
     dmq::RecursiveMutex m_mutex;
     xmap<std::string, dmq::DelegateRemoteId> m_topicToRemoteId;
+    std::atomic<uint32_t> m_topicVersion{ 0 };
     xmap<dmq::DelegateRemoteId, ChannelInvoker> m_channels;
     xmap<dmq::DelegateRemoteId, std::type_index> m_channelTypes;
     xmap<std::string, uint8_t> m_reportedErrors;
@@ -240,12 +359,12 @@ private:
     // --- Duplicate Filtering ---
     struct SeqHistory {
         static constexpr size_t SIZE = DMQ_SEQ_HISTORY_SIZE;
-        uint16_t buffer[SIZE];
+        uint32_t buffer[SIZE];
         size_t head = 0;
 
-        SeqHistory() { std::fill(buffer, buffer + SIZE, uint16_t(0xFFFF)); }
+        SeqHistory() { std::fill(buffer, buffer + SIZE, uint32_t(0xFFFFFFFF)); }
 
-        bool is_duplicate(uint16_t seq) {
+        bool is_duplicate(uint32_t seq) {
             for (size_t i = 0; i < SIZE; ++i) {
                 if (buffer[i] == seq) return true;
             }
@@ -0,0 +1,193 @@
+#ifndef BATCH_DISPATCHER_H
+#define BATCH_DISPATCHER_H
+
+/// @file BatchDispatcher.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief An opt-in dispatcher that coalesces small messages into one transport frame.
+///
+/// @details
+/// `Dispatcher` sends every remote invocation as its own transport message. For
+/// chatty topics carrying a few bytes each, the per-message header and system call
+/// dominate. `BatchDispatcher` instead appends each message as a record (wire header
+/// plus payload, see `BatchFrame.h`) to a pending frame and sends the frame with the
+/// reserved ID `dmq::BATCH_REMOTE_ID` when:
+///
+/// 1. **Size:** the next record would push the frame past `SetMaxFrameSize()`.
+/// 2. **Delay:** the oldest pending record has waited `SetMaxDelay()`. The delay
+///    is driven by a one-shot `dmq::util::Timer`, so `Timer::ProcessTimers()` must
+///    be called periodically.
+/// 3. **Explicit:** the application calls `Flush()`.
+///
+/// Records keep their own remote ID and sequence number. `Participant` and
+/// `NetworkEngine` unpack batch frames transparently, so the receiver needs no
+/// configuration. A message too large for a frame of its own is sent unbatched.
+///
+/// **Usage:**
+/// @code
+///   BatchDispatcher dispatcher;
+///   dispatcher.SetTransport(&transport);
+///   dispatcher.SetMaxDelay(std::chrono::milliseconds(5));
+///   remoteDelegate.SetDispatcher(&dispatcher);
+/// @endcode
+///
+/// @note `Dispatch()` reports success once a message is queued. Transport errors
+/// for a deferred flush are returned by `Flush()` only. Transport status
+/// callbacks (e.g. `TransportMonitor`) report the frame under `BATCH_REMOTE_ID`.
+/// Records still pending when the dispatcher is destroyed are flushed, so the
+/// transport must outlive the dispatcher.
+
+#include "delegate/IDispatcher.h"
+#include "port/transport/DmqHeader.h"
+#include "port/transport/ITransport.h"
+#include "port/transport/BatchFrame.h"
+#include "extras/util/Timer.h"
+
+namespace dmq {
+
+/// @brief Dispatcher packing several messages into each transport frame.
+class BatchDispatcher : public dmq::IDispatcher
+{
+public:
+    /// Default frame size limit; fits a typical Ethernet MTU with UDP/IP headers.
+    static const size_t DEFAULT_MAX_FRAME_SIZE = 1400;
+
+    BatchDispatcher()
+    {
+        m_timerConn = m_timer.OnExpired.Connect(dmq::MakeDelegate(this, &BatchDispatcher::OnTimer));
+    }
+
+    ~BatchDispatcher()
+    {
+        Flush();
+        m_timer.Stop();
+        m_timerConn.Disconnect();
+    }
+
+    void SetTransport(transport::ITransport* transport)
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_lock);
+        m_transport = transport;
+    }
+
+    /// Set the largest frame sent, including the batch header.
+    /// @param[in] size Frame size limit in bytes.
+    void SetMaxFrameSize(size_t size)
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_lock);
+        m_maxFrameSize = size;
+    }
+
+    /// Set the longest time a queued message waits before the frame is sent.
+    /// @param[in] delay The delay. Zero disables the timer; only size and
+    /// explicit flushes then send the frame.
+    void SetMaxDelay(dmq::Duration delay)
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_lock);
+        m_maxDelay = delay;
+    }
+
+    // Queue argument data held in a stream
+    int Dispatch(std::ostream& os, dmq::DelegateRemoteId id) override
+    {
+        transport::TransportBuffer payload = transport::GetStreamBuffer(os);
+        return Queue(payload, id);
+    }
+
+    // Queue argument data held in a byte buffer
+    int DispatchBuffer(const ByteBuffer& buffer, dmq::DelegateRemoteId id) override
+    {
+        transport::TransportBuffer payload;
+        payload.data = buffer.Data();
+        payload.size = buffer.Size();
+        return Queue(payload, id);
+    }
+
+    /// Send the pending frame now.
+    /// @return 0 if success or nothing was pending.
+    int Flush()
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_lock);
+        return FlushLocked();
+    }
+
+    /// @return The number of messages waiting in the pending frame.
+    size_t GetPendingCount()
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_lock);
+        return m_pendingCount;
+    }
+
+private:
+    int Queue(const transport::TransportBuffer& payload, dmq::DelegateRemoteId id)
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_lock);
+        if (!m_transport)
+            return -1;
+
+        const uint16_t seqNum = transport::DmqHeader::GetNextSeqNum();
+        const size_t recordSize = transport::DmqHeader::HEADER_SIZE + payload.size;
+
+        // Too large to share a frame: keep ordering and send it on its own
+        if (transport::DmqHeader::HEADER_SIZE + recordSize > m_maxFrameSize)
+            return SendUnbatched(payload, id, seqNum);
+
+        int err = 0;
+        if (transport::DmqHeader::HEADER_SIZE + m_frame.size() + recordSize > m_maxFrameSize)
+            err = FlushLocked();
+
+        // Payload exceeds the 16-bit record length (only with a frame size above 64 KB)
+        if (transport::AppendBatchRecord(m_frame, id, seqNum, &payload, 1) != 0)
+        {
+            int sendErr = SendUnbatched(payload, id, seqNum);
+            return sendErr != 0 ? sendErr : err;
+        }
+
+        if (m_pendingCount++ == 0 && m_maxDelay > dmq::Duration(0))
+            m_timer.Start(m_maxDelay, true);
+        return err;
+    }
+
+    /// Send the pending frame, then the message in a frame of its own.
+    int SendUnbatched(const transport::TransportBuffer& payload, dmq::DelegateRemoteId id, uint16_t seqNum)
+    {
+        int err = FlushLocked();
+        int sendErr = m_transport->SendBuffers(transport::DmqHeader(id, seqNum), &payload, 1);
+        LOG_INFO("BatchDispatcher::Dispatch id={} seqNum={} err={}", id, seqNum, sendErr);
+        return sendErr != 0 ? sendErr : err;
+    }
+
+    int FlushLocked()
+    {
+        if (m_pendingCount == 0)
+            return 0;
+        m_timer.Stop();
+
+        transport::DmqHeader header(dmq::BATCH_REMOTE_ID, transport::DmqHeader::GetNextSeqNum());
+        transport::TransportBuffer frame;
+        frame.data = m_frame.data();
+        frame.size = m_frame.size();
+        int err = m_transport ? m_transport->SendBuffers(header, &frame, 1) : -1;
+        LOG_INFO("BatchDispatcher::Flush records={} seqNum={} err={}", m_pendingCount, header.GetSeqNum(), err);
+
+        m_frame.clear();        // Capacity reused by the next frame
+        m_pendingCount = 0;
+        return err;
+    }
+
+    void OnTimer() { Flush(); }
+
+    transport::ITransport* m_transport = nullptr;
+    size_t m_maxFrameSize = DEFAULT_MAX_FRAME_SIZE;
+    dmq::Duration m_maxDelay = std::chrono::milliseconds(2);
+    dmq::xstring m_frame;
+    size_t m_pendingCount = 0;
+    dmq::Mutex m_lock;
+    dmq::util::Timer m_timer;
+    dmq::ScopedConnection m_timerConn;
+};
+
+} // namespace dmq
+
+#endif // BATCH_DISPATCHER_H
@@ -15,9 +15,12 @@
 /// 1. **Message Construction:** Creates the protocol header (`DmqHeader`) containing 
 ///    the Remote ID and a monotonic Sequence Number.
 /// 2. **Stream Management:** Validates that the output stream is compatible 
-///    (expects `xostringstream`).
+///    (expects `xostringstream`). A `ByteBuffer` payload is sent directly with
+///    `ITransport::SendBuffers()`.
 /// 3. **Dispatch:** Forwards the header and the serialized payload (stream) to the 
-///    registered `ITransport::Send()` method.
+///    registered `ITransport::Send()` method. If the transport supports buffer sends,
+///    the payload is passed in place with `ITransport::SendBuffers()` instead, avoiding
+///    the stream copies.
 /// 
 /// **Usage:**
 /// This class is typically used internally by `DelegateRemote` to finalize a remote 
@@ -50,7 +53,35 @@ public:
         if (m_transport)
         {
             transport::DmqHeader header(id, transport::DmqHeader::GetNextSeqNum());
-            int err = m_transport->Send(*ss, header);
+            int err;
+            if (m_transport->SupportsBufferSend())
+            {
+                // Send the serialized bytes directly from the stream's buffer
+                transport::TransportBuffer payload = transport::GetStreamBuffer(*ss);
+                err = m_transport->SendBuffers(header, &payload, 1);
+            }
+            else
+            {
+                err = m_transport->Send(*ss, header);
+            }
+            LOG_INFO("Dispatcher::Dispatch id={} seqNum={} err={}", header.GetId(), header.GetSeqNum(), err);
+            return err;
+        }
+        return -1;
+    }
+
+    // Send argument data held in a byte buffer to the transport
+    int DispatchBuffer(const ByteBuffer& buffer, dmq::DelegateRemoteId id) override
+    {
+        if (m_transport)
+        {
+            transport::DmqHeader header(id, transport::DmqHeader::GetNextSeqNum());
+            transport::TransportBuffer payload;
+            payload.data = buffer.Data();
+            payload.size = buffer.Size();
+
+            // Transports without a gather send copy the bytes into a stream
+            int err = m_transport->SendBuffers(header, &payload, 1);
             LOG_INFO("Dispatcher::Dispatch id={} seqNum={} err={}", header.GetId(), header.GetSeqNum(), err);
             return err;
         }
@@ -51,8 +51,10 @@ class RemoteChannel; // Not defined
 /// function signature. The canonical way to configure a remote endpoint.
 ///
 /// @details `RemoteChannel` is the single object a user needs to declare per message
-/// signature. It owns the `Dispatcher`, the serialization stream, and the internal
-/// `DelegateFunctionRemote` that handles both sending and receiving.
+/// signature. It owns the `Dispatcher`, the serialization buffer, and the internal
+/// `DelegateFunctionRemote` that handles both sending and receiving. Arguments are
+/// serialized into a reusable `ByteBuffer` and dispatched in place; the legacy
+/// `xostringstream` is kept for code that calls `GetStream()`.
 ///
 /// **Usage pattern (preferred):**
 /// @code
@@ -94,9 +96,22 @@ public:
         , m_serializer(&serializer)
     {
         m_dispatcher.SetTransport(&transport);
-        m_delegate.SetDispatcher(&m_dispatcher);
+        m_delegate.SetDispatcher(m_activeDispatcher);
         m_delegate.SetSerializer(m_serializer);
         m_delegate.SetStream(&m_stream);
+        m_delegate.SetBuffer(&m_buffer);
+    }
+
+    /// @brief Construct a RemoteChannel that sends through a caller-supplied dispatcher,
+    /// e.g. a `BatchDispatcher` shared by several channels.
+    /// @param[in] dispatcher The dispatcher, already connected to a transport. Caller owns it.
+    /// @param[in] serializer The serializer matching the delegate signature. Caller owns it.
+    RemoteChannel(dmq::IDispatcher& dispatcher, dmq::ISerializer<RetType(Args...)>& serializer)
+        : m_stream(std::ios::in | std::ios::out | std::ios::binary)
+        , m_activeDispatcher(&dispatcher)
+        , m_serializer(&serializer)
+    {
+        ReconnectDelegate();
     }
 
     ~RemoteChannel() = default;
@@ -149,12 +164,22 @@ public:
     /// @pre Bind() must have been called first.
     void operator()(Args... args) { m_delegate(std::forward<Args>(args)...); }
 
+    /// @brief Send argument data already serialized with a serializer compatible
+    /// with this channel's. Lets one serialization be sent on several channels.
+    /// @param[in] payload The serialized function arguments.
+    void SendSerialized(const ByteBuffer& payload) { m_delegate.DispatchSerialized(payload); }
+
     /// @brief Register an error handler delegate.
     template<class Handler>
     void SetErrorHandler(Handler&& handler) {
         m_delegate.SetErrorHandler(std::forward<Handler>(handler));
     }
 
+    /// @brief Deserialize received messages into argument objects kept by the channel,
+    /// reusing container capacity between messages. See `DelegateFreeRemote::SetReuseArgs()`.
+    /// @param[in] reuse `true` to reuse the argument storage.
+    void SetReuseArgs(bool reuse) { m_delegate.SetReuseArgs(reuse); }
+
     /// @brief Set the remote ID for outbound messages.
     /// @param[in] id The remote delegate identifier.
     void SetRemoteId(DelegateRemoteId id) noexcept { m_delegate.SetRemoteId(id); }
@@ -174,7 +199,7 @@ public:
     // -----------------------------------------------------------------------
 
     /// @internal Used by MakeDelegate overloads. Prefer Bind() in application code.
-    dmq::IDispatcher* GetDispatcher() noexcept { return &m_dispatcher; }
+    dmq::IDispatcher* GetDispatcher() noexcept { return m_activeDispatcher; }
 
     /// @internal Used by MakeDelegate overloads. Prefer Bind() in application code.
     dmq::ISerializer<RetType(Args...)>* GetSerializer() noexcept { return m_serializer; }
@@ -182,15 +207,21 @@ public:
     /// @internal Used by MakeDelegate overloads. Prefer Bind() in application code.
     dmq::xostringstream& GetStream() noexcept { return m_stream; }
 
+    /// @internal Used by MakeDelegate overloads. Prefer Bind() in application code.
+    dmq::ByteBuffer& GetBuffer() noexcept { return m_buffer; }
+
 private:
     void ReconnectDelegate() {
-        m_delegate.SetDispatcher(&m_dispatcher);
+        m_delegate.SetDispatcher(m_activeDispatcher);
         m_delegate.SetSerializer(m_serializer);
         m_delegate.SetStream(&m_stream);
+        m_delegate.SetBuffer(&m_buffer);
     }
 
     Dispatcher m_dispatcher;
     dmq::xostringstream m_stream;
+    dmq::IDispatcher* m_activeDispatcher = &m_dispatcher;
+    dmq::ByteBuffer m_buffer;
     dmq::ISerializer<RetType(Args...)>* m_serializer = nullptr;
     DelegateFunctionRemote<RetType(Args...)> m_delegate;
 };
@@ -219,6 +250,7 @@ auto MakeDelegate(RetType(*func)(Args...), DelegateRemoteId id, RemoteChannel<Re
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -235,6 +267,7 @@ auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args...), DelegateRemo
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -251,6 +284,7 @@ auto MakeDelegate(TClass* object, RetType(TClass::* func)(Args...) const, Delega
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -267,6 +301,7 @@ auto MakeDelegate(const TClass* object, RetType(TClass::* func)(Args...) const,
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -283,6 +318,7 @@ auto MakeDelegate(std::shared_ptr<TClass> object, RetType(TClass::* func)(Args..
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -299,6 +335,7 @@ auto MakeDelegate(std::shared_ptr<TClass> object, RetType(TClass::* func)(Args..
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -314,6 +351,7 @@ auto MakeDelegate(std::function<RetType(Args...)> func, DelegateRemoteId id, Rem
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -325,6 +363,7 @@ auto MakeDelegate(F&& func, DelegateRemoteId id, RemoteChannel<Sig>& channel)
     d.SetDispatcher(channel.GetDispatcher());
     d.SetSerializer(channel.GetSerializer());
     d.SetStream(&channel.GetStream());
+    d.SetBuffer(&channel.GetBuffer());
     return d;
 }
 
@@ -0,0 +1,93 @@
+#include "AllocatorMonitor.h"
+#include "DelegateMQ.h"
+
+#if defined(DMQ_DATABUS) && defined(DMQ_ALLOCATOR)
+
+#include "extras/allocator/xallocator.h"
+
+namespace dmq::util {
+
+AllocatorMonitor::~AllocatorMonitor() {
+    Disable();
+}
+
+void AllocatorMonitor::Enable(const std::string& topic, const std::string& cpuName) {
+    auto& instance = GetInstance();
+    if (instance.m_enabled.exchange(true)) return;
+
+    instance.m_topic = topic;
+    instance.m_cpuName = cpuName;
+    instance.m_previous = {};
+    instance.m_previousTime = std::chrono::steady_clock::now();
+    instance.m_monitorThread = std::make_unique<dmq::os::Thread>("AllocatorMonitor", 10);
+    instance.m_monitorThread->CreateThread();
+
+    (void)dmq::MakeDelegate(&instance, &AllocatorMonitor::MonitorLoop, *instance.m_monitorThread).AsyncInvoke();
+}
+
+void AllocatorMonitor::Disable() {
+    auto& instance = GetInstance();
+    if (!instance.m_enabled.exchange(false)) return;
+
+    if (instance.m_monitorThread) {
+        instance.m_monitorThread->ExitThread();
+        instance.m_monitorThread.reset();
+    }
+}
+
+void AllocatorMonitor::MonitorLoop() {
+    if (!m_enabled) return;
+
+    std::array<XallocStats, MAX_SIZE_CLASSES> snapshots;
+    size_t snapshotCount = xalloc_get_stats(snapshots.data(), snapshots.size());
+
+    auto now = std::chrono::steady_clock::now();
+    float seconds = std::chrono::duration<float>(now - m_previousTime).count();
+    m_previousTime = now;
+
+    for (size_t i = 0; i < snapshotCount; ++i) {
+        const auto& s = snapshots[i];
+
+        // Size classes are created on demand, so match on block size
+        Previous* prev = nullptr;
+        for (auto& p : m_previous) {
+            if (p.block_size == s.blockSize || p.block_size == 0) {
+                prev = &p;
+                break;
+            }
+        }
+
+        AllocatorStatsPacket packet;
+        packet.cpu_name = m_cpuName;
+        packet.block_size = (uint32_t)s.blockSize;
+        packet.max_blocks = s.maxBlocks;
+        packet.block_count = s.blockCount;
+        packet.blocks_in_use = s.blocksInUse;
+        packet.blocks_in_use_max = s.blocksInUseMax;
+        packet.exhausted_count = s.exhaustedCount;
+        packet.alloc_rate = 0.0f;
+        packet.free_rate = 0.0f;
+        packet.allocations = s.allocations;
+
+        if (prev) {
+            if (prev->block_size != 0 && seconds > 0.0f) {
+                packet.alloc_rate = (s.allocations - prev->allocations) / seconds;
+                packet.free_rate = (s.deallocations - prev->deallocations) / seconds;
+            }
+            prev->block_size = s.blockSize;
+            prev->allocations = s.allocations;
+            prev->deallocations = s.deallocations;
+        }
+
+        dmq::databus::DataBus::Publish(m_topic, packet);
+    }
+
+    if (m_enabled) {
+        dmq::os::Thread::Sleep(std::chrono::seconds(2));
+        (void)dmq::MakeDelegate(this, &AllocatorMonitor::MonitorLoop, *m_monitorThread).AsyncInvoke();
+    }
+}
+
+} // namespace dmq::util
+
+#endif // DMQ_DATABUS && DMQ_ALLOCATOR
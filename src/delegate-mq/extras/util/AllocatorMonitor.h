@@ -0,0 +1,79 @@
+#ifndef ALLOCATOR_MONITOR_H
+#define ALLOCATOR_MONITOR_H
+
+#include "DelegateMQ.h"
+
+#if defined(DMQ_DATABUS)
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace dmq::util {
+
+/// @brief Packet published to DataBus for fixed-block allocator monitoring. One
+/// packet per xallocator size class.
+struct AllocatorStatsPacket {
+    std::string cpu_name;
+    uint32_t    block_size;
+    uint32_t    max_blocks;         // Pool size, or 0 if blocks come from the heap
+    uint32_t    block_count;        // Blocks created off the heap
+    uint32_t    blocks_in_use;
+    uint32_t    blocks_in_use_max;  // High-water mark since startup
+    uint32_t    exhausted_count;    // Allocations failed on an exhausted pool
+    float       alloc_rate;         // Allocations per second over the last poll
+    float       free_rate;          // Deallocations per second over the last poll
+    uint64_t    allocations;
+};
+
+#if defined(DMQ_ALLOCATOR)
+
+/// @brief Central monitor that polls the xallocator size classes and publishes stats.
+/// @details Mirrors `ThreadMonitor`. The high-water marks from a live load are used
+/// to size `STATIC_POOLS`/`MAX_BLOCKS`.
+class AllocatorMonitor {
+public:
+    /// Enable the monitor (starts the polling thread).
+    /// @param[in] topic The DataBus topic to publish `AllocatorStatsPacket` on.
+    /// @param[in] cpuName The CPU name reported in each packet.
+    static void Enable(const std::string& topic = "AllocatorStats", const std::string& cpuName = "");
+
+    /// Disable the monitor.
+    static void Disable();
+
+private:
+    AllocatorMonitor() = default;
+    ~AllocatorMonitor();
+
+    static AllocatorMonitor& GetInstance() {
+        static AllocatorMonitor instance;
+        return instance;
+    }
+
+    void MonitorLoop();
+
+    static const size_t MAX_SIZE_CLASSES = 32;
+
+    // Totals from the previous poll, to compute rates
+    struct Previous {
+        size_t block_size = 0;
+        uint32_t allocations = 0;
+        uint32_t deallocations = 0;
+    };
+    std::array<Previous, MAX_SIZE_CLASSES> m_previous{};
+    std::chrono::steady_clock::time_point m_previousTime;
+
+    std::unique_ptr<dmq::os::Thread> m_monitorThread;
+    std::atomic<bool> m_enabled{false};
+    std::string m_topic;
+    std::string m_cpuName;
+};
+
+#endif // DMQ_ALLOCATOR
+
+} // namespace dmq::util
+
+#endif // DMQ_DATABUS
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef ALLOCATOR_MONITOR_SER_H
+#define ALLOCATOR_MONITOR_SER_H
+
+#include "AllocatorMonitor.h"
+#include "port/serialize/serialize/msg_serialize.h"
+#include <iomanip>
+
+namespace dmq::util {
+
+/// @brief Serializer for AllocatorStatsPacket.
+class AllocatorStatsPacketSerializer : public dmq::ISerializer<void(AllocatorStatsPacket)> {
+public:
+    virtual std::ostream& Write(std::ostream& os, const AllocatorStatsPacket& data) override {
+        serialize s;
+        s.write(os, data.cpu_name);
+        s.write(os, data.block_size);
+        s.write(os, data.max_blocks);
+        s.write(os, data.block_count);
+        s.write(os, data.blocks_in_use);
+        s.write(os, data.blocks_in_use_max);
+        s.write(os, data.exhausted_count);
+        s.write(os, data.alloc_rate);
+        s.write(os, data.free_rate);
+        s.write(os, data.allocations);
+        return os;
+    }
+
+    virtual std::istream& Read(std::istream& is, AllocatorStatsPacket& data) override {
+        serialize s;
+        s.read(is, data.cpu_name);
+        s.read(is, data.block_size);
+        s.read(is, data.max_blocks);
+        s.read(is, data.block_count);
+        s.read(is, data.blocks_in_use);
+        s.read(is, data.blocks_in_use_max);
+        s.read(is, data.exhausted_count);
+        s.read(is, data.alloc_rate);
+        s.read(is, data.free_rate);
+        s.read(is, data.allocations);
+        return is;
+    }
+};
+
+/// @brief Stringifier for AllocatorStatsPacket (for DataSpy).
+inline std::string AllocatorStatsPacketToString(const AllocatorStatsPacket& p) {
+    dmq::xstringstream ss;
+    ss << "CPU:" << p.cpu_name << " Block:" << p.block_size
+       << " InUse:" << p.blocks_in_use << "/" << p.blocks_in_use_max;
+    if (p.max_blocks)
+        ss << " Pool:" << p.max_blocks;
+    ss << " Exhausted:" << p.exhausted_count
+       << " Rate(/s):" << std::fixed << std::setprecision(1) << p.alloc_rate << "/" << p.free_rate;
+    const auto str = ss.str();
+    return std::string(str.data(), str.size());
+}
+
+} // namespace dmq::util
+
+#endif
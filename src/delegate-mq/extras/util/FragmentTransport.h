@@ -0,0 +1,464 @@
+#ifndef _FRAGMENT_TRANSPORT_H
+#define _FRAGMENT_TRANSPORT_H
+
+/// @file FragmentTransport.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Fragmentation and reassembly of large messages for datagram transports.
+///
+/// @details
+/// `FragmentTransport` is an `ITransport` decorator, like `ReliableTransport`, that
+/// lets a datagram transport carry messages larger than one datagram:
+///
+/// 1. **Fragmentation**: A message that does not fit in `mtu` bytes is split into
+///    fragments, each sent as its own message with the reserved ID
+///    `dmq::FRAGMENT_REMOTE_ID`. A 20-byte fragment header in the payload carries the
+///    original remote ID and sequence number, the total length and the fragment's
+///    offset and index. Smaller messages pass through unchanged.
+/// 2. **Reassembly**: The receiver copies fragments into one of `REASSEMBLY_SLOTS`
+///    buffers of `maxMessageSize` bytes, allocated up front. `Receive()` returns the
+///    whole message, with its original header, once the last fragment arrives.
+///    Fragments that do not complete a message return -1.
+/// 3. **Timeout**: An incomplete message is dropped once `timeout` passes after its
+///    first fragment, or when its slot is needed for a newer message.
+/// 4. **Selective Retransmission** (optional): With `retransmit` enabled, the sender
+///    keeps its last `RETRANSMIT_HISTORY` fragmented messages, and the receiver
+///    reports missing fragments (a NACK) when a message stalls for `NACK_DELAY`.
+///    Only the missing fragments are resent.
+///
+/// **Usage:**
+/// Both ends must use `FragmentTransport`; a peer without it ignores fragments
+/// because no endpoint is registered for `FRAGMENT_REMOTE_ID`. Call `Process()`
+/// periodically to expire stalled messages and send NACKs. Each `FragmentTransport`
+/// serves one peer. `mtu` must not exceed the wrapped transport's receive buffer
+/// (4096 bytes for the UDP transports).
+///
+/// @verbatim
+///   Application --Send()--> FragmentTransport --fragments--> Physical transport
+///   Application <-Receive()- FragmentTransport <-fragments-- Physical transport
+///                                 |    ^
+///                     Process()   |    | NACK: missing fragment indices
+///                     NACK, expiry v    |
+/// @endverbatim
+
+#include "delegate/DelegateOpt.h"
+#include "delegate/IDispatcher.h"
+#include "port/transport/ITransport.h"
+#include "port/transport/DmqHeader.h"
+#include "extras/util/Fault.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace dmq::util {
+
+/// @brief `ITransport` decorator splitting large messages into datagram-sized fragments.
+class FragmentTransport : public dmq::transport::ITransport
+{
+public:
+    /// Default largest datagram sent, including the DelegateMQ header
+    static const size_t DEFAULT_MTU = 1400;
+
+    /// Default largest message reassembled
+    static const size_t DEFAULT_MAX_MESSAGE_SIZE = 256 * 1024;
+
+    /// Messages reassembled concurrently
+    static const size_t REASSEMBLY_SLOTS = 4;
+
+    /// Fragmented messages kept by the sender for selective retransmission
+    static const size_t RETRANSMIT_HISTORY = 4;
+
+    /// Fragment header size in the fragment payload
+    static const size_t FRAGMENT_HEADER_SIZE = 20;
+
+    /// Smallest `mtu`: both headers and at least one byte of fragment data
+    static const size_t MIN_MTU = dmq::transport::DmqHeader::HEADER_SIZE + FRAGMENT_HEADER_SIZE + 1;
+
+    /// @param[in] transport The physical transport. Must outlive this object.
+    /// @param[in] mtu Largest datagram sent, including the DelegateMQ header. Must be at
+    /// least `MIN_MTU`; a smaller value faults.
+    /// @param[in] maxMessageSize Largest message reassembled. Allocated `REASSEMBLY_SLOTS` times.
+    /// @param[in] timeout Time allowed to receive every fragment of a message.
+    /// @param[in] retransmit Keep sent messages and exchange NACKs for lost fragments.
+    FragmentTransport(dmq::transport::ITransport& transport, size_t mtu = DEFAULT_MTU,
+        size_t maxMessageSize = DEFAULT_MAX_MESSAGE_SIZE,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(1000), bool retransmit = false)
+        : m_transport(transport),
+          m_fragmentSize((mtu < MIN_MTU ? MIN_MTU : mtu) - dmq::transport::DmqHeader::HEADER_SIZE - FRAGMENT_HEADER_SIZE),
+          m_maxMessageSize(maxMessageSize),
+          m_timeout(std::chrono::duration_cast<Micros>(timeout).count()),
+          m_retransmit(retransmit)
+    {
+        ASSERT_TRUE(mtu >= MIN_MTU);
+        for (Reassembly& slot : m_slots) {
+            slot.data.resize(maxMessageSize);
+            slot.received.reserve(maxMessageSize / m_fragmentSize + 1);
+        }
+    }
+
+    FragmentTransport(const FragmentTransport&) = delete;
+    FragmentTransport& operator=(const FragmentTransport&) = delete;
+
+    virtual int Send(dmq::xostringstream& os, const dmq::transport::DmqHeader& header) override
+    {
+        dmq::transport::TransportBuffer payload = dmq::transport::GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    /// Send a message, fragmenting it if it does not fit in one datagram.
+    /// @return 0 on success, -1 if the message is too large or the transport failed.
+    virtual int SendBuffers(const dmq::transport::DmqHeader& header,
+        const dmq::transport::TransportBuffer* buffers, size_t count) override
+    {
+        const size_t size = dmq::transport::GetBufferSize(buffers, count);
+        if (size <= m_fragmentSize + FRAGMENT_HEADER_SIZE || header.GetId() == dmq::ACK_REMOTE_ID)
+            return m_transport.SendBuffers(header, buffers, count);
+
+        const size_t fragments = (size + m_fragmentSize - 1) / m_fragmentSize;
+        if (fragments > UINT16_MAX || size > UINT32_MAX)
+            return -1;
+
+        const dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+
+        // Fragments are cut from one contiguous copy of the payload
+        Sent* sent = nullptr;
+        std::vector<uint8_t>* data = &m_sendScratch;
+        if (m_retransmit) {
+            sent = &m_history[m_historyNext++ % RETRANSMIT_HISTORY];
+            sent->id = header.GetId();
+            sent->seqNum = header.GetSeqNum32();
+            data = &sent->data;
+        }
+        data->resize(size);
+        size_t offset = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (buffers[i].size > 0)
+                memcpy(data->data() + offset, buffers[i].data, buffers[i].size);
+            offset += buffers[i].size;
+        }
+
+        for (size_t index = 0; index < fragments; index++) {
+            if (SendFragment(header.GetId(), header.GetSeqNum32(), *data, index, fragments) != 0) {
+                if (sent)
+                    sent->data.clear();
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    virtual bool SupportsBufferSend() const override { return true; }
+
+    /// Receive the next message from the physical transport.
+    /// @details A fragment completing a message returns the reassembled message with
+    /// its original header. Other fragments and NACKs are consumed and return -1.
+    virtual int Receive(dmq::xstringstream& is, dmq::transport::DmqHeader& header) override
+    {
+        int result = m_transport.Receive(is, header);
+        if (result != 0 || header.GetId() != dmq::FRAGMENT_REMOTE_ID)
+            return result;
+
+        dmq::transport::TransportBuffer payload = dmq::transport::GetStreamBuffer(is);
+        const uint8_t* bytes = static_cast<const uint8_t*>(payload.data);
+        if (payload.size < FRAGMENT_HEADER_SIZE)
+            return -1;
+
+        FragmentHeader frag;
+        ReadFragmentHeader(bytes, frag);
+        if (frag.type == NACK) {
+            ProcessNack(frag, bytes + FRAGMENT_HEADER_SIZE, payload.size - FRAGMENT_HEADER_SIZE);
+            return -1;
+        }
+
+        const dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+        Reassembly* slot = Accept(frag, bytes + FRAGMENT_HEADER_SIZE, payload.size - FRAGMENT_HEADER_SIZE);
+        if (!slot)
+            return -1;
+
+        // Complete: hand out the message in place of the last fragment
+        header = dmq::transport::DmqHeader(slot->id, slot->seqNum, slot->totalLength);
+        is.str("");
+        is.clear();
+        is.write(reinterpret_cast<const char*>(slot->data.data()), slot->totalLength);
+        slot->inUse = false;
+        return 0;
+    }
+
+    virtual bool HasPending() const override { return m_transport.HasPending(); }
+
+    /// Drop expired incomplete messages and send NACKs for stalled ones. Call periodically.
+    void Process()
+    {
+        const int64_t now = Now();
+        std::array<std::vector<uint8_t>, REASSEMBLY_SLOTS>& nacks = m_nackScratch;
+        size_t nackCount = 0;
+        {
+            const dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+            for (Reassembly& slot : m_slots) {
+                if (!slot.inUse)
+                    continue;
+                if (now - slot.firstTime >= m_timeout) {
+                    slot.inUse = false;
+                    m_dropped++;
+                } else if (m_retransmit && now - slot.lastTime >= NACK_DELAY && slot.nacks < MAX_NACKS) {
+                    slot.lastTime = now;
+                    slot.nacks++;
+                    BuildNack(slot, nacks[nackCount++]);
+                }
+            }
+        }
+        for (size_t i = 0; i < nackCount; i++) {
+            dmq::transport::TransportBuffer payload;
+            payload.data = nacks[i].data();
+            payload.size = nacks[i].size();
+            m_transport.SendBuffers(dmq::transport::DmqHeader(dmq::FRAGMENT_REMOTE_ID,
+                dmq::transport::DmqHeader::GetNextSeqNum()), &payload, 1);
+        }
+    }
+
+    /// @return Incomplete messages dropped on timeout or slot reuse.
+    uint32_t GetDroppedCount() const
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+        return m_dropped;
+    }
+
+private:
+    using Micros = std::chrono::microseconds;
+
+    /// Receiver idle time before missing fragments are reported (microseconds)
+    static constexpr int64_t NACK_DELAY = 20000;
+
+    /// NACKs sent per message before waiting out the timeout
+    static const int MAX_NACKS = 3;
+
+    enum Type : uint8_t { DATA = 0, NACK = 1 };
+
+    /// Wire layout (Network Byte Order): type(1) reserved(1) id(2) seqNum(4)
+    /// totalLength(4) offset(4) index(2) count(2). A NACK sets type only with
+    /// id and seqNum, followed by the missing indices (2 bytes each).
+    struct FragmentHeader
+    {
+        uint8_t type = DATA;
+        uint16_t id = 0;
+        uint32_t seqNum = 0;
+        uint32_t totalLength = 0;
+        uint32_t offset = 0;
+        uint16_t index = 0;
+        uint16_t count = 0;
+    };
+
+    struct Reassembly
+    {
+        bool inUse = false;
+        uint16_t id = 0;
+        uint32_t seqNum = 0;
+        uint32_t totalLength = 0;
+        uint16_t count = 0;
+        uint16_t receivedCount = 0;
+        size_t stride = 0;                  // Sender's fragment size
+        std::vector<uint8_t> data;          // Preallocated to maxMessageSize
+        std::vector<uint8_t> received;      // Per fragment: 1 if received
+        int64_t firstTime = 0;
+        int64_t lastTime = 0;
+        int nacks = 0;
+    };
+
+    struct Sent
+    {
+        uint16_t id = 0;
+        uint32_t seqNum = 0;
+        std::vector<uint8_t> data;          // Capacity reused across sends
+    };
+
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<Micros>(dmq::Clock::now().time_since_epoch()).count();
+    }
+
+    static void Put(uint8_t*& out, uint32_t value, size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; i++)
+            *out++ = static_cast<uint8_t>(value >> (8 * (bytes - 1 - i)));
+    }
+
+    static uint32_t Get(const uint8_t*& in, size_t bytes)
+    {
+        uint32_t value = 0;
+        for (size_t i = 0; i < bytes; i++)
+            value = (value << 8) | *in++;
+        return value;
+    }
+
+    static void WriteFragmentHeader(const FragmentHeader& frag, uint8_t* out)
+    {
+        Put(out, frag.type, 1);
+        Put(out, 0, 1);
+        Put(out, frag.id, 2);
+        Put(out, frag.seqNum, 4);
+        Put(out, frag.totalLength, 4);
+        Put(out, frag.offset, 4);
+        Put(out, frag.index, 2);
+        Put(out, frag.count, 2);
+    }
+
+    static void ReadFragmentHeader(const uint8_t* in, FragmentHeader& frag)
+    {
+        frag.type = static_cast<uint8_t>(Get(in, 1));
+        Get(in, 1);
+        frag.id = static_cast<uint16_t>(Get(in, 2));
+        frag.seqNum = Get(in, 4);
+        frag.totalLength = Get(in, 4);
+        frag.offset = Get(in, 4);
+        frag.index = static_cast<uint16_t>(Get(in, 2));
+        frag.count = static_cast<uint16_t>(Get(in, 2));
+    }
+
+    /// Send one fragment of a message. Called with m_sendLock held.
+    int SendFragment(uint16_t id, uint32_t seqNum, const std::vector<uint8_t>& data, size_t index, size_t count)
+    {
+        FragmentHeader frag;
+        frag.id = id;
+        frag.seqNum = seqNum;
+        frag.totalLength = static_cast<uint32_t>(data.size());
+        frag.offset = static_cast<uint32_t>(index * m_fragmentSize);
+        frag.index = static_cast<uint16_t>(index);
+        frag.count = static_cast<uint16_t>(count);
+
+        uint8_t fragHeader[FRAGMENT_HEADER_SIZE];
+        WriteFragmentHeader(frag, fragHeader);
+
+        dmq::transport::TransportBuffer buffers[2];
+        buffers[0].data = fragHeader;
+        buffers[0].size = sizeof(fragHeader);
+        buffers[1].data = data.data() + frag.offset;
+        buffers[1].size = (std::min)(m_fragmentSize, data.size() - frag.offset);
+
+        dmq::transport::DmqHeader header(dmq::FRAGMENT_REMOTE_ID, dmq::transport::DmqHeader::GetNextSeqNum());
+        return m_transport.SendBuffers(header, buffers, 2);
+    }
+
+    /// Resend the fragments a receiver reported missing.
+    void ProcessNack(const FragmentHeader& frag, const uint8_t* indices, size_t size)
+    {
+        if (!m_retransmit)
+            return;
+        const dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        for (Sent& sent : m_history) {
+            if (sent.data.empty() || sent.id != frag.id || sent.seqNum != frag.seqNum)
+                continue;
+            const size_t count = (sent.data.size() + m_fragmentSize - 1) / m_fragmentSize;
+            for (size_t i = 0; i + 2 <= size; i += 2) {
+                const uint8_t* p = indices + i;
+                const size_t index = Get(p, 2);
+                if (index < count)
+                    SendFragment(sent.id, sent.seqNum, sent.data, index, count);
+            }
+            return;
+        }
+    }
+
+    /// Copy a fragment into its reassembly slot. Called with m_recvLock held.
+    /// @return The slot if the fragment completed the message, otherwise `nullptr`.
+    Reassembly* Accept(const FragmentHeader& frag, const uint8_t* data, size_t size)
+    {
+        if (frag.totalLength > m_maxMessageSize || frag.count == 0 || frag.index >= frag.count ||
+            static_cast<uint64_t>(frag.offset) + size > frag.totalLength)
+            return nullptr;
+
+        // Fragments are cut at the sender's fragment size: each starts at index times
+        // that size, and only the last is shorter. Anything else would overlap or
+        // leave a gap in the message.
+        const bool last = frag.index + 1 == frag.count;
+        if (last && static_cast<uint64_t>(frag.offset) + size != frag.totalLength)
+            return nullptr;
+        const size_t stride = !last ? size : (frag.index > 0 ? frag.offset / frag.index : 0);
+        if ((!last && stride == 0) || static_cast<uint64_t>(frag.index) * stride != frag.offset)
+            return nullptr;
+
+        const int64_t now = Now();
+        Reassembly* slot = nullptr;
+        Reassembly* oldest = &m_slots[0];
+        for (Reassembly& s : m_slots) {
+            if (s.inUse && s.id == frag.id && s.seqNum == frag.seqNum && s.totalLength == frag.totalLength) {
+                slot = &s;
+                break;
+            }
+            if (!s.inUse ? oldest->inUse : (oldest->inUse && s.firstTime < oldest->firstTime))
+                oldest = &s;
+        }
+
+        if (!slot) {
+            // First fragment of a new message; evict the oldest incomplete one if full
+            slot = oldest;
+            if (slot->inUse)
+                m_dropped++;
+            slot->inUse = true;
+            slot->id = frag.id;
+            slot->seqNum = frag.seqNum;
+            slot->totalLength = frag.totalLength;
+            slot->count = frag.count;
+            slot->stride = stride;
+            slot->receivedCount = 0;
+            slot->received.assign(frag.count, 0);
+            slot->firstTime = now;
+            slot->nacks = 0;
+        }
+        slot->lastTime = now;
+
+        if (frag.count != slot->count || stride != slot->stride || slot->received[frag.index])
+            return nullptr;     // Duplicate or inconsistent fragment
+        slot->received[frag.index] = 1;
+        slot->receivedCount++;
+        if (size > 0)
+            memcpy(slot->data.data() + frag.offset, data, size);
+
+        return slot->receivedCount == slot->count ? slot : nullptr;
+    }
+
+    /// Build a NACK listing a slot's missing fragments. Called with m_recvLock held.
+    void BuildNack(const Reassembly& slot, std::vector<uint8_t>& nack)
+    {
+        const size_t maxIndices = m_fragmentSize / 2;
+        nack.resize(FRAGMENT_HEADER_SIZE);
+        FragmentHeader frag;
+        frag.type = NACK;
+        frag.id = slot.id;
+        frag.seqNum = slot.seqNum;
+        WriteFragmentHeader(frag, nack.data());
+        for (size_t i = 0; i < slot.count && (nack.size() - FRAGMENT_HEADER_SIZE) / 2 < maxIndices; i++) {
+            if (slot.received[i])
+                continue;
+            nack.push_back(static_cast<uint8_t>(i >> 8));
+            nack.push_back(static_cast<uint8_t>(i & 0xFF));
+        }
+    }
+
+    dmq::transport::ITransport& m_transport;
+    const size_t m_fragmentSize;        // Message bytes per fragment
+    const size_t m_maxMessageSize;
+    const int64_t m_timeout;            // Reassembly timeout (microseconds)
+    const bool m_retransmit;
+
+    // Sender state; guarded by m_sendLock
+    dmq::Mutex m_sendLock;
+    std::vector<uint8_t> m_sendScratch;
+    std::array<Sent, RETRANSMIT_HISTORY> m_history;
+    size_t m_historyNext = 0;
+
+    // Receiver state; guarded by m_recvLock
+    mutable dmq::Mutex m_recvLock;
+    std::array<Reassembly, REASSEMBLY_SLOTS> m_slots;
+    uint32_t m_dropped = 0;
+
+    // NACK buffers built by Process(); only touched by the Process() caller
+    std::array<std::vector<uint8_t>, REASSEMBLY_SLOTS> m_nackScratch;
+};
+
+} // namespace dmq::util
+
+#endif // _FRAGMENT_TRANSPORT_H
@@ -1,8 +1,9 @@
 #include "NetworkEngine.h"
 #include "extras/util/TimerDelegate.h"
+#include "port/transport/BatchFrame.h"
 
 // Only compile implementation if a compatible transport is selected
-#if defined(DMQ_TRANSPORT_ZEROMQ) || defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP) || defined(DMQ_TRANSPORT_STM32_UART) || defined(DMQ_TRANSPORT_SERIAL_PORT)
+#if defined(DMQ_TRANSPORT_ZEROMQ) || defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP) || defined(DMQ_TRANSPORT_LINUX_URING) || defined(DMQ_TRANSPORT_SHM) || defined(DMQ_TRANSPORT_STM32_UART) || defined(DMQ_TRANSPORT_SERIAL_PORT)
 
 namespace dmq::util {
 
@@ -23,9 +24,9 @@ NetworkEngine::NetworkEngine()
     : m_thread("NetworkEngine"),
     m_transportMonitor(RECV_TIMEOUT),
     m_recvThread("NetworkRecv")
-#if defined(DMQ_TRANSPORT_ZEROMQ)
-    // No extra init needed for ZeroMQ
-#elif defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP)
+#if defined(DMQ_TRANSPORT_ZEROMQ) || defined(DMQ_TRANSPORT_SHM)
+    // No extra init needed for ZeroMQ or shared memory
+#elif defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP) || defined(DMQ_TRANSPORT_LINUX_URING)
     , m_retryMonitor(m_sendTransport, m_transportMonitor)
     , m_reliableTransport(m_sendTransport, m_retryMonitor)
 #elif defined(DMQ_TRANSPORT_STM32_UART)
@@ -89,7 +90,7 @@ int NetworkEngine::Initialize(const std::string& sendAddr, const std::string& re
     return err;
 }
 
-#elif defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP)
+#elif defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP) || defined(DMQ_TRANSPORT_LINUX_URING)
 
 // --------------------------------------------------------
 // UDP Implementation (Windows & Linux)
@@ -107,6 +108,9 @@ int NetworkEngine::Initialize(const std::string& sendIp, int sendPort, const std
 #elif defined(DMQ_TRANSPORT_LINUX_UDP)
     err += m_sendTransport.Create(LinuxUdpTransport::Type::PUB, sendIp.c_str(), sendPort);
     err += m_recvTransport.Create(LinuxUdpTransport::Type::SUB, recvIp.c_str(), recvPort);
+#elif defined(DMQ_TRANSPORT_LINUX_URING)
+    err += m_sendTransport.Create(LinuxUringTransport::Type::PUB, sendIp.c_str(), sendPort);
+    err += m_recvTransport.Create(LinuxUringTransport::Type::SUB, recvIp.c_str(), recvPort);
 #endif
 
     m_statusConn = m_transportMonitor.OnSendStatus.Connect(dmq::MakeDelegate(this, &NetworkEngine::InternalStatusHandler));
@@ -123,6 +127,34 @@ int NetworkEngine::Initialize(const std::string& sendIp, int sendPort, const std
     return err;
 }
 
+#elif defined(DMQ_TRANSPORT_SHM)
+
+// --------------------------------------------------------
+// Shared Memory Implementation
+// --------------------------------------------------------
+int NetworkEngine::Initialize(const std::string& sendName, const std::string& recvName)
+{
+    if (!m_thread.IsCurrentThread())
+        return dmq::MakeDelegate(this, &NetworkEngine::Initialize, m_thread, dmq::WAIT_INFINITE)(sendName, recvName);
+
+    int err = 0;
+    err += m_sendTransport.Create(ShmTransport::Type::PUB, sendName.c_str());
+    err += m_recvTransport.Create(ShmTransport::Type::SUB, recvName.c_str());
+
+    m_statusConn = m_transportMonitor.OnSendStatus.Connect(dmq::MakeDelegate(this, &NetworkEngine::InternalStatusHandler));
+
+    m_sendTransport.SetTransportMonitor(&m_transportMonitor);
+    m_recvTransport.SetTransportMonitor(&m_transportMonitor);
+
+    m_sendTransport.SetRecvTransport(&m_recvTransport);
+    m_recvTransport.SetSendTransport(&m_sendTransport);
+
+    // The ring is lossless, so we DO NOT use ReliableTransport here.
+    m_dispatcher.SetTransport(&m_sendTransport);
+
+    return err;
+}
+
 #elif defined(DMQ_TRANSPORT_STM32_UART)
 
 // --------------------------------------------------------
@@ -268,6 +300,17 @@ void NetworkEngine::RecvThread()
 /// @brief Handles incoming messages on the main Network Thread.
 void NetworkEngine::Incoming(DmqHeader& header, std::shared_ptr<dmq::xstringstream> arg_data)
 {
+    // Unpack a frame coalesced by BatchDispatcher into its individual messages
+    if (header.GetId() == dmq::BATCH_REMOTE_ID) {
+        dmq::transport::UnpackBatch(*arg_data, [this](const DmqHeader& record, dmq::xstringstream& is) {
+            auto it = m_receiveIdMap.find(record.GetId());
+            if (record.GetId() != dmq::ACK_REMOTE_ID && it != m_receiveIdMap.end() && it->second) {
+                it->second->Invoke(is);
+            }
+        });
+        return;
+    }
+
     // Filter out ACKs; we only dispatch application data here.
     if (header.GetId() != dmq::ACK_REMOTE_ID) {
         // Find the registered endpoint for this Message ID
@@ -286,13 +329,13 @@ void NetworkEngine::InternalErrorHandler(dmq::DelegateRemoteId id, dmq::Delegate
     OnError(id, error, aux);
 }
 
-void NetworkEngine::InternalStatusHandler(dmq::DelegateRemoteId id, uint16_t seq, TransportMonitor::Status status) {
+void NetworkEngine::InternalStatusHandler(dmq::DelegateRemoteId id, uint32_t seq, TransportMonitor::Status status) {
     OnStatus(id, seq, status);
 }
 
 // Default virtual implementations
 void NetworkEngine::OnError(dmq::DelegateRemoteId, dmq::DelegateError, dmq::DelegateErrorAux) {}
-void NetworkEngine::OnStatus(dmq::DelegateRemoteId, uint16_t, TransportMonitor::Status) {}
+void NetworkEngine::OnStatus(dmq::DelegateRemoteId, uint32_t, TransportMonitor::Status) {}
 
 } // namespace dmq::util
 
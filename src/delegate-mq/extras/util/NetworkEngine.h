@@ -7,7 +7,7 @@
 #define NETWORK_ENGINE_H
 
 // Only define NetworkEngine if a compatible transport is selected
-#if defined(DMQ_TRANSPORT_ZEROMQ) || defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP) || defined(DMQ_TRANSPORT_STM32_UART) || defined(DMQ_TRANSPORT_SERIAL_PORT)
+#if defined(DMQ_TRANSPORT_ZEROMQ) || defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP) || defined(DMQ_TRANSPORT_LINUX_URING) || defined(DMQ_TRANSPORT_SHM) || defined(DMQ_TRANSPORT_STM32_UART) || defined(DMQ_TRANSPORT_SERIAL_PORT)
 
 #include "delegate/DelegateAsync.h"
 #include "delegate/DelegateAsyncWait.h"
@@ -45,6 +45,12 @@
 #include "port/transport/linux-udp/LinuxUdpTransport.h"
 #include "extras/util/ReliableTransport.h"
 #include "extras/util/RetryMonitor.h"
+#elif defined(DMQ_TRANSPORT_LINUX_URING)
+#include "port/transport/linux-uring/LinuxUringTransport.h"
+#include "extras/util/ReliableTransport.h"
+#include "extras/util/RetryMonitor.h"
+#elif defined(DMQ_TRANSPORT_SHM)
+#include "port/transport/shm/ShmTransport.h"
 #elif defined(DMQ_TRANSPORT_STM32_UART)
 #include "port/transport/stm32-uart/Stm32UartTransport.h"
 #include "extras/util/ReliableTransport.h"
@@ -84,9 +90,12 @@ public:
 #if defined(DMQ_TRANSPORT_ZEROMQ)
     // ZeroMQ uses connection strings (e.g., "tcp://*:5555")
     int Initialize(const std::string& sendAddr, const std::string& recvAddr, bool isServer);
-#elif defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP)
+#elif defined(DMQ_TRANSPORT_WIN32_UDP) || defined(DMQ_TRANSPORT_LINUX_UDP) || defined(DMQ_TRANSPORT_LINUX_URING)
     // UDP requires explicit IP and Port for sending and receiving
     int Initialize(const std::string& sendIp, int sendPort, const std::string& recvIp, int recvPort);
+#elif defined(DMQ_TRANSPORT_SHM)
+    // Shared memory uses one named ring per direction (e.g., "dmq_a_to_b")
+    int Initialize(const std::string& sendName, const std::string& recvName);
 #elif defined(DMQ_TRANSPORT_STM32_UART)
     // Initialize with HAL Handle
     int Initialize(UART_HandleTypeDef* huart);
@@ -164,8 +173,8 @@ public:
             dmq::DelegateRemoteId remoteId = endpoint.GetRemoteId();
 
             // 3. [Caller Thread] Define the callback that wakes us up later.
-            std::function<void(dmq::DelegateRemoteId, uint16_t, TransportMonitor::Status)> statusCbFunc =
-                [state, remoteId](dmq::DelegateRemoteId id, uint16_t seq, TransportMonitor::Status status) {
+            std::function<void(dmq::DelegateRemoteId, uint32_t, TransportMonitor::Status)> statusCbFunc =
+                [state, remoteId](dmq::DelegateRemoteId id, uint32_t seq, TransportMonitor::Status status) {
                 if (id == remoteId) {
                     {
                         std::lock_guard<dmq::Mutex> lock(state->mtx);
@@ -236,8 +245,8 @@ public:
             auto state = std::make_shared<SyncState>();
             dmq::DelegateRemoteId remoteId = channel.GetRemoteId();
 
-            std::function<void(dmq::DelegateRemoteId, uint16_t, TransportMonitor::Status)> statusCbFunc =
-                [state, remoteId](dmq::DelegateRemoteId id, uint16_t seq, TransportMonitor::Status status) {
+            std::function<void(dmq::DelegateRemoteId, uint32_t, TransportMonitor::Status)> statusCbFunc =
+                [state, remoteId](dmq::DelegateRemoteId id, uint32_t seq, TransportMonitor::Status status) {
                 if (id == remoteId) {
                     {
                         std::lock_guard<dmq::Mutex> lock(state->mtx);
@@ -280,7 +289,7 @@ protected:
     /// @details Derived classes can pass this to RemoteChannel constructors so each
     /// channel owns its own Dispatcher while sharing the same physical transport.
     dmq::transport::ITransport& GetSendTransport() {
-#if defined(DMQ_TRANSPORT_ZEROMQ)
+#if defined(DMQ_TRANSPORT_ZEROMQ) || defined(DMQ_TRANSPORT_SHM)
         return m_sendTransport;
 #else
         return m_reliableTransport;
@@ -292,14 +301,14 @@ protected:
     TransportMonitor m_transportMonitor;
 
     virtual void OnError(dmq::DelegateRemoteId id, dmq::DelegateError error, dmq::DelegateErrorAux aux);
-    virtual void OnStatus(dmq::DelegateRemoteId id, uint16_t seq, TransportMonitor::Status status);
+    virtual void OnStatus(dmq::DelegateRemoteId id, uint32_t seq, TransportMonitor::Status status);
 
 private:
     void RecvThread();
     void Incoming(dmq::transport::DmqHeader& header, std::shared_ptr<dmq::xstringstream> arg_data);
     void Timeout();
     void InternalErrorHandler(dmq::DelegateRemoteId id, dmq::DelegateError error, dmq::DelegateErrorAux aux);
-    void InternalStatusHandler(dmq::DelegateRemoteId id, uint16_t seq, TransportMonitor::Status status);
+    void InternalStatusHandler(dmq::DelegateRemoteId id, uint32_t seq, TransportMonitor::Status status);
 
     dmq::os::Thread m_recvThread;
     std::atomic<bool> m_recvThreadExit{ false };
@@ -330,6 +339,20 @@ private:
     RetryMonitor m_retryMonitor;
     ReliableTransport m_reliableTransport;
 
+#elif defined(DMQ_TRANSPORT_LINUX_URING)
+    dmq::transport::LinuxUringTransport m_sendTransport;
+    dmq::transport::LinuxUringTransport m_recvTransport;
+
+    // Reliability Layers
+    RetryMonitor m_retryMonitor;
+    ReliableTransport m_reliableTransport;
+
+#elif defined(DMQ_TRANSPORT_SHM)
+    dmq::transport::ShmTransport m_sendTransport;
+    dmq::transport::ShmTransport m_recvTransport;
+
+    // Shared memory rings never drop messages; no retry layer needed
+
 #elif defined(DMQ_TRANSPORT_STM32_UART)
     // Single Shared Transport Instance (Owns the buffers/state)
     dmq::transport::Stm32UartTransport m_transport;
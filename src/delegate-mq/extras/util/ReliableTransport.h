@@ -89,6 +89,10 @@ public:
         return m_transport.Receive(is, header);
     }
 
+    virtual bool HasPending() const override {
+        return m_transport.HasPending();
+    }
+
 private:
     dmq::transport::ITransport& m_transport;
     RetryMonitor& m_retry;
@@ -80,7 +80,7 @@ public:
             entry.attemptsRemaining = m_maxRetries;
             entry.header = header;
             entry.packetData = os.str(); // Copy data
-            m_retryStore[header.GetSeqNum()] = entry;
+            m_retryStore[header.GetSeqNum()] = entry;  // Low 16 bits match either wire format
         }
 
         // Non-Critical Section: Send via Transport.
@@ -102,7 +102,7 @@ public:
 
 private:
     /// @brief Callback handled when a message is either ACK'd or Timed Out.
-    void OnStatusChanged(dmq::DelegateRemoteId id, uint16_t seqNum, TransportMonitor::Status status)
+    void OnStatusChanged(dmq::DelegateRemoteId id, uint32_t seqNum, TransportMonitor::Status status)
     {
         (void)id;
         // Variables to hold data for the retry OUTSIDE the lock
@@ -114,8 +114,11 @@ private:
             // 1. Critical Section: Read/Modify Map ONLY
             const std::lock_guard<dmq::RecursiveMutex> lock(m_lock);
 
-            auto it = m_retryStore.find(seqNum);
+            // An extended header reports all 32 bits; ignore a status for an
+            // older message that shares the low 16 bits with the stored one.
+            auto it = m_retryStore.find(static_cast<uint16_t>(seqNum));
             if (it == m_retryStore.end()) return;
+            if (seqNum > UINT16_MAX && it->second.header.GetSeqNum32() != seqNum) return;
 
             if (status == TransportMonitor::Status::SUCCESS)
             {
@@ -38,8 +38,9 @@ public:
     };
 
     /// Signal emitted when a message status is determined.
-    /// Subscribers receive: (remoteId, seqNum, status)
-    dmq::Signal<void(dmq::DelegateRemoteId, uint16_t, Status)> OnSendStatus;
+    /// Subscribers receive: (remoteId, seqNum, status). seqNum is the wire sequence
+    /// number: 32 bits for an extended header, the low 16 bits otherwise.
+    dmq::Signal<void(dmq::DelegateRemoteId, uint32_t, Status)> OnSendStatus;
 
     TransportMonitor(const dmq::Duration timeout = std::chrono::seconds(2)) : TRANSPORT_TIMEOUT(timeout) {}
 
@@ -52,7 +53,7 @@ public:
     /// Add a sequence number
     /// param[in] seqNum - the delegate message sequence number
     /// param[in] remoteId - the remote ID
-    virtual void Add(uint16_t seqNum, dmq::DelegateRemoteId remoteId) override
+    virtual void Add(uint32_t seqNum, dmq::DelegateRemoteId remoteId) override
     {
         const std::lock_guard<dmq::RecursiveMutex> lock(m_lock);
         TimeoutData d;
@@ -64,7 +65,7 @@ public:
     /// Remove a sequence number. Invokes SendStatusCb callback to notify 
     /// registered client of removal.
     /// param[in] seqNum - the delegate message sequence number
-    virtual void Remove(uint16_t seqNum) override
+    virtual void Remove(uint32_t seqNum) override
     {
         bool found = false;
         TimeoutData d;
@@ -134,9 +135,9 @@ private:
         dmq::TimePoint timeStamp;
     };
 
-    struct ExpiredItem { uint16_t seq; TimeoutData data; };
+    struct ExpiredItem { uint32_t seq; TimeoutData data; };
 
-    xmap<uint16_t, TimeoutData> m_pending;
+    xmap<uint32_t, TimeoutData> m_pending;
     std::array<ExpiredItem, dmq::MAX_TIMER_EXPIRED> m_expiredItems{};
     const dmq::Duration TRANSPORT_TIMEOUT;
     dmq::RecursiveMutex m_lock;
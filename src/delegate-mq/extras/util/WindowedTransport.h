@@ -0,0 +1,451 @@
+#ifndef _WINDOWED_TRANSPORT_H
+#define _WINDOWED_TRANSPORT_H
+
+/// @file WindowedTransport.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Sliding-window reliable delivery for the DelegateMQ transport layer.
+///
+/// @details
+/// `WindowedTransport` is an `ITransport` decorator, like `ReliableTransport`, that
+/// replaces the per-message stop-and-wait ACK scheme (`TransportMonitor` + `RetryMonitor`)
+/// with a windowed protocol:
+///
+/// 1. **Per-Link Sequence Numbers**: Outgoing messages are stamped with a contiguous
+///    sequence number in the existing `DmqHeader` field (the global sequence number
+///    assigned by `Dispatcher` is overwritten), so the receiver can acknowledge a range.
+/// 2. **Cumulative and Selective ACKs**: One ACK carries the next expected sequence
+///    number in its header and a 64-bit SACK bitmap in its payload. Bit `i` set means
+///    message `seq + 1 + i` has arrived.
+/// 3. **Delayed ACKs**: The receiver acknowledges every `ACK_EVERY` in-order messages,
+///    or after `ACK_DELAY`, instead of once per message. Out-of-order arrivals and
+///    duplicates are acknowledged at once to speed up recovery.
+/// 4. **Adaptive Timeouts**: The retransmit timeout is computed from measured round trip
+///    times (RFC 6298 smoothed RTT and variance, Karn's rule, exponential backoff).
+///    Three duplicate ACKs with a SACK gap retransmit the missing message without
+///    waiting for the timeout.
+/// 5. **Ring Retransmit Store**: Unacknowledged messages are kept in a fixed ring of
+///    `WINDOW_SIZE` slots indexed by sequence number. Slot storage is reused, so a send
+///    does not allocate once the ring has warmed up. `Send()` fails while the window is
+///    full.
+///
+/// Received duplicates are dropped. Messages may be delivered out of order, as with
+/// the UDP transports. Both ends start at sequence number 0; a receiver resynchronizes
+/// when a message arrives far outside its window (e.g. after the peer restarted).
+///
+/// **Usage:**
+/// Both ends must use `WindowedTransport`; its ACKs are not understood by
+/// `TransportMonitor`. Do not set a transport monitor on the wrapped transport (it
+/// would send its own per-message ACKs). Call `Process()` periodically (e.g. every
+/// few milliseconds from a timer or the network thread) to retransmit and to send
+/// delayed ACKs. Each `WindowedTransport` serves one peer.
+///
+/// @verbatim
+///   Application --Send()--> WindowedTransport --Send()--> Physical transport
+///   Application <-Receive()- WindowedTransport <-Receive()- Physical transport
+///                                 ^    |
+///                     ACK + SACK  |    | Process(): retransmit, delayed ACK
+/// @endverbatim
+
+#include "delegate/DelegateOpt.h"
+#include "delegate/Signal.h"
+#include "port/transport/ITransport.h"
+#include "port/transport/DmqHeader.h"
+#include "TransportMonitor.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace dmq::util {
+
+/// @brief Reliable `ITransport` decorator using a sliding window with SACK.
+class WindowedTransport : public dmq::transport::ITransport
+{
+public:
+    using Status = TransportMonitor::Status;
+
+    /// Unacknowledged messages in flight. Must be a power of 2, at most 64 (the SACK
+    /// bitmap width).
+    static const uint16_t WINDOW_SIZE = 64;
+
+    /// In-order messages received before an ACK is sent immediately
+    static const int ACK_EVERY = 2;
+
+    /// Signal emitted when a message is acknowledged or given up on.
+    /// Subscribers receive: (remoteId, seqNum, status). Same signature as
+    /// `TransportMonitor::OnSendStatus`; seqNum is the window sequence number as sent.
+    dmq::Signal<void(dmq::DelegateRemoteId, uint32_t, Status)> OnSendStatus;
+
+    /// @param[in] transport The physical transport. Must outlive this object.
+    /// @param[in] maxRetries Retransmissions before a message is reported as `TIMEOUT`.
+    /// @param[in] initialRto Retransmit timeout used until the first RTT sample.
+    WindowedTransport(dmq::transport::ITransport& transport, int maxRetries = 3,
+        std::chrono::milliseconds initialRto = std::chrono::milliseconds(500))
+        : m_transport(transport), m_maxRetries(maxRetries),
+          m_rto(std::chrono::duration_cast<Micros>(initialRto).count())
+    {
+        static_assert((WINDOW_SIZE & (WINDOW_SIZE - 1)) == 0 && WINDOW_SIZE <= 64,
+            "WINDOW_SIZE must be a power of 2, at most 64");
+    }
+
+    WindowedTransport(const WindowedTransport&) = delete;
+    WindowedTransport& operator=(const WindowedTransport&) = delete;
+
+    virtual int Send(dmq::xostringstream& os, const dmq::transport::DmqHeader& header) override
+    {
+        dmq::transport::TransportBuffer payload = dmq::transport::GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    /// Store the message in the retransmit ring and send it.
+    /// @return 0 on success, -1 if the window is full or the transport failed.
+    virtual int SendBuffers(const dmq::transport::DmqHeader& header,
+        const dmq::transport::TransportBuffer* buffers, size_t count) override
+    {
+        if (header.GetId() == dmq::ACK_REMOTE_ID)
+            return -1;
+
+        const dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        if (static_cast<uint16_t>(m_nextSeq - m_sendUna) >= WINDOW_SIZE)
+            return -1; // Window full
+
+        const uint16_t seq = m_nextSeq;
+        SendSlot& slot = m_sendRing[seq & WINDOW_MASK];
+        slot.header = header;
+        slot.header.SetSeqNum(seq);
+        slot.payload.clear();
+        for (size_t i = 0; i < count; i++)
+            slot.payload.append(static_cast<const char*>(buffers[i].data), buffers[i].size);
+
+        if (Transmit(slot) != 0)
+            return -1;
+
+        slot.inUse = true;
+        slot.retransmits = 0;
+        slot.rto = m_rto;
+        m_nextSeq++;
+        return 0;
+    }
+
+    virtual bool SupportsBufferSend() const override { return true; }
+
+    /// Receive the next message from the physical transport.
+    /// @details ACKs are consumed and returned with `dmq::ACK_REMOTE_ID`, as with the
+    /// other transports. A duplicate data message is dropped and -1 is returned.
+    virtual int Receive(dmq::xstringstream& is, dmq::transport::DmqHeader& header) override
+    {
+        int result = m_transport.Receive(is, header);
+        if (result != 0)
+            return result;
+
+        if (header.GetId() == dmq::ACK_REMOTE_ID) {
+            ProcessAck(is, header);
+            return 0;
+        }
+
+        bool deliver = false;
+        bool ackNow = false;
+        {
+            const dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+            deliver = Accept(header.GetSeqNum(), ackNow);
+        }
+        if (ackNow)
+            SendAck();
+        return deliver ? 0 : -1;
+    }
+
+    virtual bool HasPending() const override { return m_transport.HasPending(); }
+
+    /// Retransmit expired messages, report messages out of retries and send a due
+    /// delayed ACK. Call periodically.
+    void Process()
+    {
+        const int64_t now = Now();
+        std::array<Event, WINDOW_SIZE> expired;
+        size_t expiredCount = 0;
+        {
+            const dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+            for (uint16_t seq = m_sendUna; seq != m_nextSeq; seq++) {
+                SendSlot& slot = m_sendRing[seq & WINDOW_MASK];
+                if (!slot.inUse || now - slot.sentTime < slot.rto)
+                    continue;
+                if (slot.retransmits >= m_maxRetries) {
+                    slot.inUse = false;
+                    expired[expiredCount++] = { slot.header.GetId(), slot.header.GetWireSeqNum() };
+                    continue;
+                }
+                slot.retransmits++;
+                slot.rto = (std::min)(slot.rto * 2, MAX_RTO);
+                Transmit(slot);
+            }
+            AdvanceUna();
+        }
+        for (size_t i = 0; i < expiredCount; i++)
+            OnSendStatus(expired[i].remoteId, expired[i].seqNum, Status::TIMEOUT);
+
+        bool ackDue = false;
+        {
+            const dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+            ackDue = m_ackPending > 0 && now >= m_ackDeadline;
+        }
+        if (ackDue)
+            SendAck();
+    }
+
+    /// @return The current retransmit timeout.
+    std::chrono::microseconds GetRto() const
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        return std::chrono::microseconds(m_rto);
+    }
+
+    /// @return Number of messages sent and not yet acknowledged or given up on.
+    uint16_t GetInFlight() const
+    {
+        const dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        uint16_t count = 0;
+        for (uint16_t seq = m_sendUna; seq != m_nextSeq; seq++) {
+            if (m_sendRing[seq & WINDOW_MASK].inUse)
+                count++;
+        }
+        return count;
+    }
+
+private:
+    using Micros = std::chrono::microseconds;
+
+    static const uint16_t WINDOW_MASK = WINDOW_SIZE - 1;
+
+    /// Receiver ACK delay when fewer than ACK_EVERY messages are unacknowledged
+    static constexpr int64_t ACK_DELAY = 5000;
+
+    /// Retransmit timeout bounds (microseconds)
+    static constexpr int64_t MIN_RTO = 10000;
+    static constexpr int64_t MAX_RTO = 2000000;
+
+    /// Duplicate ACKs that trigger a fast retransmit
+    static const int DUP_ACK_THRESHOLD = 3;
+
+    /// SACK bitmap size in the ACK payload
+    static const size_t SACK_SIZE = 8;
+
+    struct SendSlot
+    {
+        dmq::transport::DmqHeader header;
+        dmq::xstring payload;           // Capacity reused across sends
+        int64_t sentTime = 0;
+        int64_t rto = 0;
+        int retransmits = 0;
+        bool inUse = false;
+    };
+
+    struct Event { dmq::DelegateRemoteId remoteId; uint32_t seqNum; };
+
+    static int64_t Now()
+    {
+        return std::chrono::duration_cast<Micros>(dmq::Clock::now().time_since_epoch()).count();
+    }
+
+    /// Send or resend a stored message. Called with m_sendLock held.
+    int Transmit(SendSlot& slot)
+    {
+        slot.sentTime = Now();
+        dmq::transport::TransportBuffer payload;
+        payload.data = slot.payload.data();
+        payload.size = slot.payload.size();
+        return m_transport.SendBuffers(slot.header, &payload, 1);
+    }
+
+    /// Slide the window start past acknowledged slots. Called with m_sendLock held.
+    void AdvanceUna()
+    {
+        while (m_sendUna != m_nextSeq && !m_sendRing[m_sendUna & WINDOW_MASK].inUse)
+            m_sendUna++;
+    }
+
+    /// Release an acknowledged slot. Called with m_sendLock held.
+    void Acknowledge(uint16_t seq, int64_t now, std::array<Event, WINDOW_SIZE>& acked, size_t& count)
+    {
+        SendSlot& slot = m_sendRing[seq & WINDOW_MASK];
+        if (!slot.inUse)
+            return;
+        // Karn's rule: only messages sent once give an unambiguous RTT sample
+        if (slot.retransmits == 0)
+            UpdateRtt(now - slot.sentTime);
+        slot.inUse = false;
+        acked[count++] = { slot.header.GetId(), slot.header.GetWireSeqNum() };
+    }
+
+    /// RFC 6298 estimator. Called with m_sendLock held.
+    void UpdateRtt(int64_t sample)
+    {
+        if (sample < 0)
+            return;
+        if (m_srtt == 0) {
+            m_srtt = sample;
+            m_rttVar = sample / 2;
+        } else {
+            const int64_t delta = m_srtt > sample ? m_srtt - sample : sample - m_srtt;
+            m_rttVar = (3 * m_rttVar + delta) / 4;
+            m_srtt = (7 * m_srtt + sample) / 8;
+        }
+        const int64_t rto = m_srtt + (std::max)(4 * m_rttVar, ACK_DELAY);
+        m_rto = (std::min)((std::max)(rto, MIN_RTO), MAX_RTO);
+    }
+
+    /// Apply a received cumulative ACK and SACK bitmap.
+    void ProcessAck(dmq::xstringstream& is, const dmq::transport::DmqHeader& header)
+    {
+        uint8_t sack[SACK_SIZE] = {};
+        is.read(reinterpret_cast<char*>(sack), sizeof(sack));
+        if (is.gcount() != static_cast<std::streamsize>(sizeof(sack)))
+            return; // Not a windowed ACK
+        uint64_t bitmap = 0;
+        for (size_t i = 0; i < SACK_SIZE; i++)
+            bitmap = (bitmap << 8) | sack[i];
+
+        const uint16_t cumAck = header.GetSeqNum();
+        const int64_t now = Now();
+        std::array<Event, WINDOW_SIZE> acked;
+        size_t ackedCount = 0;
+        {
+            const dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+
+            // Ignore ACKs outside the window (stale or from a previous session)
+            const uint16_t inFlight = static_cast<uint16_t>(m_nextSeq - m_sendUna);
+            const uint16_t advance = static_cast<uint16_t>(cumAck - m_sendUna);
+            if (advance > inFlight)
+                return;
+
+            for (uint16_t seq = m_sendUna; seq != cumAck; seq++)
+                Acknowledge(seq, now, acked, ackedCount);
+            for (uint16_t i = 0; i < WINDOW_SIZE && bitmap; i++, bitmap >>= 1) {
+                const uint16_t seq = static_cast<uint16_t>(cumAck + 1 + i);
+                if (static_cast<uint16_t>(seq - m_sendUna) >= inFlight)
+                    break;
+                if (bitmap & 1)
+                    Acknowledge(seq, now, acked, ackedCount);
+            }
+
+            // Fast retransmit: the peer keeps reporting the same hole
+            SendSlot& hole = m_sendRing[cumAck & WINDOW_MASK];
+            if (ackedCount == 0 && cumAck == m_lastCumAck && cumAck != m_nextSeq && hole.inUse) {
+                if (++m_dupAcks == DUP_ACK_THRESHOLD) {
+                    hole.retransmits++;
+                    Transmit(hole);
+                }
+            } else {
+                m_dupAcks = 0;
+            }
+            m_lastCumAck = cumAck;
+            AdvanceUna();
+        }
+
+        for (size_t i = 0; i < ackedCount; i++)
+            OnSendStatus(acked[i].remoteId, acked[i].seqNum, Status::SUCCESS);
+    }
+
+    /// Record a received sequence number. Called with m_recvLock held.
+    /// @param[out] ackNow Set if an ACK should be sent immediately.
+    /// @return `true` if the message is new and should be delivered.
+    bool Accept(uint16_t seq, bool& ackNow)
+    {
+        const uint16_t ahead = static_cast<uint16_t>(seq - m_recvNext);
+        const uint16_t behind = static_cast<uint16_t>(m_recvNext - seq);
+
+        if (ahead > WINDOW_SIZE && behind > WINDOW_SIZE) {
+            // Too far from the window to be a retransmission; the peer restarted.
+            // Synchronize on this message.
+            m_recvNext = static_cast<uint16_t>(seq + 1);
+            m_recvBitmap = 0;
+            ScheduleAck(ackNow);
+            return true;
+        }
+
+        if (ahead == 0) {
+            m_recvNext++;
+            // Slide past messages that arrived early
+            while (m_recvBitmap & 1) {
+                m_recvBitmap >>= 1;
+                m_recvNext++;
+            }
+            m_recvBitmap >>= 1;
+            ScheduleAck(ackNow);
+            return true;
+        }
+
+        if (ahead <= WINDOW_SIZE) {
+            const uint64_t bit = uint64_t(1) << (ahead - 1);
+            ackNow = true; // Out of order: report the hole now
+            m_ackPending++;
+            if (m_recvBitmap & bit)
+                return false;
+            m_recvBitmap |= bit;
+            return true;
+        }
+
+        // Already delivered; our ACK was probably lost
+        ackNow = true;
+        m_ackPending++;
+        return false;
+    }
+
+    /// Count an in-order message toward the next ACK. Called with m_recvLock held.
+    void ScheduleAck(bool& ackNow)
+    {
+        if (m_ackPending++ == 0)
+            m_ackDeadline = Now() + ACK_DELAY;
+        if (m_ackPending >= ACK_EVERY)
+            ackNow = true;
+    }
+
+    /// Send a cumulative ACK with the SACK bitmap.
+    void SendAck()
+    {
+        uint8_t sack[SACK_SIZE];
+        dmq::transport::DmqHeader ack;
+        ack.SetId(dmq::ACK_REMOTE_ID);
+        {
+            const dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+            if (m_ackPending == 0)
+                return;
+            m_ackPending = 0;
+            ack.SetSeqNum(m_recvNext);
+            uint64_t bitmap = m_recvBitmap;
+            for (size_t i = SACK_SIZE; i-- > 0; bitmap >>= 8)
+                sack[i] = static_cast<uint8_t>(bitmap & 0xFF);
+        }
+
+        dmq::transport::TransportBuffer payload;
+        payload.data = sack;
+        payload.size = sizeof(sack);
+        m_transport.SendBuffers(ack, &payload, 1);
+    }
+
+    dmq::transport::ITransport& m_transport;
+    const int m_maxRetries;
+
+    // Sender state; guarded by m_sendLock
+    mutable dmq::Mutex m_sendLock;
+    std::array<SendSlot, WINDOW_SIZE> m_sendRing;
+    uint16_t m_nextSeq = 0;             // Next sequence number to assign
+    uint16_t m_sendUna = 0;             // Oldest unacknowledged sequence number
+    uint16_t m_lastCumAck = 0;
+    int m_dupAcks = 0;
+    int64_t m_srtt = 0;                 // Smoothed RTT (microseconds), 0 until sampled
+    int64_t m_rttVar = 0;
+    int64_t m_rto;                      // Retransmit timeout (microseconds)
+
+    // Receiver state; guarded by m_recvLock
+    dmq::Mutex m_recvLock;
+    uint16_t m_recvNext = 0;            // Next expected sequence number
+    uint64_t m_recvBitmap = 0;          // Bit i: m_recvNext + 1 + i received
+    int m_ackPending = 0;               // Messages received since the last ACK
+    int64_t m_ackDeadline = 0;
+};
+
+} // namespace dmq::util
+
+#endif // _WINDOWED_TRANSPORT_H
@@ -0,0 +1,335 @@
+#ifndef _LOCK_FREE_QUEUE_H
+#define _LOCK_FREE_QUEUE_H
+
+/// @file LockFreeQueue.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Lock-free multi-producer/single-consumer priority queue used by the
+/// `Thread` `QueueEngine::LOCK_FREE` option.
+///
+/// @details
+/// * **MpscRing:** A bounded ring per priority level. Producers claim a slot with a
+///   single CAS on the head index; the consumer owns the tail. Each cell carries a
+///   sequence number so the consumer never reads a slot before its producer finishes.
+///   Messages of equal priority are delivered in FIFO order.
+/// * **EventCount:** Blocks the consumer (or producers waiting for space) without a
+///   lock on the fast path. A notifier only bumps the epoch and issues the wakeup
+///   syscall when a waiter is registered, so pushing to an awake consumer costs no
+///   syscall. Linux uses a private futex; other platforms fall back to a mutex and
+///   condition variable inside the slow path only.
+/// * **Bounded count:** An atomic message count enforces `maxQueueSize` so the
+///   caller can apply its `FullPolicy` without taking a lock.
+
+#include "delegate/DelegateOpt.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#if defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <mutex>
+#include <condition_variable>
+#endif
+
+namespace dmq::os {
+
+/// @brief Lock-free wait/notify primitive. A waiter calls PrepareWait(), re-checks its
+/// condition, then calls Wait() or CancelWait(). Notify() is a no-op syscall-wise when
+/// nobody is waiting.
+class EventCount
+{
+public:
+    /// Register as a waiter and return the current epoch.
+    uint32_t PrepareWait() {
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return m_epoch.load(std::memory_order_seq_cst);
+    }
+
+    /// Deregister after PrepareWait() when the condition became true.
+    void CancelWait() {
+        m_waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /// Block until notified after PrepareWait() returned key, or until timeout.
+    /// @param[in] key - the value returned by PrepareWait().
+    /// @param[in] timeout - maximum wait; zero or negative waits forever.
+    void Wait(uint32_t key, dmq::Duration timeout) {
+#if defined(__linux__)
+        struct timespec ts;
+        struct timespec* pts = nullptr;
+        if (timeout.count() > 0) {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+            ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+            ts.tv_nsec = static_cast<long>(ns % 1000000000);
+            pts = &ts;
+        }
+        if (m_epoch.load(std::memory_order_acquire) == key)
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_epoch), FUTEX_WAIT_PRIVATE, key, pts, nullptr, 0);
+#else
+        std::unique_lock<std::mutex> lk(m_mutex);
+        auto changed = [this, key]() { return m_epoch.load(std::memory_order_acquire) != key; };
+        if (timeout.count() > 0)
+            m_cv.wait_for(lk, timeout, changed);
+        else
+            m_cv.wait(lk, changed);
+#endif
+        m_waiters.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /// Wake one or all waiters. Skips the syscall if no waiter is registered.
+    /// @param[in] all - true to wake all waiters, false to wake one.
+    void Notify(bool all) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) == 0)
+            return;
+#if defined(__linux__)
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_epoch), FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, nullptr, nullptr, 0);
+#else
+        {
+            std::lock_guard<std::mutex> lk(m_mutex);
+            m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+        if (all)
+            m_cv.notify_all();
+        else
+            m_cv.notify_one();
+#endif
+    }
+
+private:
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be 32 bits");
+
+    std::atomic<uint32_t> m_epoch{ 0 };
+    std::atomic<uint32_t> m_waiters{ 0 };
+#if !defined(__linux__)
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+#endif
+};
+
+/// @brief Bounded lock-free multi-producer/single-consumer ring.
+/// @tparam T The element type. Must be move constructible.
+template <class T>
+class MpscRing
+{
+public:
+    /// Constructor
+    /// @param[in] capacity - minimum number of elements; rounded up to a power of two.
+    explicit MpscRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++)
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /// Push an element. Called by any producer thread.
+    /// @param[in] value - the element to move into the ring. Unchanged on failure.
+    /// @return `true` if pushed, `false` if the ring is full.
+    bool TryPush(T&& value) {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            size_t seq = cell.seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data.emplace(std::move(value));
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @return `true` if a TryPush() would find a free slot. Any thread.
+    bool HasRoom() const {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        size_t seq = m_cells[pos & m_mask].seq.load(std::memory_order_acquire);
+        return static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) >= 0;
+    }
+
+    /// Pop the oldest element. Called only by the single consumer thread.
+    /// @return The element, or `std::nullopt` if the ring is empty.
+    std::optional<T> TryPop() {
+        Cell& cell = m_cells[m_tail & m_mask];
+        size_t seq = cell.seq.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(m_tail + 1) < 0)
+            return std::nullopt;
+        std::optional<T> value(std::move(cell.data));
+        cell.data.reset();
+        cell.seq.store(m_tail + m_mask + 1, std::memory_order_release);
+        ++m_tail;
+        return value;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        std::optional<T> data;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+
+    // Producer and consumer indices on separate cache lines
+    alignas(64) std::atomic<size_t> m_head{ 0 };
+    alignas(64) size_t m_tail = 0;
+};
+
+/// @brief Lock-free priority queue with one MpscRing per `dmq::Priority` level.
+/// @tparam T The message type. Must provide `dmq::Priority GetPriority() const`.
+template <class T>
+class LockFreeQueue
+{
+public:
+    /// Constructor
+    /// @param[in] capacity - per-priority ring capacity.
+    explicit LockFreeQueue(size_t capacity) :
+        m_rings{ MpscRing<T>(capacity), MpscRing<T>(capacity), MpscRing<T>(capacity) } {}
+
+    /// Reserve space for one message against a bound.
+    /// @param[in] maxSize - the bound; 0 means unlimited.
+    /// @return `true` if reserved, `false` if the queue is at maxSize.
+    bool TryReserve(size_t maxSize) {
+        size_t count = m_count.load(std::memory_order_relaxed);
+        do {
+            if (maxSize > 0 && count >= maxSize)
+                return false;
+        } while (!m_count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+        return true;
+    }
+
+    /// Release a reservation that was not followed by a successful Push().
+    void Unreserve() {
+        m_count.fetch_sub(1, std::memory_order_relaxed);
+        m_notFull.Notify(true);
+    }
+
+    /// Push a reserved message and wake the consumer if it is sleeping.
+    /// @return `false` if the priority ring is full; msg is left unchanged.
+    bool Push(T&& msg) {
+        auto& ring = m_rings[static_cast<int>(msg.GetPriority())];
+        if (!ring.TryPush(std::move(msg)))
+            return false;
+        m_notEmpty.Notify(false);
+        return true;
+    }
+
+    /// @return `true` if the ring for priority has a free slot. Every Pop()
+    /// notifies WaitNotFull() waiters, so a producer can wait for this.
+    bool HasRoom(dmq::Priority priority) const {
+        return m_rings[static_cast<int>(priority)].HasRoom();
+    }
+
+    /// Pop the highest priority message. Consumer thread only.
+    std::optional<T> Pop() {
+        auto msg = PopReserved();
+        if (msg)
+            Release(1);
+        return msg;
+    }
+
+    /// Pop the highest priority message but keep its reservation, so it still
+    /// counts against maxSize until Release(). Consumer thread only.
+    std::optional<T> PopReserved() {
+        for (int p = PRIORITIES - 1; p >= 0; p--) {
+            auto msg = m_rings[p].TryPop();
+            if (msg)
+                return msg;
+        }
+        return std::nullopt;
+    }
+
+    /// Release the reservations of messages taken with PopReserved().
+    /// @param[in] count - the number of messages.
+    void Release(size_t count) {
+        if (count == 0)
+            return;
+        m_count.fetch_sub(count, std::memory_order_relaxed);
+        m_notFull.Notify(true);
+    }
+
+    /// Pop a message, blocking up to timeout if the queue is empty. Consumer thread only.
+    /// @param[in] timeout - maximum wait; zero waits forever.
+    /// @param[in] stop - predicate that ends the wait early (e.g. thread exit).
+    template <class Stop>
+    std::optional<T> PopWait(dmq::Duration timeout, Stop stop) {
+        auto msg = Pop();
+        if (msg || stop())
+            return msg;
+        uint32_t key = m_notEmpty.PrepareWait();
+        msg = Pop();
+        if (msg || stop()) {
+            m_notEmpty.CancelWait();
+            return msg;
+        }
+        m_notEmpty.Wait(key, timeout);
+        return Pop();
+    }
+
+    /// Wait until ready() returns true, another message is popped, or timeout.
+    /// @param[in] ready - predicate retried after registering as a waiter.
+    /// @param[in] timeout - maximum wait; zero waits forever.
+    /// @return The final result of ready().
+    template <class Ready>
+    bool WaitNotFull(Ready ready, dmq::Duration timeout) {
+        if (ready())
+            return true;
+        uint32_t key = m_notFull.PrepareWait();
+        if (ready()) {
+            m_notFull.CancelWait();
+            return true;
+        }
+        m_notFull.Wait(key, timeout);
+        return ready();
+    }
+
+    /// Wake the consumer and all waiting producers (e.g. on thread exit).
+    void WakeAll() {
+        m_notEmpty.Notify(true);
+        m_notFull.Notify(true);
+    }
+
+    /// Discard all messages. Only call when the consumer is not running.
+    void Clear() {
+        while (Pop()) {}
+    }
+
+    /// Number of queued plus reserved messages.
+    size_t Size() const { return m_count.load(std::memory_order_relaxed); }
+
+private:
+    static const int PRIORITIES = static_cast<int>(dmq::Priority::HIGH) + 1;
+
+    MpscRing<T> m_rings[PRIORITIES];
+    alignas(64) std::atomic<size_t> m_count{ 0 };
+    EventCount m_notEmpty;
+    EventCount m_notFull;
+};
+
+} // namespace dmq::os
+
+#endif
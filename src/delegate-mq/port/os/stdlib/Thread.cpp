@@ -24,10 +24,15 @@ using namespace dmq::util;
 #define MSG_DISPATCH_DELEGATE	1
 #define MSG_EXIT_THREAD			2
 
+// Longest wait for a full lock-free ring before re-checking it. Pops and exit
+// notify the waiter, so this only bounds a missed wakeup.
+static const std::chrono::milliseconds RING_FULL_WAIT_BACKSTOP(100);
+
 //----------------------------------------------------------------------------
 // Thread
 //----------------------------------------------------------------------------
-Thread::Thread(const std::string& threadName, size_t maxQueueSize, FullPolicy fullPolicy, dmq::Duration dispatchTimeout, const std::string& cpuName)
+Thread::Thread(const std::string& threadName, size_t maxQueueSize, FullPolicy fullPolicy, dmq::Duration dispatchTimeout, 
+    const std::string& cpuName, QueueEngine queueEngine)
     : m_thread(std::nullopt)
     , m_exit(false)
     , THREAD_NAME(threadName)
@@ -36,6 +41,12 @@ Thread::Thread(const std::string& threadName, size_t maxQueueSize, FullPolicy fu
     , FULL_POLICY(fullPolicy)
     , m_dispatchTimeout(dispatchTimeout)
 {
+    if (queueEngine == QueueEngine::LOCK_FREE)
+    {
+        // Each priority ring must hold the full bound plus the exit message
+        size_t capacity = MAX_QUEUE_SIZE > 0 ? MAX_QUEUE_SIZE + 1 : dmq::LOCKFREE_QUEUE_SIZE;
+        m_lockFreeQueue = std::make_unique<LockFreeQueue<ThreadMsg>>(capacity);
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -145,6 +156,9 @@ bool Thread::IsCurrentThread()
 //----------------------------------------------------------------------------
 size_t Thread::GetQueueSize()
 {
+    if (m_lockFreeQueue)
+        return m_lockFreeQueue->Size();
+
     lock_guard<mutex> lock(m_mutex);
     return m_queue.size();
 }
@@ -177,9 +191,6 @@ void Thread::ExitThread()
     if (!m_thread)
         return;
 
-    // Create a new ThreadMsg
-    auto threadMsg = xmake_shared<ThreadMsg>(MSG_EXIT_THREAD, nullptr);
-
     {
         lock_guard<mutex> lock(m_mutex);
 
@@ -189,7 +200,18 @@ void Thread::ExitThread()
 
         // Explicitly allow Exit message to bypass the MAX_QUEUE_SIZE limit.
         // We do not wait on m_cvNotFull here to prevent deadlock during shutdown.
-        m_queue.push(threadMsg);
+        if (m_lockFreeQueue)
+        {
+            // Best effort; if the ring is full, Process() exits once drained
+            m_lockFreeQueue->TryReserve(0);
+            if (!m_lockFreeQueue->Push(ThreadMsg(MSG_EXIT_THREAD, nullptr)))
+                m_lockFreeQueue->Unreserve();
+            m_lockFreeQueue->WakeAll();
+        }
+        else
+        {
+            QueuePush(ThreadMsg(MSG_EXIT_THREAD, nullptr));
+        }
 
         // Wake up consumers
         m_cv.notify_one();
@@ -214,17 +236,43 @@ void Thread::ExitThread()
         }
     }
 
+    // A thread exiting itself mid-batch never reaches the batch release
+    ReleaseBatch();
+
     {
         lock_guard<mutex> lock(m_mutex);
         m_thread.reset();
-        while (!m_queue.empty())
-            m_queue.pop();
+        m_queue.clear();
+        if (m_lockFreeQueue)
+            m_lockFreeQueue->Clear();
 
         // Final cleanup notification
         m_cvNotFull.notify_all();
     }
 }
 
+//----------------------------------------------------------------------------
+// ReleaseBatch
+//----------------------------------------------------------------------------
+void Thread::ReleaseBatch()
+{
+    if (m_lockFreeQueue)
+    {
+        m_lockFreeQueue->Release(m_batchHeld);
+        m_batchHeld = 0;
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_batchHeld == 0)
+            return;
+        m_batchHeld = 0;
+    }
+    if (MAX_QUEUE_SIZE > 0)
+        m_cvNotFull.notify_all();
+}
+
 //----------------------------------------------------------------------------
 // DispatchDelegate
 //----------------------------------------------------------------------------
@@ -237,10 +285,13 @@ bool Thread::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
     if (!m_thread.has_value())
         throw std::invalid_argument("Thread pointer is null");
 
+    if (m_lockFreeQueue)
+        return DispatchLockFree(std::move(msg));
+
     std::unique_lock<std::mutex> lk(m_mutex);
 
     // [BACK PRESSURE / DROP / FAULT / TIMEOUT LOGIC]
-    if (MAX_QUEUE_SIZE > 0 && m_queue.size() >= MAX_QUEUE_SIZE)
+    if (MAX_QUEUE_SIZE > 0 && m_queue.size() + m_batchHeld >= MAX_QUEUE_SIZE)
     {
         if (FULL_POLICY == FullPolicy::DROP)
             return false;  // silently discard — caller is not stalled, no allocation wasted
@@ -255,7 +306,7 @@ bool Thread::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
         if (FULL_POLICY == FullPolicy::TIMEOUT)
         {
             bool hasSpace = m_cvNotFull.wait_for(lk, m_dispatchTimeout, [this]() {
-                return m_queue.size() < MAX_QUEUE_SIZE || m_exit.load();
+                return m_queue.size() + m_batchHeld < MAX_QUEUE_SIZE || m_exit.load();
             });
             if (!hasSpace) {
                 printf("[Thread] WARNING: Queue post timed out on '%s' — possible deadlock. Message dropped.\n", THREAD_NAME.c_str());
@@ -266,17 +317,16 @@ bool Thread::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
 
     }
 
-    // If using XALLOCATOR explicit operator new required. See xallocator.h.
-    auto threadMsg = xmake_shared<ThreadMsg>(MSG_DISPATCH_DELEGATE, msg);
-#if defined(DMQ_DATABUS_TOOLS)
-    threadMsg->SetEnqueueTime(Timer::GetNow());
-#endif
-
     // If we woke up because of exit (or exit happened while waiting), abort
     if (m_exit.load())
         return false;
 
-    m_queue.push(threadMsg);
+    // ThreadMsg is stored by value within the queue; no per-dispatch allocation
+    ThreadMsg threadMsg(MSG_DISPATCH_DELEGATE, std::move(msg));
+#if defined(DMQ_DATABUS_TOOLS)
+    threadMsg.SetEnqueueTime(Timer::GetNow());
+#endif
+    QueuePush(std::move(threadMsg));
 
 #if defined(DMQ_DATABUS_TOOLS)
     // Update monitoring stats
@@ -290,6 +340,105 @@ bool Thread::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
     return true;
 }
 
+//----------------------------------------------------------------------------
+// DispatchLockFree
+//----------------------------------------------------------------------------
+bool Thread::DispatchLockFree(std::shared_ptr<dmq::DelegateMsg> msg)
+{
+    LockFreeQueue<ThreadMsg>& queue = *m_lockFreeQueue;
+
+    // [BACK PRESSURE / DROP / FAULT / TIMEOUT LOGIC] using the atomic queue count
+    if (!queue.TryReserve(MAX_QUEUE_SIZE))
+    {
+        if (FULL_POLICY == FullPolicy::DROP)
+            return false;
+
+        if (FULL_POLICY == FullPolicy::FAULT)
+        {
+            printf("[Thread] CRITICAL: Queue full on thread '%s'! TRIGGERING FAULT.\n", THREAD_NAME.c_str());
+            ASSERT_TRUE(false);
+            return false;
+        }
+
+        if (FULL_POLICY == FullPolicy::TIMEOUT)
+        {
+            // Wake on exit too; reserved records whether space was actually taken
+            bool reserved = false;
+            auto reserve = [this, &queue, &reserved]() {
+                if (m_exit.load())
+                    return true;
+                reserved = queue.TryReserve(MAX_QUEUE_SIZE);
+                return reserved;
+            };
+            dmq::TimePoint deadline = Timer::GetNow() + m_dispatchTimeout;
+            bool hasSpace = false;
+            while (!hasSpace)
+            {
+                dmq::TimePoint now = Timer::GetNow();
+                if (now >= deadline)
+                    break;
+                hasSpace = queue.WaitNotFull(reserve, deadline - now);
+            }
+            if (!hasSpace) {
+                printf("[Thread] WARNING: Queue post timed out on '%s' — possible deadlock. Message dropped.\n", THREAD_NAME.c_str());
+                return false;
+            }
+            if (!reserved)
+                return false;   // woke for exit; no space was reserved
+        }
+    }
+
+    // If exit happened while reserving, abort
+    if (m_exit.load())
+    {
+        queue.Unreserve();
+        return false;
+    }
+
+    ThreadMsg threadMsg(MSG_DISPATCH_DELEGATE, std::move(msg));
+#if defined(DMQ_DATABUS_TOOLS)
+    threadMsg.SetEnqueueTime(Timer::GetNow());
+#endif
+
+    // A ring can only fill when maxQueueSize is 0 (unlimited). Wait for the consumer
+    // to make room, unless this is the consumer itself which would never drain it.
+    // Each pop and ExitThread() notify the wait; the timeout is only a backstop.
+    const dmq::Priority priority = threadMsg.GetPriority();
+    while (!queue.Push(std::move(threadMsg)))
+    {
+        if (m_exit.load() || IsCurrentThread())
+        {
+            printf("[Thread] WARNING: Lock-free ring full on '%s'. Message dropped.\n", THREAD_NAME.c_str());
+            queue.Unreserve();
+            return false;
+        }
+        queue.WaitNotFull([this, &queue, priority]() {
+            return m_exit.load() || queue.HasRoom(priority);
+        }, RING_FULL_WAIT_BACKSTOP);
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// QueuePush
+//----------------------------------------------------------------------------
+void Thread::QueuePush(ThreadMsg&& msg)
+{
+    m_queue.push_back(std::move(msg));
+    std::push_heap(m_queue.begin(), m_queue.end(), ThreadMsgComparator());
+}
+
+//----------------------------------------------------------------------------
+// QueuePop
+//----------------------------------------------------------------------------
+ThreadMsg Thread::QueuePop()
+{
+    std::pop_heap(m_queue.begin(), m_queue.end(), ThreadMsgComparator());
+    ThreadMsg msg = std::move(m_queue.back());
+    m_queue.pop_back();
+    return msg;
+}
+
 //----------------------------------------------------------------------------
 // WatchdogCheckAll
 //----------------------------------------------------------------------------
@@ -329,6 +478,14 @@ void Thread::WatchdogCheck()
     }
 }
 
+//----------------------------------------------------------------------------
+// SetBatchSize
+//----------------------------------------------------------------------------
+void Thread::SetBatchSize(size_t batchSize)
+{
+    m_batchSize.store(batchSize > 0 ? batchSize : 1);
+}
+
 //----------------------------------------------------------------------------
 // ThreadCheck
 //----------------------------------------------------------------------------
@@ -365,18 +522,51 @@ void Thread::Process()
     bool selfExit = false;
     t_self_exit = &selfExit;
 
+    // Messages drained per wakeup. Also on this stack frame so the remaining
+    // messages are released safely if a handler destroys the owning Thread.
+    ThreadMsgVector batch;
+
     // Signal that the thread has started processing to notify CreateThread
     m_threadStartPromise->set_value();
 
     while (!selfExit)
     {
-        dmq::Duration watchdogTimeout;
+        dmq::Duration watchdogTimeout = m_watchdogTimeout.load();
+        const size_t batchSize = m_batchSize.load();
+        batch.clear();
+
+        if (m_lockFreeQueue)
         {
+            // Wait for a message. If watchdog active, use a finite timeout so we can
+            // periodically update m_lastAliveTime while idle. Zero blocks forever.
+            dmq::Duration timeout = watchdogTimeout.count() > 0 ? watchdogTimeout / 10 : dmq::Duration(0);
+            std::optional<ThreadMsg> msg = m_lockFreeQueue->PopWait(timeout, [this]() { return m_exit.load(); });
+
             m_lastAliveTime.store(Timer::GetNow());
-            watchdogTimeout = m_watchdogTimeout.load();
-        }
 
-        std::shared_ptr<ThreadMsg> msg;
+            if (!msg)
+            {
+                if (m_exit.load()) { t_self_exit = nullptr; return; }
+                continue;
+            }
+
+#if defined(DMQ_DATABUS_TOOLS)
+            // Producers do not lock in this mode; sample depth on the consumer side
+            {
+                lock_guard<mutex> lock(m_mutex);
+                size_t currentDepth = m_lockFreeQueue->Size() + 1;
+                if (currentDepth > m_queueDepthMaxWindow) m_queueDepthMaxWindow = currentDepth;
+                if (currentDepth > m_queueDepthMaxAll) m_queueDepthMaxAll = currentDepth;
+            }
+#endif
+
+            // The rest of the batch keeps its reservations until run
+            batch.push_back(std::move(*msg));
+            while (batch.size() < batchSize && (msg = m_lockFreeQueue->PopReserved()))
+                batch.push_back(std::move(*msg));
+            m_batchHeld = batch.size() - 1;
+        }
+        else
         {
             std::unique_lock<std::mutex> lk(m_mutex);
 
@@ -394,7 +584,7 @@ void Thread::Process()
                 m_cv.wait(lk, predicate);
             }
 
-            // Always update alive time immediately after waking up
+            // Update alive time once per wakeup
             m_lastAliveTime.store(Timer::GetNow());
 
             // If empty and exit is true, we should exit.
@@ -404,70 +594,103 @@ void Thread::Process()
                 continue;
             }
 
-            // Get highest priority message within queue
-            msg = m_queue.top();
-            m_queue.pop();
+            // Drain up to batchSize messages in priority order under one lock. The
+            // rest of the batch counts against MAX_QUEUE_SIZE until run.
+            while (batch.size() < batchSize && !m_queue.empty())
+                batch.push_back(QueuePop());
+            m_batchHeld = batch.size() - 1;
 
-            // Unblock producers now that space is available
+            // Unblock a producer now that the first message freed a slot
             if (MAX_QUEUE_SIZE > 0)
-            {
                 m_cvNotFull.notify_one();
-            }
         }
 
-        switch (msg->GetId())
+#if defined(DMQ_DATABUS_TOOLS)
+        // Batch statistics, published to the shared counters once per batch
+        dmq::Duration latencyTotal(0), latencyMax(0), invokeTotal(0), invokeMax(0);
+        uint32_t latencyCount = 0, invokeCount = 0;
+        auto flushStats = [&]() {
+            lock_guard<mutex> lock(m_mutex);
+            m_latencyTotalWindow += latencyTotal;
+            m_latencyCountWindow += latencyCount;
+            if (latencyMax > m_latencyMaxWindow) m_latencyMaxWindow = latencyMax;
+            if (latencyMax > m_latencyMaxAll) m_latencyMaxAll = latencyMax;
+            m_dispatchCountAll += latencyCount;
+            m_invokeTotalWindow += invokeTotal;
+            m_invokeCountWindow += invokeCount;
+            if (invokeMax > m_invokeMaxWindow) m_invokeMaxWindow = invokeMax;
+            if (invokeMax > m_invokeMaxAll) m_invokeMaxAll = invokeMax;
+        };
+#endif
+
+        for (size_t i = 0; i < batch.size(); i++)
         {
-            case MSG_DISPATCH_DELEGATE:
             {
-#if defined(DMQ_DATABUS_TOOLS)
-                // Update latency stats before invoking
-                dmq::Duration latency = Timer::GetNow() - msg->GetEnqueueTime();
+                ThreadMsg msg = std::move(batch[i]);
+                switch (msg.GetId())
                 {
-                    lock_guard<mutex> lock(m_mutex);
-                    m_latencyTotalWindow += latency;
-                    m_latencyCountWindow++;
-                    if (latency > m_latencyMaxWindow) m_latencyMaxWindow = latency;
-                    if (latency > m_latencyMaxAll) m_latencyMaxAll = latency;
-                    m_dispatchCountAll++;
-                }
+                    case MSG_DISPATCH_DELEGATE:
+                    {
+#if defined(DMQ_DATABUS_TOOLS)
+                        // Each message waited until its own invoke started, including
+                        // the time spent behind earlier messages in this batch
+                        dmq::TimePoint start = Timer::GetNow();
+                        dmq::Duration latency = start - msg.GetEnqueueTime();
+                        latencyTotal += latency;
+                        latencyCount++;
+                        if (latency > latencyMax) latencyMax = latency;
 #endif
 
-                auto delegateMsg = msg->GetData();
-                if (delegateMsg) {
-                    auto invoker = delegateMsg->GetInvoker();
-                    if (invoker) {
+                        auto delegateMsg = msg.GetData();
+                        if (delegateMsg) {
+                            auto invoker = delegateMsg->GetInvoker();
+                            if (invoker) {
 #if defined(DMQ_DATABUS_TOOLS)
-                        dmq::TimePoint start = Timer::GetNow();
+                                start = Timer::GetNow();
 #endif
-                        invoker->Invoke(delegateMsg);
+                                invoker->Invoke(delegateMsg);
 #if defined(DMQ_DATABUS_TOOLS)
-                        dmq::Duration invokeTime = Timer::GetNow() - start;
-                        {
-                            lock_guard<mutex> lock(m_mutex);
-                            m_invokeTotalWindow += invokeTime;
-                            m_invokeCountWindow++;
-                            if (invokeTime > m_invokeMaxWindow) m_invokeMaxWindow = invokeTime;
-                            if (invokeTime > m_invokeMaxAll) m_invokeMaxAll = invokeTime;
+                                dmq::Duration invokeTime = Timer::GetNow() - start;
+                                invokeTotal += invokeTime;
+                                invokeCount++;
+                                if (invokeTime > invokeMax) invokeMax = invokeTime;
+#endif
+                            }
                         }
+                        break;
+                    }
+
+                    case MSG_EXIT_THREAD:
+                    {
+#if defined(DMQ_DATABUS_TOOLS)
+                        flushStats();
 #endif
+                        ReleaseBatch();
+                        t_self_exit = nullptr;
+                        return;
+                    }
+
+                    default:
+                    {
+                        throw std::invalid_argument("Invalid message ID");
                     }
                 }
-                break;
             }
+            // msg goes out of scope here — may trigger self-destruction of 'this'.
+            // After this point do not access any member unless selfExit is false.
+            if (selfExit)
+                break;
+        }
 
-            case MSG_EXIT_THREAD:
-            {
-                t_self_exit = nullptr;
-                return;
-            }
+        // Free the slots held by the rest of the batch. On self exit, ExitThread()
+        // has already released them.
+        if (!selfExit && batch.size() > 1)
+            ReleaseBatch();
 
-            default:
-            {
-                throw std::invalid_argument("Invalid message ID");
-            }
-        }
-        // msg goes out of scope here — may trigger self-destruction of 'this'.
-        // After this point do not access any member; check selfExit in while().
+#if defined(DMQ_DATABUS_TOOLS)
+        if (!selfExit)
+            flushStats();
+#endif
     }
     t_self_exit = nullptr;
 }
@@ -482,7 +705,7 @@ Thread::ThreadStats Thread::SnapshotStats()
     ThreadStats stats;
     stats.cpu_name = CPU_NAME;
     stats.thread_name = THREAD_NAME;
-    stats.queue_depth = m_queue.size();
+    stats.queue_depth = m_lockFreeQueue ? m_lockFreeQueue->Size() : m_queue.size();
     stats.queue_depth_max_window = m_queueDepthMaxWindow;
     stats.queue_depth_max_all = m_queueDepthMaxAll;
     stats.queue_size_limit = MAX_QUEUE_SIZE;
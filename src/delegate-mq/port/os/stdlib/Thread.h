@@ -14,11 +14,17 @@
 /// asynchronous delegates and system messages.
 ///
 /// **Key Features:**
-/// * **Priority Queue:** Uses `std::priority_queue` to ensure high-priority delegate 
-///   messages (e.g., system signals) are processed before lower-priority ones.
+/// * **Priority Queue:** Uses a binary heap of `ThreadMsg` values to ensure high-priority 
+///   delegate messages (e.g., system signals) are processed before lower-priority ones.
+///   Messages are stored by value so dispatching does not allocate a queue node.
 /// * **Queue Full Policy:** Configurable `FullPolicy` (DROP or TIMEOUT) when `maxQueueSize > 0`.
 ///   TIMEOUT waits up to `dispatchTimeout` for the consumer before logging and dropping;
 ///   DROP silently discards immediately. FAULT (the default) triggers a system fault.
+/// * **Queue Engine:** `QueueEngine::MUTEX` (default) guards the heap with one mutex.
+///   `QueueEngine::LOCK_FREE` uses one lock-free MPSC ring per priority and a futex-based
+///   wakeup instead, so producers neither contend with each other nor with the consumer.
+/// * **Batch Drain:** `SetBatchSize()` lets the worker drain several messages per
+///   lock acquisition, updating the watchdog and statistics once per batch.
 /// * **Watchdog Integration:** Includes a built-in heartbeat mechanism. If the thread loop 
 ///   stalls (deadlock or infinite loop), the watchdog timer detects the failure.
 /// * **Synchronized Start:** Uses `std::promise` and `std::future` to ensure the thread 
@@ -29,8 +35,10 @@
 #include "delegate/IThread.h"
 #include "./extras/util/Timer.h"
 #include "ThreadMsg.h"
+#include "LockFreeQueue.h"
 #include <thread>
-#include <queue>
+#include <vector>
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <future>
@@ -40,8 +48,8 @@ namespace dmq::os {
 
 // Comparator for priority queue
 struct ThreadMsgComparator {
-    bool operator()(const std::shared_ptr<ThreadMsg>& a, const std::shared_ptr<ThreadMsg>& b) const {
-        return static_cast<int>(a->GetPriority()) < static_cast<int>(b->GetPriority());
+    bool operator()(const ThreadMsg& a, const ThreadMsg& b) const {
+        return static_cast<int>(a.GetPriority()) < static_cast<int>(b.GetPriority());
     }
 };
 
@@ -57,6 +65,16 @@ struct ThreadMsgComparator {
 /// FAULT is the default.
 enum class FullPolicy { DROP, FAULT, TIMEOUT };
 
+/// @brief Message queue implementation used by a Thread.
+/// @details
+///   - MUTEX:     A priority heap guarded by a mutex and condition variables.
+///   - LOCK_FREE: One lock-free multi-producer/single-consumer ring per priority level.
+///                The queue bound is an atomic count, so FullPolicy is unchanged. Use
+///                when many publisher threads post to one Thread. With maxQueueSize 0
+///                each ring holds dmq::LOCKFREE_QUEUE_SIZE messages; a producer blocks
+///                while its ring is full.
+enum class QueueEngine { MUTEX, LOCK_FREE };
+
 /// @brief Cross-platform thread for any system supporting C++11 std::thread (e.g. Windows, Linux).
 /// @details The Thread class creates a worker thread capable of dispatching and
 /// invoking asynchronous delegates.
@@ -90,8 +108,10 @@ public:
     ///                   Only meaningful when maxQueueSize > 0.
     /// @param dispatchTimeout Duration to wait before giving up when policy is TIMEOUT.
     /// @param cpuName Optional CPU/Core name grouping for monitoring tools.
+    /// @param queueEngine The message queue implementation. MUTEX (default) or LOCK_FREE.
     Thread(const std::string& threadName, size_t maxQueueSize = 0, FullPolicy fullPolicy = FullPolicy::FAULT,
-           dmq::Duration dispatchTimeout = dmq::DEFAULT_DISPATCH_TIMEOUT, const std::string& cpuName = "");
+           dmq::Duration dispatchTimeout = dmq::DEFAULT_DISPATCH_TIMEOUT, const std::string& cpuName = "",
+           QueueEngine queueEngine = QueueEngine::MUTEX);
 
     /// Destructor
     ~Thread();
@@ -129,8 +149,22 @@ public:
     /// arguments.
     virtual bool DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg) override;
 
+    /// @brief Set the maximum number of messages drained per queue wakeup.
+    /// @details The worker removes up to batchSize messages, in priority order, under
+    /// one queue lock (or one lock-free pass), then invokes them back to back. The
+    /// watchdog timestamp and monitoring statistics are updated once per batch. A
+    /// higher priority message posted mid-batch waits for the current batch to finish.
+    /// Messages of a batch count against maxQueueSize until the batch finishes, so
+    /// batching never lets producers exceed the bound.
+    /// Default is 1 (one message per wakeup). Safe to call at any time.
+    /// @param[in] batchSize - messages per batch; 0 is treated as 1.
+    void SetBatchSize(size_t batchSize);
+
+    /// Get the maximum number of messages drained per queue wakeup.
+    size_t GetBatchSize() const { return m_batchSize.load(); }
+
     /// @brief Manually update the watchdog alive timestamp.
-    /// @details The Process() loop refreshes the timestamp automatically on every iteration.
+    /// @details The Process() loop refreshes the timestamp automatically once per batch.
     /// Call this from inside long-running message handlers to prevent a false watchdog
     /// alarm when a handler legitimately takes longer than watchdogTimeout.
     void ThreadCheck();
@@ -150,6 +184,12 @@ private:
     /// Entry point for the thread
     void Process();
 
+    /// DispatchDelegate() implementation for QueueEngine::LOCK_FREE
+    bool DispatchLockFree(std::shared_ptr<dmq::DelegateMsg> msg);
+
+    /// Free the queue slots held by the current batch (m_batchHeld)
+    void ReleaseBatch();
+
     void SetThreadName(std::thread::native_handle_type handle, const std::string& name);
 
     /// Check watchdog is expired. This function is called by the thread 
@@ -167,15 +207,23 @@ private:
     std::optional<std::thread> m_thread;
     std::atomic<bool> m_exit;
 
+    /// Push a message onto the priority heap. Caller must hold m_mutex.
+    void QueuePush(ThreadMsg&& msg);
+
+    /// Pop the highest priority message from the heap. Caller must hold m_mutex.
+    ThreadMsg QueuePop();
+
 #ifdef DMQ_ALLOCATOR
-    std::priority_queue<std::shared_ptr<ThreadMsg>,
-        std::vector<std::shared_ptr<ThreadMsg>, stl_allocator<std::shared_ptr<ThreadMsg>>>,
-        ThreadMsgComparator> m_queue;
+    using ThreadMsgVector = std::vector<ThreadMsg, stl_allocator<ThreadMsg>>;
 #else
-    std::priority_queue<std::shared_ptr<ThreadMsg>,
-        std::vector<std::shared_ptr<ThreadMsg>>,
-        ThreadMsgComparator> m_queue;
+    using ThreadMsgVector = std::vector<ThreadMsg>;
 #endif
+
+    // Binary heap ordered by ThreadMsgComparator. See QueuePush() and QueuePop().
+    ThreadMsgVector m_queue;
+    // Lock-free queue used instead of m_queue when QueueEngine::LOCK_FREE
+    std::unique_ptr<LockFreeQueue<ThreadMsg>> m_lockFreeQueue;
+
     std::mutex m_mutex;
     std::condition_variable m_cv;
 
@@ -194,6 +242,14 @@ private:
     // Timeout duration for TIMEOUT policy
     const dmq::Duration m_dispatchTimeout;
 
+    // Max messages drained per wakeup. See SetBatchSize().
+    std::atomic<size_t> m_batchSize{ 1 };
+
+    // Messages of the current batch, after the first, not yet run. Counted against
+    // MAX_QUEUE_SIZE. Guarded by m_mutex. With QueueEngine::LOCK_FREE these are queue
+    // reservations, and only the thread itself, or ExitThread() after it ends, touches it.
+    size_t m_batchHeld = 0;
+
     // Promise and future to synchronize thread start (constructed lazily in CreateThread)
     std::optional<std::promise<void>> m_threadStartPromise;
     std::optional<std::future<void>> m_threadStartFuture;
@@ -0,0 +1,313 @@
+#ifndef DMQ_THREAD_STDLIB
+#error "port/os/stdlib/ThreadPool.cpp requires DMQ_THREAD_STDLIB. Remove this file from your build configuration or define DMQ_THREAD_STDLIB."
+#endif
+
+#include "DelegateMQ.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace dmq::os {
+
+using namespace std;
+
+// Pool and worker index of the calling thread, if it is a pool worker
+static thread_local ThreadPool* t_pool = nullptr;
+static thread_local size_t t_workerIndex = 0;
+
+// Worker index for a strand key. Object addresses share their low bits
+// (allocation alignment), so mix all bits before the modulo.
+static size_t StrandIndex(const void* strand, size_t workerCount)
+{
+    uint64_t x = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(strand)) >> 4;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<size_t>(x % workerCount);
+}
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+ThreadPool::ThreadPool(const std::string& poolName, size_t workerCount, bool useStrands)
+    : POOL_NAME(poolName)
+    , USE_STRANDS(useStrands)
+{
+    if (workerCount == 0)
+        workerCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    for (size_t i = 0; i < workerCount; i++)
+        m_workers.push_back(std::make_unique<Worker>());
+}
+
+//----------------------------------------------------------------------------
+// ~ThreadPool
+//----------------------------------------------------------------------------
+ThreadPool::~ThreadPool()
+{
+    // A worker cannot join itself; destroying the pool from a handler is an error
+    ASSERT_TRUE(!IsCurrentThread());
+    ExitThreadPool();
+}
+
+//----------------------------------------------------------------------------
+// CreateThreadPool
+//----------------------------------------------------------------------------
+bool ThreadPool::CreateThreadPool()
+{
+    // An exit requested from a handler leaves the workers unjoined
+    if (m_running.load() && m_exit.load())
+    {
+        if (IsCurrentThread())
+            return false;
+        JoinWorkers();
+    }
+
+    if (m_running.exchange(true))
+        return true;
+
+    m_exit = false;
+    for (size_t i = 0; i < m_workers.size(); i++)
+        m_workers[i]->thread = std::thread(&ThreadPool::Process, this, i);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// ExitThreadPool
+//----------------------------------------------------------------------------
+void ThreadPool::ExitThreadPool()
+{
+    if (!m_running.load())
+        return;
+
+    m_exit.store(true);
+    for (auto& worker : m_workers)
+    {
+        lock_guard<mutex> lock(worker->m_mutex);
+        worker->m_signal = true;
+        worker->m_cv.notify_one();
+    }
+
+    // Called from within a handler on this pool. The workers finish once the queues
+    // drain; the destructor, or a later call from another thread, joins them.
+    if (IsCurrentThread())
+        return;
+
+    JoinWorkers();
+}
+
+//----------------------------------------------------------------------------
+// JoinWorkers
+//----------------------------------------------------------------------------
+void ThreadPool::JoinWorkers()
+{
+    for (auto& worker : m_workers)
+    {
+        if (worker->thread.joinable())
+            worker->thread.join();
+    }
+
+    for (auto& worker : m_workers)
+    {
+        lock_guard<mutex> lock(worker->m_mutex);
+        for (int p = 0; p < PRIORITIES; p++)
+        {
+            worker->m_shared[p].clear();
+            worker->m_pinned[p].clear();
+        }
+        worker->m_count = 0;
+    }
+    m_running.store(false);
+}
+
+//----------------------------------------------------------------------------
+// GetQueueSize
+//----------------------------------------------------------------------------
+size_t ThreadPool::GetQueueSize()
+{
+    size_t size = 0;
+    for (auto& worker : m_workers)
+        size += worker->m_count.load();
+    return size;
+}
+
+//----------------------------------------------------------------------------
+// IsCurrentThread
+//----------------------------------------------------------------------------
+bool ThreadPool::IsCurrentThread()
+{
+    return t_pool == this;
+}
+
+//----------------------------------------------------------------------------
+// DispatchDelegate
+//----------------------------------------------------------------------------
+bool ThreadPool::DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg)
+{
+    if (!msg || m_exit.load() || !m_running.load())
+        return false;
+
+    const int priority = static_cast<int>(msg->GetPriority());
+    const void* strand = USE_STRANDS ? msg->GetStrandKey() : nullptr;
+
+    // Strand messages always go to the same worker. Others stay on the posting
+    // worker, or are distributed round-robin when posted from outside the pool.
+    size_t index;
+    if (strand)
+        index = StrandIndex(strand, m_workers.size());
+    else if (t_pool == this)
+        index = t_workerIndex;
+    else
+        index = m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+
+    Worker& worker = *m_workers[index];
+    bool wasIdle;
+    {
+        lock_guard<mutex> lock(worker.m_mutex);
+        if (strand)
+            worker.m_pinned[priority].push_back(std::move(msg));
+        else
+            worker.m_shared[priority].push_back(std::move(msg));
+        worker.m_count++;
+        wasIdle = worker.m_idle.load();
+        worker.m_signal = true;
+    }
+    worker.m_cv.notify_one();
+
+    // The owner is busy; let an idle worker steal the shareable message
+    if (!strand && !wasIdle)
+        WakeIdle(index);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// WakeIdle
+//----------------------------------------------------------------------------
+void ThreadPool::WakeIdle(size_t skip)
+{
+    for (size_t i = 0; i < m_workers.size(); i++)
+    {
+        if (i == skip)
+            continue;
+        Worker& worker = *m_workers[i];
+        if (!worker.m_idle.load())
+            continue;
+        {
+            lock_guard<mutex> lock(worker.m_mutex);
+            worker.m_signal = true;
+        }
+        worker.m_cv.notify_one();
+        return;
+    }
+}
+
+//----------------------------------------------------------------------------
+// PopLocal
+//----------------------------------------------------------------------------
+std::shared_ptr<dmq::DelegateMsg> ThreadPool::PopLocal(Worker& worker)
+{
+    if (worker.m_count.load() == 0)
+        return nullptr;
+
+    lock_guard<mutex> lock(worker.m_mutex);
+    for (int p = PRIORITIES - 1; p >= 0; p--)
+    {
+        for (auto* queue : { &worker.m_pinned[p], &worker.m_shared[p] })
+        {
+            if (!queue->empty())
+            {
+                auto msg = std::move(queue->front());
+                queue->pop_front();
+                worker.m_count--;
+                return msg;
+            }
+        }
+    }
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+// Steal
+//----------------------------------------------------------------------------
+std::shared_ptr<dmq::DelegateMsg> ThreadPool::Steal(size_t thief)
+{
+    const size_t count = m_workers.size();
+    for (size_t n = 1; n < count; n++)
+    {
+        Worker& victim = *m_workers[(thief + n) % count];
+        if (victim.m_count.load() == 0)
+            continue;
+
+        lock_guard<mutex> lock(victim.m_mutex);
+        for (int p = PRIORITIES - 1; p >= 0; p--)
+        {
+            auto& queue = victim.m_shared[p];
+            if (!queue.empty())
+            {
+                auto msg = std::move(queue.front());
+                queue.pop_front();
+                victim.m_count--;
+                return msg;
+            }
+        }
+    }
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+// Process
+//----------------------------------------------------------------------------
+void ThreadPool::Process(size_t index)
+{
+    t_pool = this;
+    t_workerIndex = index;
+    Worker& self = *m_workers[index];
+
+    for (;;)
+    {
+        auto msg = PopLocal(self);
+        if (!msg)
+            msg = Steal(index);
+
+        if (!msg)
+        {
+            // Publish idle, then look once more so a message posted to a busy
+            // worker just before the flag was visible is not missed.
+            self.m_idle.store(true);
+            msg = Steal(index);
+            if (!msg)
+            {
+                unique_lock<mutex> lk(self.m_mutex);
+                self.m_cv.wait(lk, [&self]() { return self.m_signal || self.m_count.load() > 0; });
+                self.m_signal = false;
+            }
+            self.m_idle.store(false);
+
+            if (!msg)
+            {
+                // Drain remaining work before honoring exit
+                if (m_exit.load() && self.m_count.load() == 0)
+                {
+                    msg = Steal(index);
+                    if (!msg)
+                        break;
+                }
+                else
+                {
+                    continue;
+                }
+            }
+        }
+
+        auto invoker = msg->GetInvoker();
+        if (invoker)
+            invoker->Invoke(msg);
+    }
+
+    t_pool = nullptr;
+}
+
+} // namespace dmq::os
@@ -0,0 +1,137 @@
+#ifndef _THREAD_POOL_STD_H
+#define _THREAD_POOL_STD_H
+
+/// @file ThreadPool.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Standard C++ work-stealing thread pool implementing the DelegateMQ IThread interface.
+///
+/// @details
+/// A `ThreadPool` can be used anywhere an `IThread` is accepted, e.g.
+/// `MakeDelegate(&obj, &C::Func, pool)` or `DataBus::Subscribe<T>(topic, func, &pool)`.
+/// Delegate messages are executed concurrently by N worker threads.
+///
+/// **Key Features:**
+/// * **Work Stealing:** Each worker owns a queue. Messages posted from outside the pool are
+///   distributed round-robin; messages posted by a worker go to its own queue. An idle worker
+///   steals the oldest message from a busy worker.
+/// * **Strands:** A message with a non-null `DelegateMsg::GetStrandKey()` is always routed to the
+///   worker selected by the key and is never stolen, so calls on the same target object run one
+///   at a time and in order. Async member function delegates set the key to the target object
+///   automatically. Free function and `std::function` targets have no key and may run
+///   concurrently with themselves. Disable strands at construction if targets are thread-safe.
+/// * **Priority:** Within a worker, higher priority messages are executed first.
+
+#include "delegate/IThread.h"
+#include "ThreadMsg.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dmq::os {
+
+/// @brief Work-stealing thread pool for any system supporting C++11 std::thread.
+class ThreadPool : public dmq::IThread
+{
+public:
+    /// Constructor
+    /// @param poolName The name of the pool for debugging.
+    /// @param workerCount Number of worker threads. 0 uses std::thread::hardware_concurrency().
+    /// @param useStrands If true (default), messages with the same strand key are serialized.
+    ThreadPool(const std::string& poolName, size_t workerCount = 0, bool useStrands = true);
+
+    /// Destructor
+    ~ThreadPool();
+
+    /// Called once to create the worker threads. Also restarts the pool after
+    /// `ExitThreadPool()`, joining the workers of an exit requested from a handler.
+    /// @return TRUE if the workers are created. FALSE otherwise, e.g. when called
+    /// from a handler on this pool while its exit is pending.
+    bool CreateThreadPool();
+
+    /// Called once at program exit to shut down the workers. Messages already queued are
+    /// executed before the workers exit.
+    /// @details When called from a handler running on this pool, the pool stops accepting
+    /// messages but the workers are joined later by the destructor, or by another call
+    /// from a thread outside the pool. The pool must not be destroyed by its own handler.
+    void ExitThreadPool();
+
+    /// Get the pool name
+    std::string GetThreadPoolName() { return POOL_NAME; }
+
+    /// Get the number of worker threads
+    size_t GetWorkerCount() const { return m_workers.size(); }
+
+    /// Get the number of queued messages across all workers.
+    size_t GetQueueSize();
+
+    /// Returns true if the calling thread is one of this pool's workers
+    virtual bool IsCurrentThread() override;
+
+    /// Dispatch a delegate message to be invoked on a pool worker.
+    /// @param[in] msg - Delegate message containing target function arguments.
+    /// @return `true` if queued, `false` if the pool is not running.
+    virtual bool DispatchDelegate(std::shared_ptr<dmq::DelegateMsg> msg) override;
+
+private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static const int PRIORITIES = static_cast<int>(dmq::Priority::HIGH) + 1;
+
+    /// Per-worker state. Queues are guarded by m_mutex.
+    struct Worker
+    {
+        std::thread thread;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+
+        /// Messages that may be stolen, one FIFO per priority
+        std::deque<std::shared_ptr<dmq::DelegateMsg>> m_shared[PRIORITIES];
+
+        /// Strand messages pinned to this worker, one FIFO per priority
+        std::deque<std::shared_ptr<dmq::DelegateMsg>> m_pinned[PRIORITIES];
+
+        /// Number of messages in m_shared and m_pinned
+        std::atomic<size_t> m_count{ 0 };
+
+        /// True while the worker is waiting for work
+        std::atomic<bool> m_idle{ false };
+
+        /// Set by a producer to wake an idle worker to steal
+        bool m_signal = false;
+    };
+
+    /// Join the exited workers and discard anything left in their queues.
+    void JoinWorkers();
+
+    /// Entry point for each worker thread
+    void Process(size_t index);
+
+    /// Pop the highest priority message from a worker's own queues.
+    std::shared_ptr<dmq::DelegateMsg> PopLocal(Worker& worker);
+
+    /// Steal the oldest, highest priority shareable message from another worker.
+    std::shared_ptr<dmq::DelegateMsg> Steal(size_t thief);
+
+    /// Wake one idle worker other than skip so it can steal.
+    void WakeIdle(size_t skip);
+
+    const std::string POOL_NAME;
+    const bool USE_STRANDS;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<bool> m_running{ false };
+    std::atomic<bool> m_exit{ false };
+    std::atomic<size_t> m_nextWorker{ 0 };
+};
+
+} // namespace dmq::os
+
+#endif
@@ -15,6 +15,7 @@
 // Core Bitsery
 #include <bitsery/bitsery.h>
 #include <bitsery/adapter/stream.h>
+#include <bitsery/adapter/buffer.h>
 
 // Common Traits (Include these so standard types work out of the box)
 #include <bitsery/traits/string.h>
@@ -38,6 +39,10 @@ public:
     using OutputAdapter = ::bitsery::OutputStreamAdapter;
     using InputAdapter = ::bitsery::InputStreamAdapter;
 
+    // Bitsery Adapters for dmq::ByteBuffer storage
+    using OutputBufferAdapter = ::bitsery::OutputBufferAdapter<dmq::ByteBuffer::Storage>;
+    using InputBufferAdapter = ::bitsery::InputBufferAdapter<dmq::ByteBuffer::Storage>;
+
     // Write: Changed 'Args... args' to 'const Args&... args' for efficiency
     virtual std::ostream& Write(std::ostream& os, const Args&... args) override {
         try {
@@ -66,6 +71,24 @@ public:
         return os;
     }
 
+    // Write arguments directly into the byte buffer storage
+    virtual dmq::ByteBuffer& WriteBuffer(dmq::ByteBuffer& buffer, const Args&... args) override {
+        try {
+            buffer.Clear();
+
+            // The adapter grows the storage as needed; the written size is set after
+            ::bitsery::Serializer<OutputBufferAdapter> writer{ buffer.GetStorage() };
+            (writer.object(args), ...);
+            writer.adapter().flush();
+            buffer.Resize(writer.adapter().writtenBytesCount());
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Bitsery serialize error: " << e.what() << std::endl;
+            throw;
+        }
+        return buffer;
+    }
+
     virtual std::istream& Read(std::istream& is, Args&... args) override {
         try {
             // Construct the adapter properly passing the stream
@@ -85,6 +108,27 @@ public:
         }
         return is;
     }
+
+    // Read arguments in place from the byte buffer read position
+    virtual dmq::ByteBuffer& ReadBuffer(dmq::ByteBuffer& buffer, Args&... args) override {
+        try {
+            auto begin = buffer.GetStorage().cbegin() + static_cast<std::ptrdiff_t>(buffer.GetReadPos());
+            ::bitsery::Deserializer<InputBufferAdapter> reader{ begin, buffer.Remaining() };
+
+            (reader.object(args), ...);
+
+            if (reader.adapter().error() != ::bitsery::ReaderError::NoError) {
+                buffer.SetFail();
+                throw std::runtime_error("Bitsery reported a read error");
+            }
+            buffer.SetReadPos(buffer.GetReadPos() + reader.adapter().currentReadPos());
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Bitsery deserialize error: " << e.what() << std::endl;
+            throw;
+        }
+        return buffer;
+    }
 };
 
 } // namespace dmq::serialization::bitsery
@@ -41,6 +41,24 @@ public:
         return os;
     }
 
+    // Write arguments to a byte buffer. Cereal archives only accept a std::ostream, so
+    // the buffer is wrapped in a ByteBufferOStream, whose put area is the buffer storage.
+    // The archive writes through sputn() into the buffer with no rewind or string copy.
+    // The default ReadBuffer() already reads the buffer in place.
+    virtual dmq::ByteBuffer& WriteBuffer(dmq::ByteBuffer& buffer, const Args&... args) override {
+        try {
+            buffer.Clear();
+            dmq::ByteBufferOStream os(buffer);
+            ::cereal::BinaryOutputArchive archive(os);
+            (archive(args), ...); // C++17 fold expression to serialize each argument
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Cereal serialize error: " << e.what() << std::endl;
+            throw;
+        }
+        return buffer;
+    }
+
     // Read arguments from a stream
     virtual std::istream& Read(std::istream& is, Args&... args) override {
         try {
@@ -23,6 +23,12 @@ void make_serialized(::msgpack::sbuffer& buffer, Args&&... args) {
     (::msgpack::pack(buffer, args), ...);  // C++17 fold expression to serialize
 }
 
+// Adapts dmq::ByteBuffer to the msgpack packer stream concept
+struct ByteBufferWriter {
+    dmq::ByteBuffer& buffer;
+    void write(const char* data, size_t size) { buffer.Write(data, size); }
+};
+
 template <class R>
 struct Serializer; // Not defined
 
@@ -59,6 +65,20 @@ public:
         return os;
     }
 
+    // Write arguments to a byte buffer. Packs directly into the buffer storage.
+    virtual dmq::ByteBuffer& WriteBuffer(dmq::ByteBuffer& buffer, const Args&... args) override {
+        try {
+            buffer.Clear();
+            ByteBufferWriter writer{ buffer };
+            (::msgpack::pack(writer, args), ...);  // C++17 fold expression to serialize
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Serialize error: " << e.what() << std::endl;
+            throw;
+        }
+        return buffer;
+    }
+
     // Read arguments from a stream
     virtual std::istream& Read(std::istream& is, Args&... args) override {
         try {
@@ -93,6 +113,48 @@ public:
         }
         return is;
     }
+
+    // Read arguments from a byte buffer. Unpacks in place from the read position.
+    virtual dmq::ByteBuffer& ReadBuffer(dmq::ByteBuffer& buffer, Args&... args) override {
+        return Unpack(buffer, args...);
+    }
+
+    // Read arguments from a received span. Unpacks in place from the read position.
+    virtual dmq::ByteSpan& ReadSpan(dmq::ByteSpan& span, Args&... args) override {
+        return Unpack(span, args...);
+    }
+
+private:
+    // Unpack from contiguous bytes (ByteBuffer or ByteSpan) without copying them
+    template <class Source>
+    Source& Unpack(Source& source, Args&... args) {
+        try {
+            if (source.Remaining() == 0 && sizeof...(Args) > 0) {
+                return source;
+            }
+
+            const char* data = reinterpret_cast<const char*>(source.ReadData());
+            size_t size = source.Remaining();
+            size_t offset = 0;
+
+            auto unpack_one = [&](auto& arg) {
+                ::msgpack::object_handle oh = ::msgpack::unpack(data, size, offset);
+                arg = oh.get().as<std::decay_t<decltype(arg)>>();
+                };
+            (unpack_one(args), ...);
+
+            source.SetReadPos(source.GetReadPos() + offset);
+        }
+        catch (const ::msgpack::type_error& e) {
+            std::cerr << "Deserialize type conversion error: " << e.what() << std::endl;
+            throw;
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Deserialize error: " << e.what() << std::endl;
+            throw;
+        }
+        return source;
+    }
 };
 
 } // namespace dmq::serialization::msgpack
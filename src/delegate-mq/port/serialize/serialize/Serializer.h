@@ -43,6 +43,28 @@ public:
         return os;
     }
 
+    // Write arguments to a byte buffer. serialize::I user types write to a std::ostream,
+    // so there is no contiguous-memory API to target. The arguments are written through
+    // a ByteBufferOStream, whose put area is the buffer storage, with no rewind or
+    // xostringstream reset. The default ReadBuffer() already reads the buffer in place.
+    virtual dmq::ByteBuffer& WriteBuffer(dmq::ByteBuffer& buffer, const Args&... args) override {
+        buffer.Clear();
+        dmq::ByteBufferOStream os(buffer);
+        ::serialize ser;
+#if defined(__cpp_exceptions)
+        try {
+            (ser.write(os, args), ...);  // C++17 fold expression to serialize each argument
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Serialize error: " << e.what() << std::endl;
+            throw;
+        }
+#else
+        (ser.write(os, args), ...);
+#endif
+        return buffer;
+    }
+
     // Read arguments from a stream
     virtual std::istream& Read(std::istream& is, Args&... args) override {
 #if defined(__cpp_exceptions)
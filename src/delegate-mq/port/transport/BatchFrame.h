@@ -0,0 +1,131 @@
+#ifndef BATCH_FRAME_H
+#define BATCH_FRAME_H
+
+/// @file
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Packing and unpacking of multi-record batch frames.
+///
+/// @details
+/// A batch frame is an ordinary transport message sent with the reserved remote
+/// ID `dmq::BATCH_REMOTE_ID`. Its payload is a sequence of records, each a complete
+/// 8-byte wire header (see `WriteHeader()`) followed by the record's payload:
+///
+/// @code
+///   [DmqHeader id=BATCH] [DmqHeader id=A len=n] [n bytes] [DmqHeader id=B len=m] [m bytes] ...
+/// @endcode
+///
+/// The sender is `dmq::BatchDispatcher`. Receivers (`Participant`, `NetworkEngine`)
+/// call `UnpackBatch()` to deliver each record as if it arrived in its own frame,
+/// either copied into a stream or, for a frame from `ITransport::ReceiveView()`, as
+/// a `dmq::ByteSpan` over the frame.
+
+#include "DmqHeader.h"
+#include "TransportBuffer.h"
+#include "../../delegate/IDispatcher.h"
+#include "../../delegate/DelegateOpt.h"
+#include <cstring>
+
+namespace dmq::transport {
+
+/// Append one record to a batch frame payload.
+/// @param[in,out] frame The batch frame payload.
+/// @param[in] id The record's remote ID.
+/// @param[in] seqNum The record's sequence number.
+/// @param[in] buffers The record payload buffers, appended in order.
+/// @param[in] count The number of buffers.
+/// @return 0 on success, -1 if the payload does not fit the 16-bit length field.
+inline int AppendBatchRecord(dmq::xstring& frame, uint16_t id, uint16_t seqNum,
+    const TransportBuffer* buffers, size_t count)
+{
+    const size_t size = GetBufferSize(buffers, count);
+    if (size > UINT16_MAX)
+        return -1;
+
+    uint8_t wire[DmqHeader::HEADER_SIZE];
+    WriteHeader(DmqHeader(id, seqNum, static_cast<uint16_t>(size)), wire);
+    frame.append(reinterpret_cast<const char*>(wire), sizeof(wire));
+    for (size_t i = 0; i < count; i++)
+        frame.append(static_cast<const char*>(buffers[i].data), buffers[i].size);
+    return 0;
+}
+
+/// Deliver each record of a received batch frame viewed in place.
+/// @details Each record is passed as a span over the frame bytes; nothing is copied.
+/// Nested batch records and records with a bad marker are skipped. Unpacking stops
+/// at a truncated record.
+/// @param[in] frame The batch frame payload, as returned by `ITransport::ReceiveView()`.
+/// @param[in] handler Callable as `handler(const DmqHeader&, dmq::ByteSpan&)`.
+/// @return The number of records delivered, or -1 if the frame was truncated.
+template <typename Handler>
+int UnpackBatch(const TransportBuffer& frame, Handler&& handler)
+{
+    const uint8_t* data = static_cast<const uint8_t*>(frame.data);
+    size_t offset = 0;
+    int delivered = 0;
+
+    while (offset + DmqHeader::HEADER_SIZE <= frame.size)
+    {
+        DmqHeader header;
+        ReadHeader(data + offset, header);
+        offset += DmqHeader::HEADER_SIZE;
+
+        const size_t length = header.GetLength();
+        if (offset + length > frame.size)
+            return -1;
+
+        if (header.GetMarker() == DmqHeader::MARKER && header.GetId() != dmq::BATCH_REMOTE_ID)
+        {
+            dmq::ByteSpan record(data + offset, length);
+            handler(static_cast<const DmqHeader&>(header), record);
+            delivered++;
+        }
+        offset += length;
+    }
+    return offset == frame.size ? delivered : -1;
+}
+
+/// Deliver each record of a received batch frame.
+/// @details The records are copied one at a time into a single reusable stream,
+/// so the handler sees the same `(header, stream)` pair a transport `Receive()`
+/// would have produced for an unbatched message. Nested batch records and records
+/// with a bad marker are skipped. Unpacking stops at a truncated record.
+/// @param[in] is The batch frame payload, as filled by `ITransport::Receive()`.
+/// @param[in] handler Callable as `handler(const DmqHeader&, dmq::xstringstream&)`.
+/// @return The number of records delivered, or -1 if the frame was truncated.
+template <typename Handler>
+int UnpackBatch(dmq::xstringstream& is, Handler&& handler)
+{
+    const TransportBuffer frame = GetStreamBuffer(is);
+    const uint8_t* data = static_cast<const uint8_t*>(frame.data);
+    size_t offset = 0;
+    int delivered = 0;
+
+    dmq::xstringstream record(std::ios::in | std::ios::out | std::ios::binary);
+    while (offset + DmqHeader::HEADER_SIZE <= frame.size)
+    {
+        DmqHeader header;
+        ReadHeader(data + offset, header);
+        offset += DmqHeader::HEADER_SIZE;
+
+        const size_t length = header.GetLength();
+        if (offset + length > frame.size)
+            return -1;
+
+        if (header.GetMarker() == DmqHeader::MARKER && header.GetId() != dmq::BATCH_REMOTE_ID)
+        {
+            record.str("");
+            record.clear();
+            record.write(reinterpret_cast<const char*>(data + offset), static_cast<std::streamsize>(length));
+            handler(static_cast<const DmqHeader&>(header), record);
+            delivered++;
+        }
+        offset += length;
+    }
+    return offset == frame.size ? delivered : -1;
+}
+
+} // namespace dmq::transport
+
+#endif // BATCH_FRAME_H
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <atomic>
+#include <chrono>
 
 namespace dmq::transport {
 
@@ -14,18 +15,45 @@ namespace dmq::transport {
 /// @details This class is a Plain Old Data (POD) container. 
 /// It stores values in Host Byte Order. The Transport layer is responsible 
 /// for converting to/from Network Byte Order (Big Endian) during transmission.
+///
+/// Two wire formats exist, distinguished by the marker (see `WriteHeader()`):
+/// - **Standard** (`MARKER`, 8 bytes): 16-bit ID, sequence number and length.
+/// - **Extended** (`MARKER_EXT`, 16 or 24 bytes): 32-bit sequence number and
+///   length, flags, and an optional 64-bit send timestamp.
+///
+/// A header is written in the extended format only when `IsExtended()`, so peers
+/// that only understand the 8-byte header keep working unless a sender opts in
+/// or a payload exceeds 64 KB.
 class DmqHeader
 {
 public:
     // Standard Marker (0xAA55 is often preferred as it looks like 10101010 01010101 binary)
     static const uint16_t MARKER = 0xAA55;
 
+    // Extended header marker
+    static const uint16_t MARKER_EXT = 0xAA56;
+
     // 4 fields * 2 bytes = 8 bytes total. Perfectly aligned.
     static const size_t HEADER_SIZE = 8;
 
+    // Extended header: marker, id, version, flags, reserved, 32-bit seqNum and length
+    static const size_t EXT_HEADER_SIZE = 16;
+
+    // Extended header followed by the 64-bit timestamp
+    static const size_t MAX_HEADER_SIZE = EXT_HEADER_SIZE + 8;
+
+    // Extended header format version
+    static const uint8_t EXT_VERSION = 1;
+
+    // Extended header flags
+    static const uint8_t FLAG_BATCHED = 0x01;       // Payload holds several records
+    static const uint8_t FLAG_COMPRESSED = 0x02;    // Payload is compressed
+    static const uint8_t FLAG_FRAGMENTED = 0x04;    // Payload is one fragment of a message
+    static const uint8_t FLAG_TIMESTAMP = 0x80;     // 64-bit send timestamp follows
+
     // Constructor
     DmqHeader() = default;
-    DmqHeader(uint16_t id, uint16_t seqNum, uint16_t length = 0)
+    DmqHeader(uint16_t id, uint32_t seqNum, uint32_t length = 0)
         : m_id(id), m_seqNum(seqNum), m_length(length) {
     }
 
@@ -33,28 +61,70 @@ public:
 
     uint16_t GetMarker() const { return m_marker; }
     uint16_t GetId()     const { return m_id; }
-    uint16_t GetSeqNum() const { return m_seqNum; }
-    uint16_t GetLength() const { return m_length; }
+    uint16_t GetSeqNum() const { return static_cast<uint16_t>(m_seqNum); }
+    uint32_t GetLength() const { return m_length; }
+
+    /// The full sequence number. Equals `GetSeqNum()` for a standard header.
+    uint32_t GetSeqNum32() const { return m_seqNum; }
+
+    /// The sequence number as carried on the wire: all 32 bits in the extended
+    /// format, the low 16 bits otherwise. TransportMonitor entries and ACKs use it.
+    uint32_t GetWireSeqNum() const { return IsExtended() ? m_seqNum : static_cast<uint16_t>(m_seqNum); }
+
+    uint8_t GetFlags() const { return m_flags; }
+
+    /// The sender's timestamp in microseconds since the Unix epoch, or 0 if none.
+    uint64_t GetTimestamp() const { return m_timestamp; }
+
+    /// @return `true` if the header is written in the extended wire format.
+    /// Set explicitly, or implied by flags or a length too large for 16 bits.
+    bool IsExtended() const { return m_extended || m_flags != 0 || m_length > UINT16_MAX; }
+
+    /// @return The number of bytes the header occupies on the wire.
+    size_t GetWireSize() const {
+        if (!IsExtended())
+            return HEADER_SIZE;
+        return (m_flags & FLAG_TIMESTAMP) ? MAX_HEADER_SIZE : EXT_HEADER_SIZE;
+    }
 
     // --- Setters (Store Host Native Values) ---
 
     void SetId(uint16_t id) { m_id = id; }
-    void SetSeqNum(uint16_t seqNum) { m_seqNum = seqNum; }
+    void SetSeqNum(uint32_t seqNum) { m_seqNum = seqNum; }
     void SetMarker(uint16_t marker) { m_marker = marker; }
-    void SetLength(uint16_t length) { m_length = length; }
+    void SetLength(uint32_t length) { m_length = length; }
+    void SetFlags(uint8_t flags) { m_flags = flags; }
+    void SetExtended(bool extended) { m_extended = extended; }
+
+    /// Set the send timestamp. Implies the extended format.
+    /// @param[in] timestamp Microseconds since the Unix epoch.
+    void SetTimestamp(uint64_t timestamp) {
+        m_timestamp = timestamp;
+        m_flags |= FLAG_TIMESTAMP;
+    }
 
-    // Thread-safe sequence number generation
-    static uint16_t GetNextSeqNum()
+    // Thread-safe sequence number generation. Standard headers carry the low 16 bits.
+    static uint32_t GetNextSeqNum()
     {
-        static std::atomic<uint16_t> seqNum(0);
+        static std::atomic<uint32_t> seqNum(0);
         return seqNum.fetch_add(1);
     }
 
+    /// @return The current time in microseconds since the Unix epoch, for `SetTimestamp()`.
+    static uint64_t GetTimestampNow()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    }
+
 private:
     uint16_t m_marker = MARKER;          // Static marker value
     uint16_t m_id = 0;                   // DelegateRemoteId
-    uint16_t m_seqNum = 0;               // Sequence number
-    uint16_t m_length = 0;               // Payload length
+    uint32_t m_seqNum = 0;               // Sequence number
+    uint32_t m_length = 0;               // Payload length
+    uint64_t m_timestamp = 0;            // Send timestamp (extended only)
+    uint8_t m_flags = 0;                 // FLAG_* bits (extended only)
+    bool m_extended = false;             // Write the extended format
 };
 
 } // namespace dmq::transport
@@ -2,6 +2,7 @@
 #define ITRANSPORT_H
 
 #include "DmqHeader.h"
+#include "TransportBuffer.h"
 #include "../../delegate/DelegateOpt.h"
 
 namespace dmq::transport {
@@ -17,11 +18,55 @@ public:
     /// @return 0 if success.
     virtual int Send(dmq::xostringstream& os, const DmqHeader& header) = 0;
 
+    /// Send a header and a payload gathered from one or more buffers. Transports
+    /// that override this write the header and buffers with a single gather call
+    /// (e.g. `sendmsg()`/`writev()`) without intermediate copies. The default
+    /// implementation copies the buffers into a stream and calls `Send()`.
+    /// @param[in] header The header to send. The length field is set by the transport.
+    /// @param[in] buffers The payload buffers, sent in order.
+    /// @param[in] count The number of buffers.
+    /// @return 0 if success.
+    virtual int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count)
+    {
+        dmq::xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        for (size_t i = 0; i < count; i++)
+            os.write(static_cast<const char*>(buffers[i].data), buffers[i].size);
+        return Send(os, header);
+    }
+
+    /// @return `true` if `SendBuffers()` is implemented without copying. Callers
+    /// holding a stream should prefer `Send()` when this returns `false`.
+    virtual bool SupportsBufferSend() const { return false; }
+
     /// Receive data from a remote
     /// @param[out] is The received incoming data bytes, not including the header.
     /// @param[out] header Incoming delegate message header.
     /// @return 0 if success.
     virtual int Receive(dmq::xstringstream& is, DmqHeader& header) = 0;
+
+    /// @return `true` if the transport already holds a received message, so the next
+    /// `Receive()` returns without waiting or a system call. Batching transports
+    /// (e.g. `recvmmsg()`) override this to let callers drain a burst in one loop.
+    virtual bool HasPending() const { return false; }
+
+    /// Receive one message and view its payload in the transport's receive buffer
+    /// instead of copying it into a stream. Pass the payload to
+    /// `IRemoteInvoker::InvokeSpan()` to deserialize it in place. ACK and
+    /// monitor handling are the same as for `Receive()`.
+    /// @param[out] payload The payload bytes, not including the header. Valid until
+    /// the next `Receive()`/`ReceiveView()` call on this transport, or `Close()`.
+    /// @param[out] header Incoming delegate message header.
+    /// @return 0 if success. -1 if not supported; see `SupportsReceiveView()`.
+    virtual int ReceiveView(TransportBuffer& payload, DmqHeader& header)
+    {
+        (void)payload;
+        (void)header;
+        return -1;
+    }
+
+    /// @return `true` if `ReceiveView()` is implemented. Callers should prefer it
+    /// over `Receive()` when this returns `true`.
+    virtual bool SupportsReceiveView() const { return false; }
 };
 
 } // namespace dmq::transport
@@ -12,13 +12,13 @@ class ITransportMonitor
 {
 public:
     /// Add a sequence number
-    /// param[in] seqNum - the message sequence number
+    /// param[in] seqNum - the message sequence number as sent (DmqHeader::GetWireSeqNum())
     /// param[in] remoteId - the remote ID
-    virtual void Add(uint16_t seqNum, dmq::DelegateRemoteId remoteId) = 0;
+    virtual void Add(uint32_t seqNum, dmq::DelegateRemoteId remoteId) = 0;
 
     /// Remove a sequence number
     /// param[in] seqNum - the message sequence number
-    virtual void Remove(uint16_t seqNum) = 0;
+    virtual void Remove(uint32_t seqNum) = 0;
 };
 
 } // namespace dmq::transport
@@ -0,0 +1,187 @@
+#ifndef TRANSPORT_BUFFER_H
+#define TRANSPORT_BUFFER_H
+
+/// @file
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Helpers for the scatter/gather `ITransport::SendBuffers()` path.
+///
+/// @details
+/// `TransportBuffer` describes a read-only contiguous block of payload bytes.
+/// A transport gathers the wire header and one or more buffers into a single
+/// `sendmsg()`/`writev()` call (or equivalent) instead of first copying the
+/// payload out of the stream with `str()` and then into a second stream.
+
+#include "DmqHeader.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace dmq::transport {
+
+/// @brief A read-only view of contiguous bytes. The caller owns the memory,
+/// which must remain valid for the duration of the send call.
+struct TransportBuffer
+{
+    const void* data = nullptr;
+    size_t size = 0;
+};
+
+/// Total number of bytes in a buffer list.
+inline size_t GetBufferSize(const TransportBuffer* buffers, size_t count)
+{
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++)
+        size += buffers[i].size;
+    return size;
+}
+
+/// Get a view of the bytes written to a string stream without copying them.
+/// @details Valid for `xostringstream`/`xstringstream` (any `std::basic_stringbuf`),
+/// whose written bytes are contiguous in the put area. The view is invalidated
+/// by any further write to the stream.
+/// @param[in] os The output string stream.
+/// @return The written bytes.
+inline TransportBuffer GetStreamBuffer(std::ostream& os)
+{
+    // Member pointers to the protected put/get area accessors are legal to form
+    // from a derived class and to invoke on any std::streambuf instance.
+    struct Access : std::streambuf
+    {
+        static TransportBuffer Get(std::streambuf* sb)
+        {
+            const char* begin = (sb->*(&Access::pbase))();
+            const char* end = (sb->*(&Access::pptr))();
+
+            // Stream opened in/out and repositioned: the get area can end past pptr
+            const char* egptr = (sb->*(&Access::egptr))();
+            if (egptr && (sb->*(&Access::eback))() == begin && egptr > end)
+                end = egptr;
+
+            TransportBuffer buffer;
+            buffer.data = begin;
+            buffer.size = begin ? static_cast<size_t>(end - begin) : 0;
+            return buffer;
+        }
+    };
+
+    std::streambuf* sb = os.rdbuf();
+    if (!sb)
+        return TransportBuffer();
+    return Access::Get(sb);
+}
+
+/// Encode a header into its wire format (Network Byte Order).
+/// @details A standard header is 8 bytes: marker, ID, sequence number and length,
+/// 16 bits each. An extended header (`DmqHeader::IsExtended()`) is:
+/// @code
+///   Offset  Size  Field
+///   0       2     MARKER_EXT
+///   2       2     ID
+///   4       1     Version (EXT_VERSION)
+///   5       1     Flags
+///   6       2     Reserved (0)
+///   8       4     Sequence number
+///   12      4     Length
+///   16      8     Timestamp, present only if FLAG_TIMESTAMP is set
+/// @endcode
+/// @param[in] header The header to encode.
+/// @param[out] out Destination of at least `header.GetWireSize()` bytes.
+/// @return The number of bytes written.
+inline size_t WriteHeader(const DmqHeader& header, uint8_t* out)
+{
+    auto put = [&out](uint64_t value, size_t bytes) {
+        for (size_t i = 0; i < bytes; i++)
+            *out++ = static_cast<uint8_t>(value >> (8 * (bytes - 1 - i)));
+    };
+
+    if (!header.IsExtended())
+    {
+        put(header.GetMarker(), 2);
+        put(header.GetId(), 2);
+        put(header.GetSeqNum(), 2);
+        put(header.GetLength(), 2);
+        return DmqHeader::HEADER_SIZE;
+    }
+
+    put(DmqHeader::MARKER_EXT, 2);
+    put(header.GetId(), 2);
+    put(DmqHeader::EXT_VERSION, 1);
+    put(header.GetFlags(), 1);
+    put(0, 2);
+    put(header.GetSeqNum32(), 4);
+    put(header.GetLength(), 4);
+    if (header.GetFlags() & DmqHeader::FLAG_TIMESTAMP)
+        put(header.GetTimestamp(), 8);
+    return header.GetWireSize();
+}
+
+/// Decode a standard 8-byte header (Network Byte Order).
+/// @param[in] in Source of at least DmqHeader::HEADER_SIZE bytes.
+/// @param[out] header The decoded header. The marker is not validated.
+inline void ReadHeader(const uint8_t* in, DmqHeader& header)
+{
+    auto field = [in](size_t i) {
+        return static_cast<uint16_t>((in[i * 2] << 8) | in[i * 2 + 1]);
+    };
+    header.SetMarker(field(0));
+    header.SetId(field(1));
+    header.SetSeqNum(field(2));
+    header.SetLength(field(3));
+}
+
+/// Get the wire size of a header from its leading bytes.
+/// @param[in] in Source of at least DmqHeader::HEADER_SIZE bytes.
+/// @return The size of the whole header, or 0 if the marker or extended version
+/// is unknown.
+inline size_t PeekHeaderSize(const uint8_t* in)
+{
+    const uint16_t marker = static_cast<uint16_t>((in[0] << 8) | in[1]);
+    if (marker == DmqHeader::MARKER)
+        return DmqHeader::HEADER_SIZE;
+    if (marker != DmqHeader::MARKER_EXT || in[4] != DmqHeader::EXT_VERSION)
+        return 0;
+    return (in[5] & DmqHeader::FLAG_TIMESTAMP) ? DmqHeader::MAX_HEADER_SIZE : DmqHeader::EXT_HEADER_SIZE;
+}
+
+/// Decode a standard or extended header (Network Byte Order).
+/// @details An extended header is decoded with its marker set to
+/// `DmqHeader::MARKER`, so receivers validate both formats the same way.
+/// @param[in] in The received bytes.
+/// @param[in] size The number of received bytes.
+/// @param[out] header The decoded header.
+/// @return The header's size on the wire, or 0 if the marker or extended
+/// version is unknown or `size` is too short to hold the whole header.
+inline size_t ReadHeader(const uint8_t* in, size_t size, DmqHeader& header)
+{
+    if (size < DmqHeader::HEADER_SIZE)
+        return 0;
+    const size_t headerSize = PeekHeaderSize(in);
+    if (headerSize == 0 || size < headerSize)
+        return 0;
+    if (headerSize == DmqHeader::HEADER_SIZE)
+    {
+        ReadHeader(in, header);
+        return headerSize;
+    }
+
+    auto get = [in](size_t offset, size_t bytes) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++)
+            value = (value << 8) | in[offset + i];
+        return value;
+    };
+
+    header = DmqHeader(static_cast<uint16_t>(get(2, 2)), static_cast<uint32_t>(get(8, 4)),
+        static_cast<uint32_t>(get(12, 4)));
+    header.SetExtended(true);
+    header.SetFlags(in[5]);
+    if (header.GetFlags() & DmqHeader::FLAG_TIMESTAMP)
+        header.SetTimestamp(get(16, 8));
+    return headerSize;
+}
+
+} // namespace dmq::transport
+
+#endif
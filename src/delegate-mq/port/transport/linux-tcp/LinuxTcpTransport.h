@@ -17,12 +17,21 @@
 ///    relying on OS-level thread safety for concurrent Send/Receive operations.
 /// 2. **Low Latency**: Configures `TCP_NODELAY` to disable Nagle's algorithm, optimized 
 ///    for the small, frequent packets typical of RPC/delegate calls.
-/// 3. **Non-Blocking Poll**: Utilizes `select()` in the receive loop to prevent 
-///    thread blocking when no data is available, facilitating clean shutdowns.
-/// 4. **Multi-Client Multiplexing**: SERVER mode manages a list of clients and 
-///    polls them for data using `select()`.
+/// 3. **Non-Blocking Poll**: Utilizes `select()` (CLIENT) or `epoll_wait()` (SERVER) 
+///    with a short timeout to prevent thread blocking when no data is available, 
+///    facilitating clean shutdowns.
+/// 4. **Multi-Client Reactor**: SERVER mode uses an edge-triggered `epoll` reactor.
+///    New clients are accepted without blocking, and every readable client is drained
+///    into a per-connection buffer that reassembles partial `DmqHeader` frames. One
+///    `epoll_wait()` batch yields all complete frames, which subsequent `Receive()` calls
+///    return without further system calls. There is no `FD_SETSIZE` limit and the cost
+///    of a poll is O(ready clients), not O(clients).
 /// 5. **Reliability**: Fully integrated with `TransportMonitor` to handle sequence 
 ///    tracking and ACK generation.
+/// 6. **Isolated Broadcast**: SERVER mode sends to each client outside the client list
+///    lock, so a slow client does not stall accepts or removals. A client that cannot
+///    take a whole frame within the send timeout is shut down rather than left with a
+///    partial frame followed by the next one.
 /// 
 /// @note This class is specific to Linux and uses POSIX socket APIs.
 
@@ -33,8 +42,13 @@
 #include <arpa/inet.h>
 #include <sys/socket.h>
 #include <netinet/tcp.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <errno.h>
 #include <vector>
+#include <memory>
 #include <algorithm>
 
 #include "delegate/DelegateOpt.h"
@@ -80,7 +94,17 @@ public:
             int opt = 1;
             setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
             if (bind(m_socket, (struct sockaddr*)&srv_addr, sizeof(srv_addr)) < 0) return -1;
-            if (listen(m_socket, 5) < 0) return -1;
+            if (listen(m_socket, SOMAXCONN) < 0) return -1;
+
+            // Edge-triggered reactor: the listen socket must not block in accept()
+            fcntl(m_socket, F_SETFL, fcntl(m_socket, F_GETFL, 0) | O_NONBLOCK);
+            m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+            if (m_epollFd < 0) return -1;
+
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLET;
+            ev.data.ptr = nullptr;  // nullptr identifies the listen socket
+            if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_socket, &ev) < 0) return -1;
         }
         else {
             if (connect(m_socket, (struct sockaddr*)&srv_addr, sizeof(srv_addr)) < 0) return -1;
@@ -107,12 +131,22 @@ public:
             }
         }
 
-        // Close all server-accepted clients
-        for (auto s : m_serverClients) {
-            shutdown(s, SHUT_RDWR);
-            close(s);
+        // Close all server-accepted clients. A broadcast in progress holds its own
+        // reference; the socket is closed when the last reference is released.
+        {
+            dmq::LockGuard<dmq::Mutex> lock(m_connLock);
+            for (auto& conn : m_connections)
+                shutdown(conn->fd, SHUT_RDWR);
+            m_connections.clear();
+        }
+        m_ready.clear();
+        m_readyPos = 0;
+
+        if (m_epollFd >= 0)
+        {
+            close(m_epollFd);
+            m_epollFd = -1;
         }
-        m_serverClients.clear();
 
         // Close Listen Socket
         if (m_socket >= 0) 
@@ -136,26 +170,69 @@ public:
         {
             setsockopt(m_connFd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
         }
-        for (auto s : m_serverClients) {
-            setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
-        }
+    }
+
+    /// @brief Set how long a send waits for socket buffer space.
+    /// @details In SERVER mode, a client that cannot take a whole frame within this
+    /// time is shut down and removed.
+    void SetSendTimeout(std::chrono::milliseconds timeout)
+    {
+        m_sendTimeout = timeout;
     }
 
     /// @brief Send data over the TCP link.
     /// @details In SERVER mode, this broadcasts to all connected clients.
     virtual int Send(xostringstream& os, const DmqHeader& header) override
     {
+        TransportBuffer payload = GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    /// @brief Send the header and payload buffers with a single writev() per socket.
+    /// @details In SERVER mode, this broadcasts to all connected clients.
+    virtual int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count) override
+    {
+        if (count > MAX_SEND_BUFFERS)
+            return ITransport::SendBuffers(header, buffers, count);
+
+        DmqHeader headerCopy = header;
+        headerCopy.SetLength(static_cast<uint32_t>(GetBufferSize(buffers, count)));
+        if (m_extendedHeader)
+            headerCopy.SetExtended(true);
+        if (m_headerTimestamp)
+            headerCopy.SetTimestamp(DmqHeader::GetTimestampNow());
+
+        // Convert to Network Byte Order (Big Endian)
+        uint8_t headerBytes[DmqHeader::MAX_HEADER_SIZE];
+        size_t headerSize = WriteHeader(headerCopy, headerBytes);
+
+        struct iovec iov[MAX_SEND_BUFFERS + 1];
+        iov[0].iov_base = headerBytes;
+        iov[0].iov_len = headerSize;
+        for (size_t i = 0; i < count; i++) {
+            iov[i + 1].iov_base = const_cast<void*>(buffers[i].data);
+            iov[i + 1].iov_len = buffers[i].size;
+        }
+
         if (m_type == Type::CLIENT) {
-            return SendToSocket(m_connFd, os, header);
+            return SendToSocket(m_connFd, headerCopy, iov, count + 1);
         } else {
-            int lastErr = 0;
-            for (auto s : m_serverClients) {
-                if (SendToSocket(s, os, header) != 0) lastErr = -1;
-            }
-            return lastErr;
+            return Broadcast(headerCopy, iov, count + 1);
         }
     }
 
+    virtual bool SupportsBufferSend() const override { return true; }
+
+    /// @brief Send headers in the extended format (32-bit sequence number and length).
+    /// @details Enable only if every peer understands it. Both formats are always
+    /// received, and a payload over 64 KB is always sent with an extended header.
+    /// @param[in] enable Use the extended header for every message.
+    /// @param[in] timestamp Also stamp each message with its send time.
+    void SetExtendedHeader(bool enable, bool timestamp = false) {
+        m_extendedHeader = enable || timestamp;
+        m_headerTimestamp = timestamp;
+    }
+
     /// @brief Receive data from the TCP link.
     virtual int Receive(xstringstream& is, DmqHeader& header) override
     {
@@ -177,85 +254,291 @@ public:
     }
 
 private:
-    /// @brief Internal helper to send to a specific socket.
-    int SendToSocket(int fd, xostringstream& os, const DmqHeader& header) {
-        if (fd < 0) return -1;
-
-        auto payload = os.str();
-        DmqHeader headerCopy = header;
-        headerCopy.SetLength(static_cast<uint16_t>(payload.length()));
+    /// @brief A server-accepted client and its frame reassembly buffer.
+    /// @details Bytes `[begin, end)` of `buf` are received but not yet returned.
+    /// Only the receive thread touches the buffer. `Send()` writes to `fd` under
+    /// `sendLock` while holding a reference, so the socket stays open until the last
+    /// reference is released.
+    struct Connection
+    {
+        ~Connection() { if (fd >= 0) close(fd); }
+
+        int fd = -1;
+        dmq::Mutex sendLock;    // Serializes frames from concurrent Send() calls
+        bool broken = false;    // Shut down after a failed send; guarded by sendLock
+        std::vector<char> buf;
+        size_t begin = 0;
+        size_t end = 0;
+        bool ready = false;     // Listed in m_ready
+        size_t need = 0;        // Bytes of the incomplete frame at begin
+        bool more = false;      // Read stopped at RECV_BUFFER_LIMIT; socket not drained
+        bool closed = false;    // Peer closed or error; remove once drained
+    };
+
+    /// @brief Send one frame to every server-accepted client.
+    /// @details The client list is copied under `m_connLock` and each client is
+    /// written outside it. A client whose send fails may hold a partial frame, so it
+    /// is shut down; the receive thread then removes it.
+    /// @return 0 if every client took the frame, otherwise -1.
+    int Broadcast(const DmqHeader& header, const struct iovec* iov, size_t iovCount) {
+        std::vector<std::shared_ptr<Connection>> targets;
+        {
+            dmq::LockGuard<dmq::Mutex> lock(m_connLock);
+            targets = m_connections;
+        }
 
-        xostringstream ss(std::ios::binary);
-        
-        // Convert to Network Byte Order (Big Endian)
-        uint16_t marker = htons(headerCopy.GetMarker());
-        uint16_t id     = htons(headerCopy.GetId());
-        uint16_t seqNum = htons(headerCopy.GetSeqNum());
-        uint16_t length = htons(headerCopy.GetLength());
+        int lastErr = 0;
+        for (auto& conn : targets) {
+            dmq::LockGuard<dmq::Mutex> lock(conn->sendLock);
+            if (conn->broken) {
+                lastErr = -1;
+                continue;
+            }
+            if (SendToSocket(conn->fd, header, iov, iovCount) != 0) {
+                conn->broken = true;
+                shutdown(conn->fd, SHUT_RDWR);
+                lastErr = -1;
+            }
+        }
+        return lastErr;
+    }
 
-        ss.write((char*)&marker, 2);
-        ss.write((char*)&id, 2);
-        ss.write((char*)&seqNum, 2);
-        ss.write((char*)&length, 2);
-        ss.write(payload.data(), payload.size());
+    /// @brief Internal helper to send to a specific socket.
+    /// @details Writes the whole iovec list, resuming after partial writes. Waits up
+    /// to the send timeout for buffer space each time the socket is full.
+    int SendToSocket(int fd, const DmqHeader& header, const struct iovec* iovIn, size_t iovCount) {
+        if (fd < 0) return -1;
 
-        auto packet = ss.str();
+        // Local copy; advanced in place on partial writes
+        struct iovec iov[MAX_SEND_BUFFERS + 1];
+        memcpy(iov, iovIn, iovCount * sizeof(struct iovec));
+        struct iovec* cur = iov;
+        size_t remaining = iovCount;
+
+        while (remaining > 0) {
+            // sendmsg() rather than writev(): a closed peer must not raise SIGPIPE
+            struct msghdr msg{};
+            msg.msg_iov = cur;
+            msg.msg_iovlen = remaining;
+            ssize_t sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    // Non-blocking server client: wait for send buffer space
+                    pollfd pfd{ fd, POLLOUT, 0 };
+                    if (poll(&pfd, 1, static_cast<int>(m_sendTimeout.count())) > 0) continue;
+                }
+                return -1;
+            }
 
-        ssize_t sent = write(fd, packet.data(), packet.size());
-        if (sent != (ssize_t)packet.size()) return -1;
+            size_t n = static_cast<size_t>(sent);
+            while (remaining > 0 && n >= cur->iov_len) {
+                n -= cur->iov_len;
+                cur++;
+                remaining--;
+            }
+            if (remaining > 0) {
+                cur->iov_base = static_cast<char*>(cur->iov_base) + n;
+                cur->iov_len -= n;
+            }
+        }
 
-        if (headerCopy.GetId() != dmq::ACK_REMOTE_ID && m_transportMonitor)
-            m_transportMonitor->Add(headerCopy.GetSeqNum(), headerCopy.GetId());
+        if (header.GetId() != dmq::ACK_REMOTE_ID && m_transportMonitor)
+            m_transportMonitor->Add(header.GetWireSeqNum(), header.GetId());
 
         return 0;
     }
 
     /// @brief Internal helper to handle server-side multiplexing.
+    /// @details Returns the next complete frame from the current readiness batch.
+    /// When the batch is exhausted, waits once on `epoll_wait()` and collects the
+    /// next batch.
     int ReceiveServer(xstringstream& is, DmqHeader& header) {
-        // 1. Lazy Accept: Check for new client connections
-        fd_set fds;
-        FD_ZERO(&fds);
-        FD_SET(m_socket, &fds);
-        struct timeval tv = { 0, 1000 }; // 1ms poll
-
-        if (select(m_socket + 1, &fds, nullptr, nullptr, &tv) > 0) {
-            int client = accept(m_socket, nullptr, nullptr);
-            if (client >= 0) {
-                struct timeval t;
-                t.tv_sec = m_recvTimeout.count() / 1000;
-                t.tv_usec = (m_recvTimeout.count() % 1000) * 1000;
-                setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &t, sizeof(t));
-                m_serverClients.push_back(client);
+        if (m_epollFd < 0) return -1;
+
+        bool polled = false;
+        for (;;) {
+            while (m_readyPos < m_ready.size()) {
+                Connection* conn = m_ready[m_readyPos];
+                if (ExtractFrame(*conn, is, header))
+                    return 0;
+
+                // Socket left undrained at the buffer limit; continue reading
+                if (conn->more && !conn->closed) {
+                    ReadAvailable(*conn);
+                    continue;
+                }
+
+                conn->ready = false;
+                m_readyPos++;
+                if (conn->closed)
+                    RemoveConnection(conn);
             }
+            m_ready.clear();
+            m_readyPos = 0;
+
+            if (polled || PollEvents() <= 0)
+                return -1;
+            polled = true;
         }
+    }
 
-        // 2. Poll all connected clients for data
-        if (m_serverClients.empty()) return -1;
+    /// @brief Wait for one readiness batch. Accept new clients and read every
+    /// readable client until EAGAIN.
+    /// @return The number of events, 0 on timeout, or -1 on error.
+    int PollEvents() {
+        epoll_event events[MAX_EPOLL_EVENTS];
+        int n = epoll_wait(m_epollFd, events, MAX_EPOLL_EVENTS, EPOLL_WAIT_MS);
+        for (int i = 0; i < n; i++) {
+            Connection* conn = static_cast<Connection*>(events[i].data.ptr);
+            if (!conn) {
+                AcceptClients();
+                continue;
+            }
 
-        fd_set readfds;
-        FD_ZERO(&readfds);
-        int max_fd = -1;
-        for (auto s : m_serverClients) {
-            FD_SET(s, &readfds);
-            if (s > max_fd) max_fd = s;
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+                ReadAvailable(*conn);
+            if (!conn->ready) {
+                conn->ready = true;
+                m_ready.push_back(conn);
+            }
         }
+        return n;
+    }
 
-        tv.tv_usec = 1000; // 1ms poll
-        if (select(max_fd + 1, &readfds, nullptr, nullptr, &tv) > 0) {
-            for (auto it = m_serverClients.begin(); it != m_serverClients.end(); ) {
-                if (FD_ISSET(*it, &readfds)) {
-                    int result = ReceiveSocket(*it, is, header);
-                    if (result == -2) { // Disconnected
-                        close(*it);
-                        it = m_serverClients.erase(it);
-                        continue; 
-                    }
-                    return result;
-                }
-                ++it;
+    /// @brief Accept all pending clients (edge-triggered listen socket).
+    void AcceptClients() {
+        for (;;) {
+            int client = accept4(m_socket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (client < 0) {
+                if (errno == EINTR) continue;
+                return;  // EAGAIN: backlog empty
             }
+
+            int flag = 1;
+            setsockopt(client, IPPROTO_TCP, TCP_NODELAY, (char*)&flag, sizeof(int));
+
+            std::shared_ptr<Connection> conn(new(std::nothrow) Connection());
+            if (!conn) {
+                close(client);
+                continue;
+            }
+            conn->fd = client;
+
+            // Registering reports data that arrived before the add
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+            ev.data.ptr = conn.get();
+            if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, client, &ev) < 0)
+                continue;   // conn closes the socket
+
+            dmq::LockGuard<dmq::Mutex> lock(m_connLock);
+            m_connections.push_back(std::move(conn));
+        }
+    }
+
+    /// @brief Read from a non-blocking client until EAGAIN, EOF or the buffer limit.
+    void ReadAvailable(Connection& conn) {
+        conn.more = false;
+        for (;;) {
+            size_t limit = conn.need > RECV_BUFFER_LIMIT ? conn.need : RECV_BUFFER_LIMIT;
+            if (conn.end - conn.begin >= limit) {
+                conn.more = true;
+                return;
+            }
+
+            // Reclaim consumed space, then ensure room for a full read
+            if (conn.begin == conn.end) {
+                conn.begin = conn.end = 0;
+            } else if (conn.begin > 0 && conn.buf.size() - conn.end < RECV_CHUNK) {
+                memmove(conn.buf.data(), conn.buf.data() + conn.begin, conn.end - conn.begin);
+                conn.end -= conn.begin;
+                conn.begin = 0;
+            }
+            if (conn.buf.size() - conn.end < RECV_CHUNK)
+                conn.buf.resize(std::max(conn.buf.size() * 2, conn.end + RECV_CHUNK));
+
+            ssize_t r = read(conn.fd, conn.buf.data() + conn.end, conn.buf.size() - conn.end);
+            if (r > 0) {
+                conn.end += static_cast<size_t>(r);
+                continue;
+            }
+            if (r < 0 && errno == EINTR)
+                continue;
+            if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                return;
+            conn.closed = true;  // EOF or error
+            return;
+        }
+    }
+
+    /// @brief Return the next complete frame buffered on a connection.
+    /// @details Bytes preceding a valid marker are discarded to resynchronize the stream.
+    /// @return `true` if a frame was returned.
+    bool ExtractFrame(Connection& conn, xstringstream& is, DmqHeader& header) {
+        for (;;) {
+            size_t avail = conn.end - conn.begin;
+            if (avail < DmqHeader::HEADER_SIZE) return false;
+
+            const uint8_t* p = reinterpret_cast<const uint8_t*>(conn.buf.data() + conn.begin);
+            size_t headerSize = PeekHeaderSize(p);
+            if (headerSize == 0) {
+                conn.begin++;
+                continue;
+            }
+            if (avail < headerSize) return false;
+
+            DmqHeader frame;
+            ReadHeader(p, avail, frame);
+            if (frame.GetLength() > MAX_RECV_PAYLOAD) {
+                conn.begin++;   // Corrupt length; resynchronize
+                continue;
+            }
+
+            size_t frameSize = headerSize + frame.GetLength();
+            if (avail < frameSize) {
+                conn.need = frameSize;
+                return false;
+            }
+            conn.need = 0;
+
+            header = frame;
+            if (frame.GetLength() > 0)
+                is.write(reinterpret_cast<const char*>(p + headerSize), frame.GetLength());
+            conn.begin += frameSize;
+
+            HandleAck(header);
+            return true;
+        }
+    }
+
+    /// @brief Unregister and release a client. Called on the receive thread. The
+    /// socket is closed once a broadcast in progress releases its reference.
+    void RemoveConnection(Connection* conn) {
+        epoll_ctl(m_epollFd, EPOLL_CTL_DEL, conn->fd, nullptr);
+        std::shared_ptr<Connection> removed;
+        dmq::LockGuard<dmq::Mutex> lock(m_connLock);
+        auto it = std::find_if(m_connections.begin(), m_connections.end(),
+            [conn](const std::shared_ptr<Connection>& c) { return c.get() == conn; });
+        if (it != m_connections.end()) {
+            removed = std::move(*it);
+            m_connections.erase(it);
+        }
+    }
+
+    /// @brief Complete an ACK from the remote, or send an ACK for a received message.
+    void HandleAck(const DmqHeader& header) {
+        if (header.GetId() == dmq::ACK_REMOTE_ID) {
+            if (m_transportMonitor) m_transportMonitor->Remove(header.GetSeqNum32());
+        }
+        else if (m_sendTransport) {
+            xostringstream ss_ack;
+            DmqHeader ack;
+            ack.SetId(dmq::ACK_REMOTE_ID);
+            ack.SetSeqNum(header.GetSeqNum32());
+            ack.SetExtended(header.IsExtended());  // Echo the full sequence number
+            m_sendTransport->Send(ss_ack, ack);
         }
-        return -1;
     }
 
     /// @brief Internal helper to read from a specific socket and parse DMQ protocol.
@@ -268,26 +551,22 @@ private:
         struct timeval tv = { 0, 1000 };
         if (select(fd + 1, &readfds, nullptr, nullptr, &tv) <= 0) return -1;
 
-        // 1. Read Header
-        char headerBuf[DmqHeader::HEADER_SIZE];
-        if (!ReadExact(fd, headerBuf, DmqHeader::HEADER_SIZE)) return -2; // Disconnected
+        // 1. Read Header; an extended header continues past the first 8 bytes
+        uint8_t headerBuf[DmqHeader::MAX_HEADER_SIZE];
+        if (!ReadExact(fd, reinterpret_cast<char*>(headerBuf), DmqHeader::HEADER_SIZE)) return -2; // Disconnected
 
-        xstringstream ss(std::ios::in | std::ios::out | std::ios::binary);
-        ss.write(headerBuf, DmqHeader::HEADER_SIZE);
-        ss.seekg(0);
+        size_t headerSize = PeekHeaderSize(headerBuf);
+        if (headerSize == 0) return -1;
+        if (headerSize > DmqHeader::HEADER_SIZE &&
+            !ReadExact(fd, reinterpret_cast<char*>(headerBuf) + DmqHeader::HEADER_SIZE, headerSize - DmqHeader::HEADER_SIZE))
+            return -2;
 
-        uint16_t val;
-
-        // Read Marker (Convert Network -> Host)
-        ss.read((char*)&val, 2); header.SetMarker(ntohs(val));
-        if (header.GetMarker() != DmqHeader::MARKER) return -1;
-
-        ss.read((char*)&val, 2); header.SetId(ntohs(val));
-        ss.read((char*)&val, 2); header.SetSeqNum(ntohs(val));
-        ss.read((char*)&val, 2); header.SetLength(ntohs(val));
+        // Convert Network -> Host
+        ReadHeader(headerBuf, headerSize, header);
+        if (header.GetLength() > MAX_RECV_PAYLOAD) return -1;
 
         // 2. Read Payload
-        uint16_t length = header.GetLength();
+        uint32_t length = header.GetLength();
         if (length > 0) {
             m_recvBuf.resize(length);
             if (!ReadExact(fd, m_recvBuf.data(), length)) return -2;
@@ -295,16 +574,7 @@ private:
         }
 
         // 3. Handle Acknowledgment
-        if (header.GetId() == dmq::ACK_REMOTE_ID) {
-            if (m_transportMonitor) m_transportMonitor->Remove(header.GetSeqNum());
-        }
-        else if (m_sendTransport) {
-            xostringstream ss_ack;
-            DmqHeader ack;
-            ack.SetId(dmq::ACK_REMOTE_ID);
-            ack.SetSeqNum(header.GetSeqNum());
-            m_sendTransport->Send(ss_ack, ack);
-        }
+        HandleAck(header);
         return 0;
     }
 
@@ -322,13 +592,38 @@ private:
 
     int m_socket = -1;
     int m_connFd = -1;
-    std::vector<int> m_serverClients;
+    int m_epollFd = -1;
+    std::vector<std::shared_ptr<Connection>> m_connections;
+    dmq::Mutex m_connLock;              // Guards m_connections; not held while sending
+    std::vector<Connection*> m_ready;   // Current readiness batch
+    size_t m_readyPos = 0;
     std::vector<char> m_recvBuf;
     std::chrono::milliseconds m_recvTimeout{2000};
+    std::chrono::milliseconds m_sendTimeout{2000};
     Type m_type = Type::SERVER;
     
     ITransport* m_sendTransport, * m_recvTransport;
     ITransportMonitor* m_transportMonitor = nullptr;
+    bool m_extendedHeader = false;
+    bool m_headerTimestamp = false;
+
+    /// Maximum payload buffers gathered by one writev() call
+    static const size_t MAX_SEND_BUFFERS = 8;
+
+    /// Maximum events collected by one epoll_wait() call
+    static const int MAX_EPOLL_EVENTS = 64;
+
+    /// epoll_wait() timeout when no events are pending
+    static const int EPOLL_WAIT_MS = 1;
+
+    /// Minimum free space per client read() call
+    static const size_t RECV_CHUNK = 4096;
+
+    /// Buffered bytes per client before reading pauses until frames are consumed
+    static const size_t RECV_BUFFER_LIMIT = 256 * 1024;
+
+    /// Largest payload accepted; a larger length is treated as stream corruption
+    static const size_t MAX_RECV_PAYLOAD = 16 * 1024 * 1024;
 };
 
 } // namespace dmq::transport
@@ -21,6 +21,12 @@
 ///    prevent indefinite blocking during polling loops.
 /// 4. **Address Management**: Automatically updates the target address on the receiver 
 ///    side to support reliable bidirectional ACKs.
+/// 5. **Batched I/O**: `Receive()` pulls every queued datagram (up to `RECV_BATCH`) with
+///    one `recvmmsg()` call and returns them from memory on the following calls;
+///    `HasPending()` tells a caller to keep draining. With `SetSendBatch()`, sends are
+///    queued and written together by one `sendmmsg()` call.
+/// 6. **Zero-Copy Receive**: `ReceiveView()` returns the payload in place in the
+///    receive batch buffer.
 /// 
 /// @note This class is specific to Linux and uses POSIX socket APIs.
 
@@ -28,7 +34,9 @@
 #include "port/transport/ITransport.h"
 #include "port/transport/DmqHeader.h"
 #include "port/transport/ITransportMonitor.h"
+#include "UdpBatch.h"
 
+#include <atomic>
 #include <iostream>
 #include <sstream>
 #include <cstring>
@@ -36,6 +44,7 @@
 #include <unistd.h>
 #include <arpa/inet.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <errno.h>
 
@@ -117,6 +126,7 @@ public:
             }
         }
 
+        m_recvBatch.Init(RECV_BATCH, BUFFER_SIZE);
         return 0;
     }
 
@@ -124,6 +134,8 @@ public:
     {
         if (m_socket != -1)
         {
+            Flush();
+
             // SHUT_RDWR breaks the blocking recvfrom() immediately
             shutdown(m_socket, SHUT_RDWR);
             close(m_socket);
@@ -142,6 +154,39 @@ public:
         }
     }
 
+    /// @brief Set the number of datagrams queued before they are sent together.
+    /// @details The default of 1 sends every datagram immediately. With a larger batch,
+    /// call `Flush()` after a burst so the remainder is not held until the batch fills.
+    /// ACKs are never queued.
+    void SetSendBatch(size_t batch)
+    {
+        dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        if (m_sendBatch.Size() > 0 && m_socket != -1)
+            m_sendBatch.Flush(m_socket);
+        batch = batch == 0 ? 1 : (batch > MAX_SEND_BATCH ? MAX_SEND_BATCH : batch);
+        m_sendBatch.Init(batch);
+        m_sendBatchSize.store(batch, std::memory_order_relaxed);
+    }
+
+    /// @brief Send extended headers (32-bit sequence number, optional send timestamp).
+    /// @details Both header formats are always received. Enable only when all
+    /// peers understand the extended format.
+    void SetExtendedHeader(bool enable, bool timestamp = false)
+    {
+        m_extendedHeader = enable || timestamp;
+        m_headerTimestamp = timestamp;
+    }
+
+    /// @brief Send all queued datagrams.
+    /// @return 0 if success.
+    int Flush()
+    {
+        dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        if (m_sendBatch.Size() == 0 || m_socket == -1)
+            return 0;
+        return m_sendBatch.Flush(m_socket);
+    }
+
     virtual int Send(xostringstream& os, const DmqHeader& header) override
     {
         if (os.bad() || os.fail()) {
@@ -149,6 +194,13 @@ public:
             return -1;
         }
 
+        TransportBuffer payload = GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    /// Send the header and payload buffers as one datagram using sendmsg().
+    virtual int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count) override
+    {
         // Allow ACKs on SUB sockets. Block only regular data.
         if (m_type == Type::SUB && header.GetId() != dmq::ACK_REMOTE_ID) {
             std::cerr << "Send operation not allowed on SUB socket." << std::endl;
@@ -160,66 +212,87 @@ public:
             return -1;
         }
 
+        if (count > MAX_SEND_BUFFERS)
+            return ITransport::SendBuffers(header, buffers, count);
+
         // Create a local copy so we can modify the length
         DmqHeader headerCopy = header;
 
         // Calculate payload size and set it
-        auto payload = os.str();
-        if (payload.length() > UINT16_MAX) {
+        size_t payloadSize = GetBufferSize(buffers, count);
+        if (payloadSize > UINT16_MAX) {
             std::cerr << "Error: Payload too large." << std::endl;
             return -1;
         }
-        headerCopy.SetLength(static_cast<uint16_t>(payload.length()));
+        headerCopy.SetLength(static_cast<uint32_t>(payloadSize));
+        if (m_extendedHeader)
+            headerCopy.SetExtended(true);
+        if (m_headerTimestamp)
+            headerCopy.SetTimestamp(DmqHeader::GetTimestampNow());
 
-        xostringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+        if (headerCopy.GetId() != dmq::ACK_REMOTE_ID && m_sendBatchSize.load(std::memory_order_relaxed) > 1)
+            return QueueBuffers(headerCopy, buffers, count);
 
         // Convert to Network Byte Order (Big Endian)
-        uint16_t marker = htons(headerCopy.GetMarker());
-        uint16_t id     = htons(headerCopy.GetId());
-        uint16_t seqNum = htons(headerCopy.GetSeqNum());
-        uint16_t length = htons(headerCopy.GetLength());
-
-        ss.write(reinterpret_cast<const char*>(&marker), sizeof(marker));
-        ss.write(reinterpret_cast<const char*>(&id), sizeof(id));
-        ss.write(reinterpret_cast<const char*>(&seqNum), sizeof(seqNum));
-        ss.write(reinterpret_cast<const char*>(&length), sizeof(length));
-
-        // Append Payload
-        ss.write(payload.data(), payload.size());
+        uint8_t headerBytes[DmqHeader::MAX_HEADER_SIZE];
+        size_t headerSize = WriteHeader(headerCopy, headerBytes);
+
+        // Gather header and payload buffers into one datagram
+        struct iovec iov[MAX_SEND_BUFFERS + 1];
+        iov[0].iov_base = headerBytes;
+        iov[0].iov_len = headerSize;
+        for (size_t i = 0; i < count; i++) {
+            iov[i + 1].iov_base = const_cast<void*>(buffers[i].data);
+            iov[i + 1].iov_len = buffers[i].size;
+        }
 
-        auto data = ss.str();
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &m_addr;
+        msg.msg_namelen = sizeof(m_addr);
+        msg.msg_iov = iov;
+        msg.msg_iovlen = count + 1;
 
-        ssize_t sent = sendto(m_socket, data.c_str(), data.size(), 0,
-            (struct sockaddr*)&m_addr, sizeof(m_addr));
-        if (sent != (ssize_t)data.size()) return -1;
+        ssize_t sent = sendmsg(m_socket, &msg, 0);
+        if (sent != (ssize_t)(headerSize + payloadSize)) return -1;
 
         // Always track the message (unless it is an ACK)
         // Use Host Byte Order for ID check
         if (headerCopy.GetId() != dmq::ACK_REMOTE_ID && m_transportMonitor)
-            m_transportMonitor->Add(headerCopy.GetSeqNum(), headerCopy.GetId());
+            m_transportMonitor->Add(headerCopy.GetWireSeqNum(), headerCopy.GetId());
 
         return 0;
     }
 
+    virtual bool SupportsBufferSend() const override { return true; }
+
     virtual int Receive(xstringstream& is, DmqHeader& header) override
+    {
+        TransportBuffer payload;
+        int err = ReceiveView(payload, header);
+        if (err == 0)
+            is.write(static_cast<const char*>(payload.data), payload.size);
+        return err;
+    }
+
+    /// View the next datagram's payload inside the receive batch. Valid until the
+    /// next receive call, which may refill the batch.
+    virtual int ReceiveView(TransportBuffer& payload, DmqHeader& header) override
     {
         if (m_recvTransport != this) {
             std::cerr << "Receive operation not allowed (Send only)." << std::endl;
             return -1;
         }
 
-        sockaddr_in fromAddr;
-        socklen_t addrLen = sizeof(fromAddr);
-        ssize_t size = recvfrom(m_socket, m_buffer, sizeof(m_buffer), 0,
-            (struct sockaddr*)&fromAddr, &addrLen);
+        // One recvmmsg() fills the batch; later calls are served from memory
+        if (!m_recvBatch.HasPending() && m_recvBatch.Fill(m_socket) < 0)
+            return -1; // Timeout or socket closed
 
-        if (size < 0)
-        {
-            if (errno == EWOULDBLOCK || errno == EAGAIN)
-                return -1; // Timeout
-            // std::cerr << "recvfrom failed: " << strerror(errno) << std::endl;
-            return -1;
-        }
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        sockaddr_in fromAddr;
+        if (!m_recvBatch.Next(data, size, &fromAddr))
+            return -1; // Only truncated datagrams
 
         // Important: Update m_addr to the sender's address so we can ACK back
         // Note: For a true 1-to-N PUB/SUB, you might not want to overwrite m_addr permanently,
@@ -228,39 +301,20 @@ public:
             m_addr = fromAddr;
         }
 
-        xstringstream headerStream(std::ios::in | std::ios::out | std::ios::binary);
-        headerStream.write(m_buffer, size);
-        headerStream.seekg(0);
-
-        uint16_t val = 0;
-
-        // 1. Read Marker (Convert Network -> Host)
-        headerStream.read(reinterpret_cast<char*>(&val), sizeof(val));
-        header.SetMarker(ntohs(val));
-
-        if (header.GetMarker() != DmqHeader::MARKER)
+        // Convert Network -> Host
+        size_t headerSize = ReadHeader(data, size, header);
+        if (headerSize == 0)
         {
             std::cerr << "Invalid sync marker!" << std::endl;
             return -1;
         }
 
-        // 2. Read ID
-        headerStream.read(reinterpret_cast<char*>(&val), sizeof(val));
-        header.SetId(ntohs(val));
-
-        // 3. Read SeqNum
-        headerStream.read(reinterpret_cast<char*>(&val), sizeof(val));
-        header.SetSeqNum(ntohs(val));
-
-        // 4. Read Length
-        headerStream.read(reinterpret_cast<char*>(&val), sizeof(val));
-        header.SetLength(ntohs(val));
-
-        is.write(m_buffer + DmqHeader::HEADER_SIZE, size - DmqHeader::HEADER_SIZE);
+        payload.data = data + headerSize;
+        payload.size = size - headerSize;
 
         // Get Host Byte Order values for logic check
         uint16_t id = header.GetId();
-        uint16_t seqNum = header.GetSeqNum();
+        uint32_t seqNum = header.GetSeqNum32();
 
         if (id == dmq::ACK_REMOTE_ID)
         {
@@ -273,12 +327,17 @@ public:
             DmqHeader ack;
             ack.SetId(dmq::ACK_REMOTE_ID);
             ack.SetSeqNum(seqNum);
+            ack.SetExtended(header.IsExtended());  // Echo the full sequence number
             m_sendTransport->Send(ss_ack, ack);
         }
 
         return 0;
     }
 
+    virtual bool SupportsReceiveView() const override { return true; }
+
+    virtual bool HasPending() const override { return m_recvBatch.HasPending(); }
+
     void SetTransportMonitor(ITransportMonitor* transportMonitor)
     {
         m_transportMonitor = transportMonitor;
@@ -295,6 +354,23 @@ public:
     }
 
 private:
+    /// Copy a datagram into the send batch and send the batch once full.
+    int QueueBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count)
+    {
+        int result = 0;
+        {
+            dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+            if (m_sendBatch.Add(header, buffers, count, m_addr) < 0)
+                return -1;
+            if (m_sendBatch.Full())
+                result = m_sendBatch.Flush(m_socket);
+        }
+
+        if (m_transportMonitor)
+            m_transportMonitor->Add(header.GetWireSeqNum(), header.GetId());
+        return result;
+    }
+
     int m_socket = -1;
     sockaddr_in m_addr{};
     Type m_type = Type::PUB;
@@ -302,13 +378,28 @@ private:
     ITransport* m_sendTransport = nullptr;
     ITransport* m_recvTransport = nullptr;
     ITransportMonitor* m_transportMonitor = nullptr;
+    bool m_extendedHeader = false;
+    bool m_headerTimestamp = false;
+
+    /// Maximum payload buffers gathered by one sendmsg() call
+    static const size_t MAX_SEND_BUFFERS = 8;
+
+    /// Maximum datagrams received by one recvmmsg() call
+    static const size_t RECV_BATCH = 32;
+
+    /// Upper limit for SetSendBatch()
+    static const size_t MAX_SEND_BATCH = 64;
 
     /// @note UDP datagrams larger than the network MTU (typically 1500 bytes) will be 
     /// fragmented by the IP layer. If any fragment is lost, the entire message is 
     /// discarded. For maximum reliability, keep serialized messages under 1400 bytes.
     /// Messages exceeding BUFFER_SIZE will be truncated and discarded by the OS.
     static const int BUFFER_SIZE = 4096;
-    char m_buffer[BUFFER_SIZE] = { 0 };
+    UdpRecvBatch m_recvBatch;
+
+    dmq::Mutex m_sendLock;                          // Guards m_sendBatch
+    UdpSendBatch m_sendBatch;
+    std::atomic<size_t> m_sendBatchSize{ 1 };
 };
 
 using UdpTransport = LinuxUdpTransport;
@@ -4,7 +4,9 @@
 #include "delegate/DelegateOpt.h"
 #include "port/transport/ITransport.h"
 #include "port/transport/DmqHeader.h"
+#include "UdpBatch.h"
 
+#include <atomic>
 #include <iostream>
 #include <sstream>
 #include <cstring>
@@ -12,6 +14,7 @@
 #include <unistd.h>
 #include <arpa/inet.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <net/if.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -19,6 +22,9 @@
 namespace dmq::transport {
 
 /// @brief Linux Multicast UDP transport implementation for DelegateMQ.
+/// @details Receives up to `RECV_BATCH` datagrams per `recvmmsg()` call; `HasPending()`
+/// reports datagrams still buffered from the last call. `SetSendBatch()` queues sends
+/// for one `sendmmsg()` call.
 class MulticastTransport : public ITransport
 {
 public:
@@ -69,71 +75,140 @@ public:
             timeout.tv_sec = 1;
             timeout.tv_usec = 0;
             setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            m_recvBatch.Init(RECV_BATCH, BUFFER_SIZE);
         }
         return 0;
     }
 
     void Close() {
         if (m_socket != -1) {
+            Flush();
             close(m_socket);
             m_socket = -1;
         }
     }
 
+    /// @brief Set the number of datagrams queued before they are sent together.
+    /// @details The default of 1 sends every datagram immediately. With a larger batch,
+    /// call `Flush()` after a burst (e.g. once per publish cycle).
+    void SetSendBatch(size_t batch) {
+        dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        if (m_sendBatch.Size() > 0 && m_socket != -1)
+            m_sendBatch.Flush(m_socket);
+        batch = batch == 0 ? 1 : (batch > MAX_SEND_BATCH ? MAX_SEND_BATCH : batch);
+        m_sendBatch.Init(batch);
+        m_sendBatchSize.store(batch, std::memory_order_relaxed);
+    }
+
+    /// @brief Send extended headers (32-bit sequence number, optional send timestamp).
+    /// @details Subscribers always accept both header formats.
+    void SetExtendedHeader(bool enable, bool timestamp = false) {
+        m_extendedHeader = enable || timestamp;
+        m_headerTimestamp = timestamp;
+    }
+
+    /// @brief Send all queued datagrams.
+    /// @return 0 if success.
+    int Flush() {
+        dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        if (m_sendBatch.Size() == 0 || m_socket == -1)
+            return 0;
+        return m_sendBatch.Flush(m_socket);
+    }
+
     virtual int Send(xostringstream& os, const DmqHeader& header) override {
+        TransportBuffer payload = GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    virtual int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count) override {
         if (m_type != Type::PUB) return -1;
-        auto payload = os.str();
+        if (count > MAX_SEND_BUFFERS) return ITransport::SendBuffers(header, buffers, count);
+
         DmqHeader headerCopy = header;
-        headerCopy.SetLength(static_cast<uint16_t>(payload.length()));
-
-        xostringstream ss(std::ios::in | std::ios::out | std::ios::binary);
-        uint16_t marker = htons(headerCopy.GetMarker());
-        uint16_t id     = htons(headerCopy.GetId());
-        uint16_t seqNum = htons(headerCopy.GetSeqNum());
-        uint16_t length = htons(headerCopy.GetLength());
-
-        ss.write((const char*)&marker, 2);
-        ss.write((const char*)&id, 2);
-        ss.write((const char*)&seqNum, 2);
-        ss.write((const char*)&length, 2);
-        ss.write(payload.data(), payload.size());
-
-        auto data = ss.str();
-        sendto(m_socket, data.c_str(), data.size(), 0, (struct sockaddr*)&m_addr, sizeof(m_addr));
+        headerCopy.SetLength(static_cast<uint32_t>(GetBufferSize(buffers, count)));
+        if (m_extendedHeader)
+            headerCopy.SetExtended(true);
+        if (m_headerTimestamp)
+            headerCopy.SetTimestamp(DmqHeader::GetTimestampNow());
+
+        if (m_sendBatchSize.load(std::memory_order_relaxed) > 1) {
+            dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+            if (m_sendBatch.Add(headerCopy, buffers, count, m_addr) < 0)
+                return -1;
+            return m_sendBatch.Full() ? m_sendBatch.Flush(m_socket) : 0;
+        }
+
+        uint8_t headerBytes[DmqHeader::MAX_HEADER_SIZE];
+        size_t headerSize = WriteHeader(headerCopy, headerBytes);
+
+        struct iovec iov[MAX_SEND_BUFFERS + 1];
+        iov[0].iov_base = headerBytes;
+        iov[0].iov_len = headerSize;
+        for (size_t i = 0; i < count; i++) {
+            iov[i + 1].iov_base = const_cast<void*>(buffers[i].data);
+            iov[i + 1].iov_len = buffers[i].size;
+        }
+
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &m_addr;
+        msg.msg_namelen = sizeof(m_addr);
+        msg.msg_iov = iov;
+        msg.msg_iovlen = count + 1;
+        sendmsg(m_socket, &msg, 0);
         return 0;
     }
 
-    virtual int Receive(xstringstream& is, DmqHeader& header) override {
-        if (m_type != Type::SUB) return -1;
-        ssize_t size = recvfrom(m_socket, m_buffer, sizeof(m_buffer), 0, NULL, NULL);
+    virtual bool SupportsBufferSend() const override { return true; }
 
-        if (size <= (ssize_t)DmqHeader::HEADER_SIZE) return -1;
+    virtual int Receive(xstringstream& is, DmqHeader& header) override {
+        TransportBuffer payload;
+        int err = ReceiveView(payload, header);
+        if (err == 0)
+            is.write(static_cast<const char*>(payload.data), payload.size);
+        return err;
+    }
 
-        xstringstream headerStream(std::ios::in | std::ios::out | std::ios::binary);
-        headerStream.write(m_buffer, DmqHeader::HEADER_SIZE);
-        headerStream.seekg(0);
+    // View the next datagram's payload in the receive batch (valid until the next receive)
+    virtual int ReceiveView(TransportBuffer& payload, DmqHeader& header) override {
+        if (m_type != Type::SUB) return -1;
+        if (!m_recvBatch.HasPending() && m_recvBatch.Fill(m_socket) < 0) return -1;
 
-        uint16_t val = 0;
-        headerStream.read((char*)&val, 2); header.SetMarker(ntohs(val));
-        headerStream.read((char*)&val, 2); header.SetId(ntohs(val));
-        headerStream.read((char*)&val, 2); header.SetSeqNum(ntohs(val));
-        headerStream.read((char*)&val, 2); header.SetLength(ntohs(val));
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        if (!m_recvBatch.Next(data, size, nullptr)) return -1;
 
-        if (header.GetMarker() != DmqHeader::MARKER) {
+        size_t headerSize = ReadHeader(data, size, header);
+        if (headerSize == 0 || size == headerSize) {
             // std::cerr << "[Multicast] Bad Marker: " << std::hex << header.GetMarker() << std::dec << std::endl;
             return -1;
         }
 
-        is.write(m_buffer + DmqHeader::HEADER_SIZE, size - DmqHeader::HEADER_SIZE);
+        payload.data = data + headerSize;
+        payload.size = size - headerSize;
         return 0;
     }
 
+    virtual bool SupportsReceiveView() const override { return true; }
+
+    virtual bool HasPending() const override { return m_recvBatch.HasPending(); }
+
 private:
     int m_socket = -1;
     sockaddr_in m_addr{};
     Type m_type = Type::PUB;
+    bool m_extendedHeader = false;
+    bool m_headerTimestamp = false;
+    static const size_t MAX_SEND_BUFFERS = 8;
+    static const size_t RECV_BATCH = 32;
+    static const size_t MAX_SEND_BATCH = 64;
     static const int BUFFER_SIZE = 4096;
-    char m_buffer[BUFFER_SIZE] = { 0 };
+    UdpRecvBatch m_recvBatch;
+
+    dmq::Mutex m_sendLock;  // Guards m_sendBatch
+    UdpSendBatch m_sendBatch;
+    std::atomic<size_t> m_sendBatchSize{ 1 };
 };
 
 } // namespace dmq::transport
@@ -0,0 +1,192 @@
+#ifndef UDP_BATCH_H
+#define UDP_BATCH_H
+
+/// @file UdpBatch.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Datagram batching helpers for the Linux UDP and multicast transports.
+///
+/// @details
+/// `UdpRecvBatch` receives up to N datagrams with one `recvmmsg()` call into a
+/// reusable buffer array. The transport's `Receive()` then hands them out one at a
+/// time without further system calls. `UdpSendBatch` queues outgoing datagrams and
+/// sends them together with one `sendmmsg()` call.
+///
+/// Neither class is thread-safe; the owning transport serializes access.
+
+#include "port/transport/DmqHeader.h"
+#include "port/transport/TransportBuffer.h"
+
+#include <cstring>
+#include <vector>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <errno.h>
+
+namespace dmq::transport {
+
+/// @brief Reusable receive buffers filled by one `recvmmsg()` call.
+class UdpRecvBatch
+{
+public:
+    /// Allocate the buffer array.
+    /// @param[in] count Maximum datagrams received per system call.
+    /// @param[in] bufferSize Bytes per datagram buffer.
+    void Init(size_t count, size_t bufferSize)
+    {
+        m_bufferSize = bufferSize;
+        m_buffers.assign(count * bufferSize, 0);
+        m_from.assign(count, sockaddr_in{});
+        m_iovs.assign(count, iovec{});
+        m_msgs.assign(count, mmsghdr{});
+        for (size_t i = 0; i < count; i++) {
+            m_iovs[i].iov_base = m_buffers.data() + i * bufferSize;
+            m_iovs[i].iov_len = bufferSize;
+        }
+        m_count = m_index = 0;
+    }
+
+    /// @return `true` if a datagram from the last `Fill()` has not been consumed.
+    bool HasPending() const { return m_index < m_count; }
+
+    /// Receive the datagrams available on the socket. Blocks for the first one
+    /// (subject to `SO_RCVTIMEO`); the rest are collected without waiting.
+    /// @return Number of datagrams received, or -1 on error or timeout (`errno` set).
+    int Fill(int socket)
+    {
+        m_count = m_index = 0;
+        for (size_t i = 0; i < m_msgs.size(); i++) {
+            msghdr& hdr = m_msgs[i].msg_hdr;
+            memset(&hdr, 0, sizeof(hdr));
+            hdr.msg_name = &m_from[i];
+            hdr.msg_namelen = sizeof(sockaddr_in);
+            hdr.msg_iov = &m_iovs[i];
+            hdr.msg_iovlen = 1;
+            m_msgs[i].msg_len = 0;
+        }
+
+        int received;
+        do {
+            received = recvmmsg(socket, m_msgs.data(), static_cast<unsigned>(m_msgs.size()), MSG_WAITFORONE, nullptr);
+        } while (received < 0 && errno == EINTR);
+
+        if (received > 0)
+            m_count = static_cast<size_t>(received);
+        return received;
+    }
+
+    /// Take the next received datagram. Datagrams truncated by the kernel are skipped.
+    /// @param[out] data Datagram bytes, valid until the next `Fill()`.
+    /// @param[out] size Datagram size in bytes.
+    /// @param[out] from Sender address. May be `nullptr`.
+    /// @return `false` if no datagram is pending.
+    bool Next(const uint8_t*& data, size_t& size, sockaddr_in* from)
+    {
+        while (m_index < m_count) {
+            const size_t i = m_index++;
+            if (m_msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+                continue;
+            data = m_buffers.data() + i * m_bufferSize;
+            size = m_msgs[i].msg_len;
+            if (from)
+                *from = m_from[i];
+            return true;
+        }
+        return false;
+    }
+
+private:
+    size_t m_bufferSize = 0;
+    std::vector<uint8_t> m_buffers;
+    std::vector<sockaddr_in> m_from;
+    std::vector<iovec> m_iovs;
+    std::vector<mmsghdr> m_msgs;
+    size_t m_count = 0;     // Datagrams received by the last Fill()
+    size_t m_index = 0;     // Next datagram to hand out
+};
+
+/// @brief Outgoing datagrams queued for one `sendmmsg()` call.
+class UdpSendBatch
+{
+public:
+    /// @param[in] count Maximum datagrams queued before a flush is required.
+    void Init(size_t count)
+    {
+        m_data.resize(count);
+        m_addrs.assign(count, sockaddr_in{});
+        m_iovs.assign(count, iovec{});
+        m_msgs.assign(count, mmsghdr{});
+        m_size = 0;
+    }
+
+    size_t Size() const { return m_size; }
+    bool Full() const { return m_size >= m_msgs.size(); }
+
+    /// Copy a header and payload into the next datagram slot. The caller's buffers
+    /// may be reused once this returns.
+    /// @return 0 on success, -1 if the batch is full.
+    int Add(const DmqHeader& header, const TransportBuffer* buffers, size_t count, const sockaddr_in& addr)
+    {
+        if (Full())
+            return -1;
+
+        std::vector<uint8_t>& data = m_data[m_size];
+        data.resize(header.GetWireSize() + GetBufferSize(buffers, count));
+        size_t offset = WriteHeader(header, data.data());
+        for (size_t i = 0; i < count; i++) {
+            if (buffers[i].size > 0)
+                memcpy(data.data() + offset, buffers[i].data, buffers[i].size);
+            offset += buffers[i].size;
+        }
+        m_addrs[m_size] = addr;
+        m_size++;
+        return 0;
+    }
+
+    /// Send all queued datagrams. The batch is empty afterwards, even on error.
+    /// @return 0 if every datagram was sent, -1 otherwise.
+    int Flush(int socket)
+    {
+        for (size_t i = 0; i < m_size; i++) {
+            m_iovs[i].iov_base = m_data[i].data();
+            m_iovs[i].iov_len = m_data[i].size();
+            msghdr& hdr = m_msgs[i].msg_hdr;
+            memset(&hdr, 0, sizeof(hdr));
+            hdr.msg_name = &m_addrs[i];
+            hdr.msg_namelen = sizeof(sockaddr_in);
+            hdr.msg_iov = &m_iovs[i];
+            hdr.msg_iovlen = 1;
+        }
+
+        int result = 0;
+        size_t sent = 0;
+        while (sent < m_size) {
+            int ret = sendmmsg(socket, m_msgs.data() + sent, static_cast<unsigned>(m_size - sent), 0);
+            if (ret < 0) {
+                if (errno == EINTR)
+                    continue;
+                // Drop the failed datagram and carry on with the rest
+                result = -1;
+                sent++;
+                continue;
+            }
+            if (ret == 0)
+                break;
+            sent += static_cast<size_t>(ret);
+        }
+        m_size = 0;
+        return result;
+    }
+
+private:
+    std::vector<std::vector<uint8_t>> m_data;
+    std::vector<sockaddr_in> m_addrs;
+    std::vector<iovec> m_iovs;
+    std::vector<mmsghdr> m_msgs;
+    size_t m_size = 0;
+};
+
+} // namespace dmq::transport
+
+#endif // UDP_BATCH_H
@@ -0,0 +1,660 @@
+#ifndef LINUX_URING_TRANSPORT_H
+#define LINUX_URING_TRANSPORT_H
+
+/// @file LinuxUringTransport.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Linux io_uring UDP transport implementation for DelegateMQ.
+///
+/// @details
+/// Drop-in alternative to `LinuxUdpTransport` (same PUB/SUB modes, `DmqHeader` wire
+/// format and `TransportMonitor` integration) that performs socket I/O through io_uring
+/// instead of one `sendmsg()`/`recvfrom()` system call per datagram.
+///
+/// Key Features:
+/// 1. **Provided Receive Buffers**: A pool of receive buffers is provided to the kernel
+///    once. A single multishot `recvmsg` request keeps receiving into them; each datagram
+///    arrives as one completion, and the buffer is handed back to the kernel (batched with
+///    the next submission) after `Receive()` copies it out. `ReceiveView()` returns the
+///    payload in place and hands the buffer back on the next receive call.
+/// 2. **Batched Completions**: One wait collects every datagram that has arrived. The
+///    following `Receive()` calls consume the completion queue with no system call.
+/// 3. **Batched Sends**: `Send()` copies the datagram into a send slot and queues a
+///    `sendmsg` request. Requests are submitted together once `SetSendBatch()` requests
+///    are queued, or on `Flush()`. The default batch of 1 submits every send immediately.
+/// 4. **Reliability Support**: Integrates with `TransportMonitor` to track outgoing
+///    sequence numbers and process incoming ACKs, identical to `LinuxUdpTransport`.
+///
+/// Sends and receives use separate rings. Receive is called from one thread; Send is
+/// thread-safe. Datagrams submitted in one batch may be transmitted out of order, as
+/// UDP itself permits.
+///
+/// @note Requires Linux 6.0 or later (multishot `recvmsg`); `Uring` alone needs 5.11.
+/// Receive buffers are handed to the kernel with `IORING_OP_PROVIDE_BUFFERS`. `Create()`
+/// fails if io_uring is unavailable or restricted (e.g. by a container seccomp profile);
+/// use `LinuxUdpTransport` instead.
+
+#include "delegate/DelegateOpt.h"
+#include "port/transport/ITransport.h"
+#include "port/transport/DmqHeader.h"
+#include "port/transport/ITransportMonitor.h"
+#include "Uring.h"
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <vector>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <errno.h>
+
+namespace dmq::transport {
+
+/// @brief UDP transport using io_uring for batched socket I/O.
+class LinuxUringTransport : public ITransport
+{
+public:
+    enum class Type
+    {
+        PUB,
+        SUB
+    };
+
+    LinuxUringTransport() : m_sendTransport(this), m_recvTransport(this)
+    {
+    }
+
+    ~LinuxUringTransport()
+    {
+        Close();
+    }
+
+    int Create(Type type, const char* addr, uint16_t port)
+    {
+        m_type = type;
+
+        // Create UDP socket
+        m_socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (m_socket < 0)
+        {
+            std::cerr << "Socket creation failed: " << strerror(errno) << std::endl;
+            return -1;
+        }
+
+        memset(&m_addr, 0, sizeof(m_addr));
+        m_addr.sin_family = AF_INET;
+        m_addr.sin_port = htons(port);
+
+        if (type == Type::PUB)
+        {
+            if (inet_aton(addr, &m_addr.sin_addr) == 0)
+            {
+                std::cerr << "Invalid IP address format." << std::endl;
+                return -1;
+            }
+
+            // Short timeout so polling for ACKs doesn't hang
+            m_recvTimeout = std::chrono::milliseconds(2);
+        }
+        else if (type == Type::SUB)
+        {
+            m_addr.sin_addr.s_addr = INADDR_ANY;
+
+            if (bind(m_socket, (struct sockaddr*)&m_addr, sizeof(m_addr)) < 0)
+            {
+                std::cerr << "Bind failed: " << strerror(errno) << std::endl;
+                return -1;
+            }
+
+            m_recvTimeout = std::chrono::milliseconds(2000);
+        }
+
+        if (m_sendRing.Init(SEND_SLOTS) < 0 || m_recvRing.Init(RECV_SQ_ENTRIES, RECV_BUFFER_COUNT * 2) < 0)
+        {
+            std::cerr << "io_uring setup failed: " << strerror(errno) << std::endl;
+            Close();
+            return -1;
+        }
+
+        if (CreateRecvBuffers() < 0)
+        {
+            std::cerr << "io_uring provide buffers failed: " << strerror(errno) << std::endl;
+            Close();
+            return -1;
+        }
+
+        m_sendSlots.resize(SEND_SLOTS);
+        return 0;
+    }
+
+    /// @details Safe to call while another thread is blocked in `Receive()`.
+    void Close()
+    {
+        // SHUT_RDWR completes the pending multishot receive and wakes Receive()
+        if (m_socket != -1)
+            shutdown(m_socket, SHUT_RDWR);
+
+        {
+            // Waits for an in-progress Receive() to return
+            dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+            m_recvRing.Close();
+            m_recvArmed = false;
+            m_recvBuffers.clear();
+            m_viewBid = -1;
+        }
+
+        {
+            dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+            DrainSends();
+            m_sendRing.Close();
+            m_sendSlots.clear();
+            m_queued = 0;
+        }
+
+        if (m_socket != -1)
+        {
+            close(m_socket);
+            m_socket = -1;
+        }
+    }
+
+    void SetRecvTimeout(std::chrono::milliseconds timeout)
+    {
+        m_recvTimeout = timeout;
+    }
+
+    /// @brief Set the number of queued sends submitted together.
+    /// @details With a batch above 1, call `Flush()` after a burst of sends so the
+    /// remainder is not held until the next batch fills.
+    void SetSendBatch(size_t batch)
+    {
+        dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        m_sendBatch = batch == 0 ? 1 : (batch > SEND_SLOTS ? SEND_SLOTS : batch);
+    }
+
+    /// @brief Submit all queued sends.
+    void Flush()
+    {
+        dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+        if (m_queued > 0)
+            SubmitSends(0);
+    }
+
+    /// @return Number of sends that completed with an error since creation.
+    size_t GetSendErrors() const { return m_sendErrors; }
+
+    virtual int Send(xostringstream& os, const DmqHeader& header) override
+    {
+        if (os.bad() || os.fail()) {
+            std::cerr << "Stream state error." << std::endl;
+            return -1;
+        }
+
+        TransportBuffer payload = GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    /// Queue the header and payload buffers as one datagram.
+    virtual int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count) override
+    {
+        // Allow ACKs on SUB sockets. Block only regular data.
+        if (m_type == Type::SUB && header.GetId() != dmq::ACK_REMOTE_ID) {
+            std::cerr << "Send operation not allowed on SUB socket." << std::endl;
+            return -1;
+        }
+
+        if (m_sendTransport != this) {
+            std::cerr << "Send operation not allowed (Receive only)." << std::endl;
+            return -1;
+        }
+
+        // Create a local copy so we can modify the length
+        DmqHeader headerCopy = header;
+
+        size_t payloadSize = GetBufferSize(buffers, count);
+        if (payloadSize > UINT16_MAX) {
+            std::cerr << "Error: Payload too large." << std::endl;
+            return -1;
+        }
+        headerCopy.SetLength(static_cast<uint32_t>(payloadSize));
+        if (m_extendedHeader)
+            headerCopy.SetExtended(true);
+        if (m_headerTimestamp)
+            headerCopy.SetTimestamp(DmqHeader::GetTimestampNow());
+
+        {
+            dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+            if (!m_sendRing.IsOpen())
+                return -1;
+
+            int index = AcquireSlot();
+            if (index < 0)
+                return -1;
+            SendSlot& slot = m_sendSlots[index];
+
+            // Copy the datagram; the caller may reuse its buffers once Send() returns
+            slot.data.resize(headerCopy.GetWireSize() + payloadSize);
+            size_t offset = WriteHeader(headerCopy, slot.data.data());
+            for (size_t i = 0; i < count; i++) {
+                if (buffers[i].size > 0)
+                    memcpy(slot.data.data() + offset, buffers[i].data, buffers[i].size);
+                offset += buffers[i].size;
+            }
+
+            slot.addr = m_addr;
+            slot.iov.iov_base = slot.data.data();
+            slot.iov.iov_len = slot.data.size();
+            memset(&slot.msg, 0, sizeof(slot.msg));
+            slot.msg.msg_name = &slot.addr;
+            slot.msg.msg_namelen = sizeof(slot.addr);
+            slot.msg.msg_iov = &slot.iov;
+            slot.msg.msg_iovlen = 1;
+
+            io_uring_sqe* sqe = m_sendRing.GetSqe();
+            if (!sqe) {
+                slot.busy = false;
+                return -1;
+            }
+            sqe->opcode = IORING_OP_SENDMSG;
+            sqe->fd = m_socket;
+            sqe->addr = reinterpret_cast<uint64_t>(&slot.msg);
+            sqe->len = 1;
+            sqe->user_data = static_cast<uint64_t>(index);
+
+            if (++m_queued >= m_sendBatch)
+                SubmitSends(0);
+        }
+
+        // Always track the message (unless it is an ACK)
+        if (headerCopy.GetId() != dmq::ACK_REMOTE_ID && m_transportMonitor)
+            m_transportMonitor->Add(headerCopy.GetWireSeqNum(), headerCopy.GetId());
+
+        return 0;
+    }
+
+    virtual bool SupportsBufferSend() const override { return true; }
+
+    /// Send extended headers (32-bit sequence number, optional send timestamp).
+    /// Both header formats are always received.
+    void SetExtendedHeader(bool enable, bool timestamp = false)
+    {
+        m_extendedHeader = enable || timestamp;
+        m_headerTimestamp = timestamp;
+    }
+
+    virtual int Receive(xstringstream& is, DmqHeader& header) override
+    {
+        dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+        TransportBuffer payload;
+        int err = ReceiveLocked(payload, header);
+        if (err == 0)
+        {
+            is.write(static_cast<const char*>(payload.data), payload.size);
+            ReleaseView();
+        }
+        return err;
+    }
+
+    /// View the next datagram's payload in its provided buffer. The buffer is handed
+    /// back to the kernel on the next receive call.
+    virtual int ReceiveView(TransportBuffer& payload, DmqHeader& header) override
+    {
+        dmq::LockGuard<dmq::Mutex> lock(m_recvLock);
+        return ReceiveLocked(payload, header);
+    }
+
+    virtual bool SupportsReceiveView() const override { return true; }
+
+    void SetTransportMonitor(ITransportMonitor* transportMonitor)
+    {
+        m_transportMonitor = transportMonitor;
+    }
+
+    void SetSendTransport(ITransport* sendTransport)
+    {
+        m_sendTransport = sendTransport;
+    }
+
+    void SetRecvTransport(ITransport* recvTransport)
+    {
+        m_recvTransport = recvTransport;
+    }
+
+private:
+    /// A queued or in-flight datagram. Owned by the kernel while `busy`.
+    struct SendSlot
+    {
+        std::vector<uint8_t> data;
+        sockaddr_in addr{};
+        struct iovec iov{};
+        struct msghdr msg{};
+        bool busy = false;
+    };
+
+    /// Allocate the receive buffers and provide them to the kernel. Called from Create().
+    int CreateRecvBuffers()
+    {
+        m_recvBuffers.resize(static_cast<size_t>(RECV_BUFFER_COUNT) * RECV_BUFFER_SIZE);
+
+        io_uring_sqe* sqe = m_recvRing.GetSqe();
+        if (!sqe)
+            return -1;
+        PrepProvide(sqe, 0, RECV_BUFFER_COUNT);
+        if (m_recvRing.Submit(1, RECV_SETUP_MS) < 0)
+            return -1;
+
+        io_uring_cqe* cqe = m_recvRing.PeekCqe();
+        if (!cqe)
+            return -1;
+        const int res = cqe->res;
+        m_recvRing.SeenCqe();
+        if (res < 0) {
+            errno = -res;
+            return -1;
+        }
+        return 0;
+    }
+
+    /// Fill in a request that provides `count` consecutive buffers starting at `bid`.
+    void PrepProvide(io_uring_sqe* sqe, uint16_t bid, unsigned count)
+    {
+        sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+        sqe->fd = static_cast<int>(count);
+        sqe->addr = reinterpret_cast<uint64_t>(m_recvBuffers.data() + static_cast<size_t>(bid) * RECV_BUFFER_SIZE);
+        sqe->len = RECV_BUFFER_SIZE;
+        sqe->off = bid;
+        sqe->buf_group = RECV_BUFFER_GROUP;
+        sqe->user_data = PROVIDE_TAG;
+    }
+
+    /// Queue a consumed buffer to be handed back to the kernel. Submitted with the next
+    /// wait, or immediately if the submission queue is full.
+    void RecycleBuffer(uint16_t bid)
+    {
+        io_uring_sqe* sqe = m_recvRing.GetSqe();
+        if (!sqe) {
+            m_recvRing.Submit();
+            sqe = m_recvRing.GetSqe();
+            if (!sqe)
+                return;
+        }
+        PrepProvide(sqe, bid, 1);
+        sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+    }
+
+    /// Wait for a datagram and parse it in place. Called with m_recvLock held; the
+    /// buffer stays out of the pool until `ReleaseView()`.
+    int ReceiveLocked(TransportBuffer& payload, DmqHeader& header)
+    {
+        if (m_recvTransport != this) {
+            std::cerr << "Receive operation not allowed (Send only)." << std::endl;
+            return -1;
+        }
+        if (m_socket < 0 || !m_recvRing.IsOpen())
+            return -1;
+        ReleaseView();
+
+        int res = -ENOBUFS;
+        uint32_t flags = 0;
+        for (int attempt = 0; attempt < 2 && res == -ENOBUFS; attempt++)
+        {
+            // Armed on first use; re-armed if the kernel terminated the multishot
+            // request (e.g. all buffers were in use)
+            if (!m_recvArmed && ArmRecv() < 0)
+                return -1;
+
+            io_uring_cqe* cqe = PeekRecv();
+            if (!cqe)
+            {
+                // Also submits the buffers recycled since the last wait
+                m_recvRing.Submit(1, static_cast<int>(m_recvTimeout.count()));
+                cqe = PeekRecv();
+                if (!cqe)
+                    return -1; // Timeout
+            }
+
+            res = cqe->res;
+            flags = cqe->flags;
+            m_recvRing.SeenCqe();
+
+            if (!(flags & IORING_CQE_F_MORE))
+                m_recvArmed = false;
+        }
+        if (res < 0 || !(flags & IORING_CQE_F_BUFFER))
+            return -1;
+
+        const uint16_t bid = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+        int result = ParseDatagram(bid, static_cast<size_t>(res), payload, header);
+        if (result != 0)
+        {
+            RecycleBuffer(bid);
+            return result;
+        }
+        m_viewBid = bid;
+
+        // Get Host Byte Order values for logic check
+        uint16_t id = header.GetId();
+        uint32_t seqNum = header.GetSeqNum32();
+
+        if (id == dmq::ACK_REMOTE_ID)
+        {
+            if (m_transportMonitor)
+                m_transportMonitor->Remove(seqNum);
+        }
+        else if (m_transportMonitor && m_sendTransport)
+        {
+            xostringstream ss_ack;
+            DmqHeader ack;
+            ack.SetId(dmq::ACK_REMOTE_ID);
+            ack.SetSeqNum(seqNum);
+            ack.SetExtended(header.IsExtended());  // Echo the full sequence number
+            m_sendTransport->Send(ss_ack, ack);
+        }
+
+        return 0;
+    }
+
+    /// Hand back the buffer viewed by the last `ReceiveView()`. Called with m_recvLock held.
+    void ReleaseView()
+    {
+        if (m_viewBid >= 0)
+            RecycleBuffer(static_cast<uint16_t>(m_viewBid));
+        m_viewBid = -1;
+    }
+
+    /// @return The next receive completion, or `nullptr` if none. Buffer provide
+    /// failures (which post a completion) are skipped.
+    io_uring_cqe* PeekRecv()
+    {
+        while (io_uring_cqe* cqe = m_recvRing.PeekCqe()) {
+            if (cqe->user_data == RECV_TAG)
+                return cqe;
+            m_recvRing.SeenCqe();
+        }
+        return nullptr;
+    }
+
+    /// Submit a multishot recvmsg request that selects buffers from the provided
+    /// buffer group.
+    int ArmRecv()
+    {
+        memset(&m_recvMsg, 0, sizeof(m_recvMsg));
+        m_recvMsg.msg_namelen = sizeof(sockaddr_in);
+
+        // The queue may be full of recycled buffers; hand them to the kernel first
+        io_uring_sqe* sqe = m_recvRing.GetSqe();
+        if (!sqe) {
+            if (m_recvRing.Submit() < 0)
+                return -1;
+            sqe = m_recvRing.GetSqe();
+            if (!sqe)
+                return -1;
+        }
+        sqe->opcode = IORING_OP_RECVMSG;
+        sqe->fd = m_socket;
+        sqe->addr = reinterpret_cast<uint64_t>(&m_recvMsg);
+        sqe->len = 1;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = RECV_BUFFER_GROUP;
+        sqe->user_data = RECV_TAG;
+        if (m_recvRing.Submit() < 0)
+            return -1;
+        m_recvArmed = true;
+        return 0;
+    }
+
+    /// Decode a multishot recvmsg buffer: `io_uring_recvmsg_out`, source address, datagram.
+    int ParseDatagram(uint16_t bid, size_t size, TransportBuffer& view, DmqHeader& header)
+    {
+        const uint8_t* buf = m_recvBuffers.data() + static_cast<size_t>(bid) * RECV_BUFFER_SIZE;
+        if (size < sizeof(io_uring_recvmsg_out))
+            return -1;
+
+        io_uring_recvmsg_out out;
+        memcpy(&out, buf, sizeof(out));
+        if (out.flags & MSG_TRUNC)
+            return -1;
+
+        const uint8_t* name = buf + sizeof(io_uring_recvmsg_out);
+        const uint8_t* payload = name + m_recvMsg.msg_namelen + m_recvMsg.msg_controllen;
+        if (payload + out.payloadlen > buf + size || out.payloadlen < DmqHeader::HEADER_SIZE)
+            return -1;
+
+        // Important: Update m_addr to the sender's address so we can ACK back
+        if (m_type == Type::SUB && out.namelen >= sizeof(sockaddr_in)) {
+            dmq::LockGuard<dmq::Mutex> lock(m_sendLock);
+            memcpy(&m_addr, name, sizeof(sockaddr_in));
+        }
+
+        size_t headerSize = ReadHeader(payload, out.payloadlen, header);
+        if (headerSize == 0)
+        {
+            std::cerr << "Invalid sync marker!" << std::endl;
+            return -1;
+        }
+
+        view.data = payload + headerSize;
+        view.size = out.payloadlen - headerSize;
+        return 0;
+    }
+
+    /// Find a free send slot, reaping completions and waiting if all are in flight.
+    /// Called with m_sendLock held.
+    int AcquireSlot()
+    {
+        for (int attempt = 0; attempt < 2; attempt++) {
+            ReapSends();
+            for (size_t i = 0; i < SEND_SLOTS; i++) {
+                size_t index = (m_nextSlot + i) % SEND_SLOTS;
+                if (!m_sendSlots[index].busy) {
+                    m_sendSlots[index].busy = true;
+                    m_nextSlot = (index + 1) % SEND_SLOTS;
+                    return static_cast<int>(index);
+                }
+            }
+            // All slots in flight: submit any queued sends and wait for one to finish
+            m_sendRing.Submit(1, SEND_WAIT_MS);
+            m_queued = 0;
+        }
+        return -1;
+    }
+
+    /// Submit queued sends and release completed slots. Called with m_sendLock held.
+    void SubmitSends(unsigned waitNr)
+    {
+        m_sendRing.Submit(waitNr);
+        m_queued = 0;
+        ReapSends();
+    }
+
+    /// Submit queued sends and wait for all in-flight sends before the slots are
+    /// freed. Called with m_sendLock held.
+    void DrainSends()
+    {
+        if (!m_sendRing.IsOpen())
+            return;
+        if (m_queued > 0)
+            SubmitSends(0);
+        for (int attempt = 0; attempt < 10; attempt++) {
+            bool busy = false;
+            for (auto& slot : m_sendSlots)
+                busy = busy || slot.busy;
+            if (!busy)
+                return;
+            m_sendRing.Submit(1, SEND_WAIT_MS);
+            ReapSends();
+        }
+    }
+
+    void ReapSends()
+    {
+        while (io_uring_cqe* cqe = m_sendRing.PeekCqe()) {
+            if (cqe->user_data < m_sendSlots.size())
+                m_sendSlots[cqe->user_data].busy = false;
+            if (cqe->res < 0)
+                m_sendErrors++;
+            m_sendRing.SeenCqe();
+        }
+    }
+
+    int m_socket = -1;
+    sockaddr_in m_addr{};
+    Type m_type = Type::PUB;
+    std::chrono::milliseconds m_recvTimeout{ 2000 };
+
+    ITransport* m_sendTransport = nullptr;
+    ITransport* m_recvTransport = nullptr;
+    ITransportMonitor* m_transportMonitor = nullptr;
+    bool m_extendedHeader = false;
+    bool m_headerTimestamp = false;
+
+    // Send ring; all members guarded by m_sendLock
+    dmq::Mutex m_sendLock;
+    Uring m_sendRing;
+    std::vector<SendSlot> m_sendSlots;
+    size_t m_nextSlot = 0;
+    size_t m_queued = 0;
+    size_t m_sendBatch = 1;
+    std::atomic<size_t> m_sendErrors{ 0 };   // Read without m_sendLock
+
+    // Receive ring; used by the receive thread, guarded by m_recvLock against Close()
+    dmq::Mutex m_recvLock;
+    Uring m_recvRing;
+    std::vector<uint8_t> m_recvBuffers;
+    struct msghdr m_recvMsg{};
+    bool m_recvArmed = false;
+    int m_viewBid = -1;                     // Buffer held by the last ReceiveView()
+
+    /// Concurrent datagrams queued or in flight
+    static const size_t SEND_SLOTS = 64;
+
+    /// Maximum wait for a free send slot
+    static const int SEND_WAIT_MS = 100;
+
+    /// Receive ring submission entries: the multishot request and recycled buffers
+    static const unsigned RECV_SQ_ENTRIES = 64;
+
+    /// Provided receive buffers
+    static const unsigned RECV_BUFFER_COUNT = 256;
+
+    /// Bytes per receive buffer: recvmsg header, source address and a datagram of
+    /// up to 4096 bytes (as LinuxUdpTransport). Larger datagrams are discarded.
+    static const unsigned RECV_BUFFER_SIZE = sizeof(io_uring_recvmsg_out) + sizeof(sockaddr_in) + 4096;
+
+    static const uint16_t RECV_BUFFER_GROUP = 0;
+
+    /// Maximum wait for the initial buffer provide in Create()
+    static const int RECV_SETUP_MS = 1000;
+
+    /// Receive ring completion tags
+    static const uint64_t RECV_TAG = 1;
+    static const uint64_t PROVIDE_TAG = 2;
+};
+
+} // namespace dmq::transport
+
+#endif // LINUX_URING_TRANSPORT_H
@@ -0,0 +1,215 @@
+#ifndef URING_H
+#define URING_H
+
+/// @file Uring.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Minimal io_uring submission/completion ring used by `LinuxUringTransport`.
+///
+/// @details
+/// Wraps the raw `io_uring_setup()`/`io_uring_enter()` system calls and the shared
+/// ring memory, so the transport builds against the kernel UAPI header
+/// (`<linux/io_uring.h>`) alone without a liburing dependency. Requires Linux 5.11
+/// or later (extended wait arguments).
+///
+/// The class is not thread-safe. Each ring has a single owner, or the owner
+/// serializes access with a lock.
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+#include <cstdint>
+#include <cstring>
+
+namespace dmq::transport {
+
+/// @brief One io_uring instance: submission queue, completion queue and SQE array.
+class Uring
+{
+public:
+    Uring() = default;
+    ~Uring() { Close(); }
+
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+
+    /// Create the ring and map its shared memory.
+    /// @param[in] entries Submission queue entries.
+    /// @param[in] cqEntries Completion queue entries, or 0 for the kernel default
+    /// (twice `entries`).
+    /// @return 0 on success, -1 on failure (`errno` set).
+    int Init(unsigned entries, unsigned cqEntries = 0)
+    {
+        io_uring_params p;
+        memset(&p, 0, sizeof(p));
+        p.flags = IORING_SETUP_CLAMP;
+        if (cqEntries > 0) {
+            p.flags |= IORING_SETUP_CQSIZE;
+            p.cq_entries = cqEntries;
+        }
+
+        m_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &p));
+        if (m_fd < 0)
+            return -1;
+
+        // Timed waits need IORING_ENTER_EXT_ARG
+        if (!(p.features & IORING_FEAT_EXT_ARG)) {
+            Close();
+            errno = ENOSYS;
+            return -1;
+        }
+
+        m_sqRingSize = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        m_cqRingSize = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        const bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) {
+            if (m_cqRingSize > m_sqRingSize)
+                m_sqRingSize = m_cqRingSize;
+            m_cqRingSize = m_sqRingSize;
+        }
+
+        m_sqRing = Map(m_sqRingSize, IORING_OFF_SQ_RING);
+        m_cqRing = single ? m_sqRing : Map(m_cqRingSize, IORING_OFF_CQ_RING);
+        m_sqesSize = p.sq_entries * sizeof(io_uring_sqe);
+        m_sqes = static_cast<io_uring_sqe*>(Map(m_sqesSize, IORING_OFF_SQES));
+        if (!m_sqRing || !m_cqRing || !m_sqes) {
+            Close();
+            return -1;
+        }
+
+        auto* sq = static_cast<uint8_t*>(m_sqRing);
+        m_sqHead = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+        m_sqTail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        m_sqMask = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        m_sqEntries = p.sq_entries;
+
+        // Identity mapping: SQE index == ring slot
+        unsigned* array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        for (unsigned i = 0; i < p.sq_entries; i++)
+            array[i] = i;
+        m_sqeTail = *m_sqTail;
+
+        auto* cq = static_cast<uint8_t*>(m_cqRing);
+        m_cqHead = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        m_cqTail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        m_cqMask = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+        return 0;
+    }
+
+    /// Unmap the ring memory and close the ring. In-flight requests are cancelled.
+    void Close()
+    {
+        if (m_sqes)
+            munmap(m_sqes, m_sqesSize);
+        if (m_cqRing && m_cqRing != m_sqRing)
+            munmap(m_cqRing, m_cqRingSize);
+        if (m_sqRing)
+            munmap(m_sqRing, m_sqRingSize);
+        if (m_fd >= 0)
+            close(m_fd);
+        m_sqes = nullptr;
+        m_sqRing = m_cqRing = nullptr;
+        m_fd = -1;
+    }
+
+    bool IsOpen() const { return m_fd >= 0; }
+
+    /// @return A zeroed SQE to fill in, or `nullptr` if the submission queue is full.
+    /// The entry is handed to the kernel on the next `Submit()`.
+    io_uring_sqe* GetSqe()
+    {
+        const unsigned head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        if (m_sqeTail - head >= m_sqEntries)
+            return nullptr;
+        io_uring_sqe* sqe = &m_sqes[m_sqeTail & m_sqMask];
+        m_sqeTail++;
+        memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    /// Submit all queued SQEs and optionally wait for completions, in one system call.
+    /// @param[in] waitNr Completions to wait for. 0 returns immediately.
+    /// @param[in] timeoutMs Wait timeout in milliseconds, or -1 to wait indefinitely.
+    /// @return Number of SQEs submitted, or -1 on error or timeout (`errno` set).
+    int Submit(unsigned waitNr = 0, int timeoutMs = -1)
+    {
+        __atomic_store_n(m_sqTail, m_sqeTail, __ATOMIC_RELEASE);
+        const unsigned toSubmit = m_sqeTail - __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        if (toSubmit == 0 && waitNr == 0)
+            return 0;
+
+        unsigned flags = 0;
+        __kernel_timespec ts;
+        io_uring_getevents_arg arg;
+        memset(&arg, 0, sizeof(arg));
+        if (waitNr > 0) {
+            flags |= IORING_ENTER_GETEVENTS;
+            if (timeoutMs >= 0) {
+                ts.tv_sec = timeoutMs / 1000;
+                ts.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000000;
+                arg.ts = reinterpret_cast<uint64_t>(&ts);
+                flags |= IORING_ENTER_EXT_ARG;
+            }
+        }
+
+        for (;;) {
+            int ret = (flags & IORING_ENTER_EXT_ARG) ?
+                static_cast<int>(syscall(__NR_io_uring_enter, m_fd, toSubmit, waitNr, flags, &arg, sizeof(arg))) :
+                static_cast<int>(syscall(__NR_io_uring_enter, m_fd, toSubmit, waitNr, flags, nullptr, 0));
+            if (ret < 0 && errno == EINTR)
+                continue;
+            return ret;
+        }
+    }
+
+    /// @return The oldest unconsumed completion, or `nullptr` if none. Call
+    /// `SeenCqe()` once the entry has been read.
+    io_uring_cqe* PeekCqe()
+    {
+        const unsigned head = *m_cqHead;
+        if (head == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE))
+            return nullptr;
+        return &m_cqes[head & m_cqMask];
+    }
+
+    /// Release the completion returned by `PeekCqe()`.
+    void SeenCqe()
+    {
+        __atomic_store_n(m_cqHead, *m_cqHead + 1, __ATOMIC_RELEASE);
+    }
+
+private:
+    void* Map(size_t size, off_t offset)
+    {
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, offset);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+
+    int m_fd = -1;
+
+    void* m_sqRing = nullptr;
+    void* m_cqRing = nullptr;
+    io_uring_sqe* m_sqes = nullptr;
+    size_t m_sqRingSize = 0;
+    size_t m_cqRingSize = 0;
+    size_t m_sqesSize = 0;
+
+    unsigned* m_sqHead = nullptr;
+    unsigned* m_sqTail = nullptr;
+    unsigned m_sqMask = 0;
+    unsigned m_sqEntries = 0;
+    unsigned m_sqeTail = 0;         // Local tail; published on Submit()
+
+    unsigned* m_cqHead = nullptr;
+    unsigned* m_cqTail = nullptr;
+    unsigned m_cqMask = 0;
+    io_uring_cqe* m_cqes = nullptr;
+};
+
+} // namespace dmq::transport
+
+#endif // URING_H
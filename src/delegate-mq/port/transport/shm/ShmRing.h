@@ -0,0 +1,400 @@
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+/// @file ShmRing.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Multi-producer, single-consumer byte ring in POSIX shared memory.
+///
+/// @details
+/// The segment holds a control block followed by a power-of-two data area. Each
+/// record is a 4-byte length prefix plus the record bytes, padded to 8 bytes and
+/// always contiguous: a record that would straddle the end of the data area is
+/// preceded by a wrap marker and written at the start instead. A record therefore
+/// can be filled in place (see `BeginWrite()`/`EndWrite()`).
+///
+/// `head` and `tail` are free-running 64-bit byte positions. Producers serialize
+/// through a futex mutex in the control block; the consumer owns `tail`. Blocked
+/// readers and writers sleep on futex words that the other side bumps, and the
+/// `FUTEX_WAKE` system call is made only when a sleeper has announced itself, so
+/// an uncontended send or receive performs no system call.
+///
+/// Any process may create the segment; the first to map it initializes the
+/// control block. The segment outlives the processes until `Unlink()`.
+///
+/// @note A producer that dies while holding the write lock blocks the other
+/// producers until the segment is unlinked and recreated.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace dmq::transport {
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared futex words must be lock free");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared ring positions must be lock free");
+
+/// Wait while `*word == expected`, up to `timeout`. Spurious returns are possible.
+inline void FutexWait(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::nanoseconds timeout)
+{
+    if (timeout <= std::chrono::nanoseconds(0))
+        return;
+    struct timespec ts;
+    ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+    ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+    // Not FUTEX_PRIVATE: the word is shared between processes
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+}
+
+/// Wake up to `count` waiters on `word`.
+inline void FutexWake(std::atomic<uint32_t>& word, int count)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, count, nullptr, nullptr, 0);
+}
+
+class ShmRing
+{
+public:
+    /// Segment layout version; bump when `Control` changes.
+    static const uint32_t VERSION = 1;
+
+    /// Bytes in front of every record.
+    static const size_t RECORD_PREFIX = 4;
+
+    ShmRing() = default;
+    ~ShmRing() { Close(); }
+
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    /// Create or open the named segment and map it.
+    /// @param[in] name The segment name. A leading '/' is added if missing.
+    /// @param[in] capacity The data area size. Must be a power of two; every process
+    /// opening the segment must pass the same value.
+    /// @return 0 if success.
+    int Open(const char* name, size_t capacity)
+    {
+        if (capacity < 64 || (capacity & (capacity - 1)) != 0 || capacity > 0x80000000u)
+        {
+            std::cerr << "ShmRing capacity must be a power of two." << std::endl;
+            return -1;
+        }
+
+        Close();
+        const std::string path = MakePath(name);
+        m_fd = shm_open(path.c_str(), O_CREAT | O_RDWR, 0600);
+        if (m_fd < 0)
+        {
+            std::cerr << "shm_open failed: " << strerror(errno) << std::endl;
+            return -1;
+        }
+
+        // Sizing is idempotent: every opener sets the same size
+        const size_t size = sizeof(Control) + capacity;
+        struct stat st;
+        if (fstat(m_fd, &st) < 0 || (st.st_size != 0 && static_cast<size_t>(st.st_size) != size))
+        {
+            std::cerr << "Shared memory segment size mismatch." << std::endl;
+            Close();
+            return -1;
+        }
+        if (st.st_size == 0 && ftruncate(m_fd, static_cast<off_t>(size)) < 0)
+        {
+            std::cerr << "ftruncate failed: " << strerror(errno) << std::endl;
+            Close();
+            return -1;
+        }
+
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (base == MAP_FAILED)
+        {
+            std::cerr << "mmap failed: " << strerror(errno) << std::endl;
+            Close();
+            return -1;
+        }
+        m_size = size;
+        m_ctrl = static_cast<Control*>(base);
+        m_data = static_cast<uint8_t*>(base) + sizeof(Control);
+        m_mask = capacity - 1;
+        m_cancel.store(false);
+
+        // A new segment is zero filled; the first opener initializes it
+        uint32_t state = STATE_NEW;
+        if (m_ctrl->state.compare_exchange_strong(state, STATE_INIT))
+        {
+            m_ctrl->capacity = static_cast<uint32_t>(capacity);
+            m_ctrl->version = VERSION;
+            m_ctrl->state.store(STATE_READY, std::memory_order_release);
+        }
+        else
+        {
+            for (int i = 0; i < 1000 && m_ctrl->state.load(std::memory_order_acquire) != STATE_READY; i++)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (m_ctrl->state.load(std::memory_order_acquire) != STATE_READY ||
+            m_ctrl->version != VERSION || m_ctrl->capacity != capacity)
+        {
+            std::cerr << "Shared memory segment incompatible." << std::endl;
+            Close();
+            return -1;
+        }
+        return 0;
+    }
+
+    /// Unmap the segment. The caller ensures no thread is inside a ring call.
+    void Close()
+    {
+        if (m_ctrl)
+            munmap(m_ctrl, m_size);
+        if (m_fd >= 0)
+            close(m_fd);
+        m_ctrl = nullptr;
+        m_data = nullptr;
+        m_reading = false;
+        m_fd = -1;
+        m_size = 0;
+    }
+
+    /// Remove the named segment. Processes that mapped it keep their mapping.
+    static void Unlink(const char* name) { shm_unlink(MakePath(name).c_str()); }
+
+    /// Make blocked and future waits of this process return immediately.
+    void Cancel()
+    {
+        m_cancel.store(true);
+        if (m_ctrl)
+        {
+            FutexWake(m_ctrl->dataSeq, INT32_MAX);
+            FutexWake(m_ctrl->spaceSeq, INT32_MAX);
+            FutexWake(m_ctrl->writeLock, INT32_MAX);
+        }
+    }
+
+    bool IsOpen() const { return m_ctrl != nullptr; }
+
+    /// @return The largest record accepted by `BeginWrite()`.
+    size_t GetMaxRecordSize() const { return m_ctrl ? (m_mask + 1) / 2 - RECORD_PREFIX : 0; }
+
+    /// Lock the ring for writing and reserve a contiguous record.
+    /// @param[in] size The most bytes the record will hold.
+    /// @param[in] timeout Longest wait for the lock and for free space.
+    /// @return Pointer to the record bytes, or `nullptr` on timeout, cancel or a
+    /// record larger than `GetMaxRecordSize()`. On success, call `EndWrite()` or
+    /// `AbortWrite()` from the same thread.
+    uint8_t* BeginWrite(size_t size, std::chrono::milliseconds timeout)
+    {
+        if (!m_ctrl || size > GetMaxRecordSize())
+            return nullptr;
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        if (!Lock(deadline))
+            return nullptr;
+
+        const size_t capacity = m_mask + 1;
+        const size_t record = Align(RECORD_PREFIX + size);
+        uint64_t pos = m_ctrl->head.load(std::memory_order_relaxed);
+        const size_t contiguous = capacity - static_cast<size_t>(pos & m_mask);
+        const size_t needed = record > contiguous ? contiguous + record : record;
+
+        // Wait for the consumer to free enough space
+        while (capacity - static_cast<size_t>(pos - m_ctrl->tail.load(std::memory_order_acquire)) < needed)
+        {
+            m_ctrl->writerWaiting.store(1);
+            const uint32_t seq = m_ctrl->spaceSeq.load();
+            if (capacity - static_cast<size_t>(pos - m_ctrl->tail.load()) >= needed)
+                break;
+            if (m_cancel.load() || std::chrono::steady_clock::now() >= deadline)
+            {
+                m_ctrl->writerWaiting.store(0);
+                Unlock();
+                return nullptr;
+            }
+            FutexWait(m_ctrl->spaceSeq, seq, deadline - std::chrono::steady_clock::now());
+        }
+        m_ctrl->writerWaiting.store(0);
+
+        if (record > contiguous)
+        {
+            // Skip the tail end; the marker is published together with the record
+            WritePrefix(pos, WRAP_MARKER);
+            pos += contiguous;
+        }
+        m_writePos = pos;
+        return m_data + (pos & m_mask) + RECORD_PREFIX;
+    }
+
+    /// Publish the record reserved by `BeginWrite()` and unlock the ring.
+    /// @param[in] size The bytes written; at most the reserved size.
+    void EndWrite(size_t size)
+    {
+        WritePrefix(m_writePos, static_cast<uint32_t>(size));
+        m_ctrl->head.store(m_writePos + Align(RECORD_PREFIX + size));
+        m_ctrl->dataSeq.fetch_add(1);
+        if (m_ctrl->readerWaiting.load())
+            FutexWake(m_ctrl->dataSeq, 1);
+        Unlock();
+    }
+
+    /// Discard the record reserved by `BeginWrite()` and unlock the ring.
+    void AbortWrite() { Unlock(); }
+
+    /// Wait for the next record. Single consumer only.
+    /// @param[out] data Pointer to the record bytes, valid until `EndRead()`.
+    /// @param[out] size The record size.
+    /// @param[in] timeout Longest wait for a record.
+    /// @return `true` if a record is available.
+    bool BeginRead(const uint8_t*& data, size_t& size, std::chrono::milliseconds timeout)
+    {
+        if (!m_ctrl)
+            return false;
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        uint64_t pos = m_ctrl->tail.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (m_ctrl->head.load(std::memory_order_acquire) == pos)
+            {
+                m_ctrl->readerWaiting.store(1);
+                const uint32_t seq = m_ctrl->dataSeq.load();
+                if (m_ctrl->head.load() != pos)
+                    continue;
+                if (m_cancel.load() || std::chrono::steady_clock::now() >= deadline)
+                {
+                    m_ctrl->readerWaiting.store(0);
+                    return false;
+                }
+                FutexWait(m_ctrl->dataSeq, seq, deadline - std::chrono::steady_clock::now());
+                continue;
+            }
+            m_ctrl->readerWaiting.store(0);
+
+            uint32_t length;
+            std::memcpy(&length, m_data + (pos & m_mask), sizeof(length));
+            if (length == WRAP_MARKER)
+            {
+                pos += (m_mask + 1) - static_cast<size_t>(pos & m_mask);
+                continue;
+            }
+
+            m_readNext = pos + Align(RECORD_PREFIX + length);
+            m_reading = true;
+            data = m_data + (pos & m_mask) + RECORD_PREFIX;
+            size = length;
+            return true;
+        }
+    }
+
+    /// Release the record returned by `BeginRead()`.
+    void EndRead()
+    {
+        m_reading = false;
+        m_ctrl->tail.store(m_readNext);
+        m_ctrl->spaceSeq.fetch_add(1);
+        if (m_ctrl->writerWaiting.load())
+            FutexWake(m_ctrl->spaceSeq, INT32_MAX);
+    }
+
+    /// @return `true` if a record after the one being read is waiting. Consumer only.
+    bool HasData() const
+    {
+        if (!m_ctrl)
+            return false;
+        const uint64_t pos = m_reading ? m_readNext : m_ctrl->tail.load(std::memory_order_relaxed);
+        return m_ctrl->head.load(std::memory_order_acquire) != pos;
+    }
+
+    /// @return `true` between `BeginRead()` and `EndRead()`.
+    bool IsReading() const { return m_reading; }
+
+private:
+    static const uint32_t STATE_NEW = 0;
+    static const uint32_t STATE_INIT = 1;
+    static const uint32_t STATE_READY = 2;
+    static const uint32_t WRAP_MARKER = 0xFFFFFFFF;
+
+    /// Control block at the start of the segment. Producer and consumer fields
+    /// are on separate cache lines.
+    struct Control
+    {
+        std::atomic<uint32_t> state;
+        uint32_t version;
+        uint32_t capacity;
+        alignas(64) std::atomic<uint32_t> writeLock;    // 0 free, 1 locked, 2 contended
+        alignas(64) std::atomic<uint64_t> head;         // Published write position
+        std::atomic<uint32_t> dataSeq;                  // Bumped per record; reader futex
+        std::atomic<uint32_t> readerWaiting;
+        alignas(64) std::atomic<uint64_t> tail;         // Read position
+        std::atomic<uint32_t> spaceSeq;                 // Bumped per release; writer futex
+        std::atomic<uint32_t> writerWaiting;
+    };
+
+    static std::string MakePath(const char* name)
+    {
+        std::string path = name ? name : "";
+        if (path.empty() || path[0] != '/')
+            path.insert(0, 1, '/');
+        return path;
+    }
+
+    static size_t Align(size_t size) { return (size + 7) & ~static_cast<size_t>(7); }
+
+    void WritePrefix(uint64_t pos, uint32_t value)
+    {
+        std::memcpy(m_data + (pos & m_mask), &value, sizeof(value));
+    }
+
+    // Futex mutex: 0 free, 1 locked, 2 locked with waiters
+    bool Lock(std::chrono::steady_clock::time_point deadline)
+    {
+        uint32_t c = 0;
+        if (m_ctrl->writeLock.compare_exchange_strong(c, 1))
+            return true;
+        if (c != 2)
+            c = m_ctrl->writeLock.exchange(2);
+        while (c != 0)
+        {
+            if (m_cancel.load() || std::chrono::steady_clock::now() >= deadline)
+                return false;
+            FutexWait(m_ctrl->writeLock, 2, deadline - std::chrono::steady_clock::now());
+            c = m_ctrl->writeLock.exchange(2);
+        }
+        return true;
+    }
+
+    void Unlock()
+    {
+        if (m_ctrl->writeLock.fetch_sub(1) != 1)
+        {
+            m_ctrl->writeLock.store(0);
+            FutexWake(m_ctrl->writeLock, 1);
+        }
+    }
+
+    Control* m_ctrl = nullptr;
+    uint8_t* m_data = nullptr;
+    size_t m_mask = 0;
+    size_t m_size = 0;
+    int m_fd = -1;
+    uint64_t m_writePos = 0;            // Valid while the write lock is held
+    uint64_t m_readNext = 0;            // Valid between BeginRead() and EndRead()
+    bool m_reading = false;
+    std::atomic<bool> m_cancel{ false };
+};
+
+} // namespace dmq::transport
+
+#endif // SHM_RING_H
@@ -0,0 +1,463 @@
+#ifndef SHM_TRANSPORT_H
+#define SHM_TRANSPORT_H
+
+/// @file ShmTransport.h
+/// @see https://github.com/DelegateMQ/DelegateMQ
+/// David Lafreniere, 2025.
+///
+/// @brief Shared-memory transport for delegates between processes on one host.
+///
+/// @details
+/// This class implements the ITransport interface over a POSIX shared-memory ring
+/// (see `ShmRing.h`). Each ring carries one direction: any number of senders, one
+/// receiver. Every record is a standard wire header (`WriteHeader()`) followed by
+/// the payload, so the framing is the same as on the socket transports.
+///
+/// Key Features:
+/// 1. **No Kernel Copies**: A send copies the header and payload buffers once, into
+///    the ring; a receive copies them once, out of the ring. An uncontended send or
+///    receive makes no system call. Blocked peers sleep on a futex.
+/// 2. **Topologies**: `Type::PUB` writes a ring, `Type::SUB` reads one and
+///    `Type::PAIR` does both on two rings, so one instance serves a `Participant`.
+/// 3. **Zero-Copy**: `Reserve()`/`Commit()` expose the ring slot itself, and
+///    `SendInPlace()` runs a serializer directly into it. `ReceiveView()` returns the
+///    payload where it lies in the ring.
+/// 4. **Reliability Support**: Integrates with `TransportMonitor` like the socket
+///    transports. The ring never drops a message; a sender waits for space up to the
+///    send timeout instead.
+///
+/// **Usage:**
+/// @code
+///   // Process A                              // Process B
+///   ShmTransport t;                           ShmTransport t;
+///   t.Create("dmq_a_to_b", "dmq_b_to_a");     t.Create("dmq_b_to_a", "dmq_a_to_b");
+///   Participant participant(t);               Participant participant(t);
+/// @endcode
+///
+/// @note Linux only (futex). Segments persist until `Unlink()`; remove stale
+/// segments at system startup when a clean ring is required.
+
+#include "delegate/DelegateOpt.h"
+#include "delegate/ISerializer.h"
+#include "port/transport/ITransport.h"
+#include "port/transport/DmqHeader.h"
+#include "port/transport/ITransportMonitor.h"
+#include "ShmRing.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+
+namespace dmq::transport {
+
+/// @brief Output stream buffer over a fixed slot. Writing past the end fails the
+/// stream instead of reallocating.
+class ShmSlotStreamBuf : public std::streambuf
+{
+public:
+    ShmSlotStreamBuf(uint8_t* data, size_t size)
+    {
+        char* base = reinterpret_cast<char*>(data);
+        setp(base, base + size);
+    }
+
+    /// @return The bytes written, including any written before a backward seek.
+    size_t Size() const
+    {
+        size_t pos = static_cast<size_t>(pptr() - pbase());
+        return pos > m_high ? pos : m_high;
+    }
+
+protected:
+    int_type overflow(int_type) override { return traits_type::eof(); }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        if (!(which & std::ios_base::out))
+            return pos_type(off_type(-1));
+        off_type base = dir == std::ios_base::beg ? 0 :
+            dir == std::ios_base::cur ? static_cast<off_type>(pptr() - pbase()) : static_cast<off_type>(Size());
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        const off_type target = static_cast<off_type>(pos);
+        if (!(which & std::ios_base::out) || target < 0 || target > epptr() - pbase())
+            return pos_type(off_type(-1));
+        m_high = Size();
+        char* base = pbase();
+        char* end = epptr();
+        setp(base, end);
+        pbump(static_cast<int>(target));
+        return pos;
+    }
+
+private:
+    size_t m_high = 0;
+};
+
+class ShmTransport : public ITransport
+{
+public:
+    enum class Type
+    {
+        PUB,
+        SUB,
+        PAIR
+    };
+
+    /// Default ring data area size in bytes.
+    static const size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+    ShmTransport() : m_sendTransport(this), m_recvTransport(this)
+    {
+    }
+
+    ~ShmTransport()
+    {
+        Close();
+    }
+
+    /// Open one ring.
+    /// @param[in] type `Type::PUB` to send on the ring or `Type::SUB` to receive.
+    /// @param[in] name The shared-memory segment name, e.g. "dmq_sensor".
+    /// @param[in] capacity The ring size; a power of two, equal on both sides.
+    /// @return 0 if success.
+    int Create(Type type, const char* name, size_t capacity = DEFAULT_CAPACITY)
+    {
+        if (type == Type::PAIR)
+        {
+            std::cerr << "PAIR requires a send and a receive segment." << std::endl;
+            return -1;
+        }
+        Close();
+        m_closed.store(false);
+        return (type == Type::PUB ? m_tx : m_rx).Open(name, capacity);
+    }
+
+    /// Open a full-duplex pair of rings. The peer swaps the two names.
+    /// @param[in] sendName The segment this side writes.
+    /// @param[in] recvName The segment this side reads.
+    /// @param[in] capacity The ring size for both segments.
+    /// @return 0 if success.
+    int Create(const char* sendName, const char* recvName, size_t capacity = DEFAULT_CAPACITY)
+    {
+        Close();
+        m_closed.store(false);
+        if (m_tx.Open(sendName, capacity) != 0 || m_rx.Open(recvName, capacity) != 0)
+        {
+            Close();
+            return -1;
+        }
+        return 0;
+    }
+
+    /// Unmap the rings. Blocked `Send()`/`Receive()` calls on other threads
+    /// return -1 first.
+    void Close()
+    {
+        m_closed.store(true);
+        m_tx.Cancel();
+        m_rx.Cancel();
+        while (m_users.load() > 0)
+            std::this_thread::yield();
+        if (m_rx.IsReading())
+            m_rx.EndRead();
+        m_tx.Close();
+        m_rx.Close();
+    }
+
+    /// Remove a segment name. Mapped rings keep working.
+    static void Unlink(const char* name) { ShmRing::Unlink(name); }
+
+    void SetRecvTimeout(std::chrono::milliseconds timeout) { m_recvTimeout = timeout; }
+
+    /// Set the longest wait for ring space before a send fails.
+    void SetSendTimeout(std::chrono::milliseconds timeout) { m_sendTimeout = timeout; }
+
+    /// @brief Send extended headers (32-bit sequence number, optional send timestamp).
+    /// @details Both header formats are always received. Enable only when all
+    /// peers understand the extended format. With a TransportMonitor, enable it on
+    /// both ends so ACKs carry the full sequence number.
+    void SetExtendedHeader(bool enable, bool timestamp = false)
+    {
+        m_extendedHeader = enable || timestamp;
+        m_headerTimestamp = timestamp;
+    }
+
+    /// @return The largest payload a single message can carry.
+    size_t GetMaxPayloadSize() const
+    {
+        const size_t ring = m_tx.GetMaxRecordSize();
+        const size_t header = GetHeaderSize();
+        const size_t max = ring > header ? ring - header : 0;
+        return m_extendedHeader || max < UINT16_MAX ? max : UINT16_MAX;
+    }
+
+    virtual int Send(xostringstream& os, const DmqHeader& header) override
+    {
+        if (os.bad() || os.fail()) {
+            std::cerr << "Stream state error." << std::endl;
+            return -1;
+        }
+
+        TransportBuffer payload = GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    /// Copy the header and payload buffers into one ring record.
+    virtual int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count) override
+    {
+        if (m_sendTransport != this) {
+            std::cerr << "Send operation not allowed (Receive only)." << std::endl;
+            return -1;
+        }
+
+        const size_t payloadSize = GetBufferSize(buffers, count);
+        uint8_t* slot = Reserve(payloadSize);
+        if (!slot)
+            return -1;
+
+        for (size_t i = 0; i < count; i++) {
+            if (buffers[i].size == 0)
+                continue;
+            std::memcpy(slot, buffers[i].data, buffers[i].size);
+            slot += buffers[i].size;
+        }
+        return Commit(header, payloadSize);
+    }
+
+    virtual bool SupportsBufferSend() const override { return true; }
+
+    /// @brief Reserve a ring slot for a payload written in place.
+    /// @details Locks the ring against other senders until `Commit()` or `Cancel()`,
+    /// which must be called from the same thread.
+    /// @param[in] maxSize The most payload bytes that will be written.
+    /// @return Pointer to the payload area, or `nullptr` on error or send timeout.
+    uint8_t* Reserve(size_t maxSize)
+    {
+        if (!m_tx.IsOpen()) {
+            std::cerr << "Send operation not allowed (Receive only)." << std::endl;
+            return nullptr;
+        }
+        if (maxSize > GetMaxPayloadSize()) {
+            std::cerr << "Error: Payload too large." << std::endl;
+            return nullptr;
+        }
+        if (!Enter())
+            return nullptr;
+
+        uint8_t* record = m_tx.BeginWrite(GetHeaderSize() + maxSize, m_sendTimeout);
+        if (!record) {
+            Leave();
+            return nullptr;
+        }
+        m_slot = record;
+        return record + GetHeaderSize();
+    }
+
+    /// @brief Publish the slot returned by `Reserve()`.
+    /// @param[in] header The header to send. The length field is set by the transport.
+    /// @param[in] size The payload bytes written.
+    /// @return 0 if success.
+    int Commit(const DmqHeader& header, size_t size)
+    {
+        if (!m_slot)
+            return -1;
+
+        DmqHeader headerCopy = header;
+        headerCopy.SetLength(static_cast<uint32_t>(size));
+        if (m_extendedHeader)
+            headerCopy.SetExtended(true);
+        if (m_headerTimestamp)
+            headerCopy.SetTimestamp(DmqHeader::GetTimestampNow());
+
+        // The header space was sized by GetHeaderSize() with the same settings
+        const size_t headerSize = WriteHeader(headerCopy, m_slot);
+        m_slot = nullptr;
+        m_tx.EndWrite(headerSize + size);
+        Leave();
+
+        if (headerCopy.GetId() != dmq::ACK_REMOTE_ID && m_transportMonitor)
+            m_transportMonitor->Add(headerCopy.GetWireSeqNum(), headerCopy.GetId());
+        return 0;
+    }
+
+    /// Release the slot returned by `Reserve()` without sending.
+    void Cancel()
+    {
+        if (!m_slot)
+            return;
+        m_slot = nullptr;
+        m_tx.AbortWrite();
+        Leave();
+    }
+
+    /// @brief Serialize arguments directly into a ring slot and send them.
+    /// @details The zero-copy alternative to dispatching through a `RemoteChannel`:
+    /// the serializer's output stream is the ring slot itself. The slot is reserved
+    /// at `SetInPlaceSize()` bytes; a larger message fails and is not sent.
+    /// @param[in] id The remote ID.
+    /// @param[in] serializer The serializer for the remote signature.
+    /// @param[in] args The arguments to serialize.
+    /// @return 0 if success.
+    template <class RetType, class... Args>
+    int SendInPlace(dmq::DelegateRemoteId id, dmq::ISerializer<RetType(Args...)>& serializer, const Args&... args)
+    {
+        const size_t max = GetMaxPayloadSize();
+        uint8_t* slot = Reserve(m_inPlaceSize < max ? m_inPlaceSize : max);
+        if (!slot)
+            return -1;
+
+        ShmSlotStreamBuf buf(slot, m_inPlaceSize < max ? m_inPlaceSize : max);
+        std::ostream os(&buf);
+        serializer.Write(os, args...);
+        if (!os.good()) {
+            Cancel();
+            std::cerr << "Error: In-place serialization failed." << std::endl;
+            return -1;
+        }
+        return Commit(DmqHeader(id, DmqHeader::GetNextSeqNum()), buf.Size());
+    }
+
+    /// Set the slot size reserved by `SendInPlace()`.
+    void SetInPlaceSize(size_t size) { m_inPlaceSize = size; }
+
+    virtual int Receive(xstringstream& is, DmqHeader& header) override
+    {
+        TransportBuffer payload;
+        if (!Enter())
+            return -1;
+        int err = ReceiveRecord(payload, header);
+        if (err == 0) {
+            is.write(static_cast<const char*>(payload.data), payload.size);
+            m_rx.EndRead();
+        }
+        Leave();
+        return err == 0 ? Acknowledge(header) : err;
+    }
+
+    /// View the next message's payload in the ring. The record is held, and the
+    /// space not reused, until the next receive call or `Close()`.
+    virtual int ReceiveView(TransportBuffer& payload, DmqHeader& header) override
+    {
+        if (!Enter())
+            return -1;
+        int err = ReceiveRecord(payload, header);
+        Leave();
+        return err == 0 ? Acknowledge(header) : err;
+    }
+
+    virtual bool SupportsReceiveView() const override { return true; }
+
+    virtual bool HasPending() const override { return m_rx.HasData(); }
+
+    void SetTransportMonitor(ITransportMonitor* transportMonitor)
+    {
+        m_transportMonitor = transportMonitor;
+    }
+
+    void SetSendTransport(ITransport* sendTransport)
+    {
+        m_sendTransport = sendTransport;
+    }
+
+    void SetRecvTransport(ITransport* recvTransport)
+    {
+        m_recvTransport = recvTransport;
+    }
+
+private:
+    /// Release any held record and wait for the next one. The new record is held
+    /// on success. Called between Enter() and Leave().
+    int ReceiveRecord(TransportBuffer& payload, DmqHeader& header)
+    {
+        if (m_recvTransport != this) {
+            std::cerr << "Receive operation not allowed (Send only)." << std::endl;
+            return -1;
+        }
+        if (!m_rx.IsOpen())
+            return -1;
+        if (m_rx.IsReading())
+            m_rx.EndRead();
+
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        if (!m_rx.BeginRead(data, size, m_recvTimeout))
+            return -1; // Timeout or closed
+
+        size_t headerSize = ReadHeader(data, size, header);
+        if (headerSize == 0)
+        {
+            m_rx.EndRead();
+            std::cerr << "Invalid sync marker!" << std::endl;
+            return -1;
+        }
+        payload.data = data + headerSize;
+        payload.size = size - headerSize;
+        return 0;
+    }
+
+    /// Complete ACK bookkeeping for a received message.
+    int Acknowledge(const DmqHeader& header)
+    {
+        if (header.GetId() == dmq::ACK_REMOTE_ID)
+        {
+            if (m_transportMonitor)
+                m_transportMonitor->Remove(header.GetSeqNum32());
+        }
+        else if (m_transportMonitor && m_sendTransport && (m_sendTransport != this || m_tx.IsOpen()))
+        {
+            xostringstream ss_ack;
+            DmqHeader ack;
+            ack.SetId(dmq::ACK_REMOTE_ID);
+            ack.SetSeqNum(header.GetSeqNum32());
+            m_sendTransport->Send(ss_ack, ack);
+        }
+        return 0;
+    }
+
+    size_t GetHeaderSize() const
+    {
+        if (!m_extendedHeader)
+            return DmqHeader::HEADER_SIZE;
+        return m_headerTimestamp ? DmqHeader::MAX_HEADER_SIZE : DmqHeader::EXT_HEADER_SIZE;
+    }
+
+    // Track calls using the rings so Close() can wait for them to leave
+    bool Enter()
+    {
+        m_users.fetch_add(1);
+        if (m_closed.load()) {
+            m_users.fetch_sub(1);
+            return false;
+        }
+        return true;
+    }
+
+    void Leave() { m_users.fetch_sub(1); }
+
+    ShmRing m_tx;
+    ShmRing m_rx;
+    uint8_t* m_slot = nullptr;                      // Reserved record; write lock held
+
+    std::atomic<bool> m_closed{ true };
+    std::atomic<int> m_users{ 0 };
+
+    std::chrono::milliseconds m_recvTimeout{ 2000 };
+    std::chrono::milliseconds m_sendTimeout{ 1000 };
+    size_t m_inPlaceSize = 4096;
+
+    ITransport* m_sendTransport = nullptr;
+    ITransport* m_recvTransport = nullptr;
+    ITransportMonitor* m_transportMonitor = nullptr;
+    bool m_extendedHeader = false;
+    bool m_headerTimestamp = false;
+};
+
+} // namespace dmq::transport
+
+#endif // SHM_TRANSPORT_H
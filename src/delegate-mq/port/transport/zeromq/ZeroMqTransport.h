@@ -40,6 +40,7 @@
 #include <zmq.h>
 #include <sstream>
 #include <cstdio>
+#include <cstring>
 #include <mutex>
 #include <iostream> // For std::cout/cerr
 
@@ -182,13 +183,22 @@ public:
 
     virtual int Send(dmq::xostringstream& os, const DmqHeader& header) override
     {
-        std::lock_guard<std::recursive_mutex> lock(m_mutex);
-
         if (os.bad() || os.fail()) {
             std::cout << "Error: xostringstream is in a bad state!" << std::endl;
             return -1;
         }
 
+        TransportBuffer payload = GetStreamBuffer(os);
+        return SendBuffers(header, &payload, 1);
+    }
+
+    /// Send the header and payload buffers as one ZeroMQ message. The frame is
+    /// allocated once with zmq_msg_init_size() and the buffers are copied directly
+    /// into it; ZeroMQ owns and releases the frame after it is transmitted.
+    virtual int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count) override
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
         if (m_zmq == nullptr) {
             return -1;
         }
@@ -207,50 +217,47 @@ public:
         DmqHeader headerCopy = header;
 
         // Calculate payload size and set it on the copy
-        auto payload = os.str();
-        if (payload.length() > UINT16_MAX) {
+        size_t payloadSize = GetBufferSize(buffers, count);
+        if (payloadSize > UINT16_MAX) {
             std::cerr << "Error: Payload too large for 16-bit length." << std::endl;
             return -1;
         }
-        headerCopy.SetLength(static_cast<uint16_t>(payload.length()));
-
-        dmq::xostringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+        headerCopy.SetLength(static_cast<uint16_t>(payloadSize));
 
-        // Write header values from the COPY
-        auto marker = htons(headerCopy.GetMarker());
-        ss.write(reinterpret_cast<const char*>(&marker), sizeof(marker));
-
-        auto id = htons(headerCopy.GetId());
-        ss.write(reinterpret_cast<const char*>(&id), sizeof(id));
-
-        auto seqNum = htons(headerCopy.GetSeqNum());
-        ss.write(reinterpret_cast<const char*>(&seqNum), sizeof(seqNum));
-
-        auto len = htons(headerCopy.GetLength());
-        ss.write(reinterpret_cast<const char*>(&len), sizeof(len));
-
-        // Insert delegate arguments (payload)
-        ss.write(payload.data(), payload.size());
+        zmq_msg_t msg;
+        if (zmq_msg_init_size(&msg, headerCopy.GetWireSize() + payloadSize) != 0)
+            return zmq_errno();
 
-        auto fullPacket = ss.str();
+        // Write header (Network Byte Order) followed by delegate arguments (payload)
+        uint8_t* dest = static_cast<uint8_t*>(zmq_msg_data(&msg));
+        dest += WriteHeader(headerCopy, dest);
+        for (size_t i = 0; i < count; i++) {
+            if (buffers[i].size > 0)
+                memcpy(dest, buffers[i].data, buffers[i].size);
+            dest += buffers[i].size;
+        }
 
-        // Send delegate argument data using ZeroMQ
-        int err = zmq_send(m_zmq, fullPacket.c_str(), fullPacket.size(), ZMQ_DONTWAIT);
+        // Send delegate argument data using ZeroMQ. On success ZeroMQ takes ownership.
+        int err = zmq_msg_send(&msg, m_zmq, ZMQ_DONTWAIT);
         if (err == -1)
         {
             // EAGAIN is common if queue is full, treat as error so RetryMonitor retries
-            return zmq_errno();
+            int errNo = zmq_errno();
+            zmq_msg_close(&msg);
+            return errNo;
         }
 
         if (headerCopy.GetId() != dmq::ACK_REMOTE_ID)
         {
             if (m_transportMonitor)
-                m_transportMonitor->Add(headerCopy.GetSeqNum(), headerCopy.GetId());
+                m_transportMonitor->Add(headerCopy.GetWireSeqNum(), headerCopy.GetId());
         }
 
         return 0;
     }
 
+    virtual bool SupportsBufferSend() const override { return true; }
+
     virtual int Receive(dmq::xstringstream& is, DmqHeader& header) override
     {
         std::lock_guard<std::recursive_mutex> lock(m_mutex);
@@ -321,7 +328,7 @@ public:
         {
             // Receiver ack'ed message. Remove sequence number from monitor.
             if (m_transportMonitor)
-                m_transportMonitor->Remove(header.GetSeqNum());
+                m_transportMonitor->Remove(header.GetWireSeqNum());
         }
         else
         {
@@ -331,7 +338,7 @@ public:
                 dmq::xostringstream ss_ack;
                 DmqHeader ack;
                 ack.SetId(dmq::ACK_REMOTE_ID);
-                ack.SetSeqNum(header.GetSeqNum());
+                ack.SetSeqNum(header.GetWireSeqNum());
 
                 // Note: Recursive mutex allows us to call Send() if m_sendTransport == this.
                 // If m_sendTransport is a different instance, that instance's lock will be taken.
@@ -119,6 +119,12 @@ int main(void)
 
     extern int stress_test_databus();
     stress_test_databus();
+
+    extern int stress_test_semaphore();
+    stress_test_semaphore();
+
+    extern int stress_test_signal();
+    stress_test_signal();
     return 0;
 #endif
 
@@ -29,6 +29,9 @@
 /// concurrency and outperforms the simple mutex-based XALLOCATOR. XALLOCATOR remains 
 /// superior for embedded systems where the system heap is slow, non-deterministic,
 /// or prone to fragmentation over long uptimes.
+///
+/// @note The results above predate the xallocator per-thread block cache. With
+/// `DMQ_THREAD_STDLIB` most `xmalloc()`/`xfree()` calls no longer take the mutex.
 
 #include "DelegateMQ.h"
 #include <iostream>
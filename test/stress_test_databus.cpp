@@ -30,6 +30,13 @@
 ///     • "db/ghost" has no subscribers → SubscribeUnhandled fires every publish
 ///     • g_db_unhandledCount == g_db_ghostPub
 ///
+///   MULTI-TOPIC SCALING — runs before the mixed-load phase:
+///     • 1, 2, 4 … N publisher threads, each on its own topic with one sync subscriber
+///     • Disjoint topics share no DataBus lock, so aggregate throughput must grow
+///       with the thread count up to the number of cores
+///     • Integrity: received == published for every thread count
+///     • Scaling: rate(N) >= DB_SCALE_MIN_EFFICIENCY × N × rate(1) when N <= cores
+///
 ///   CHAOS MONKEY — thread-safety only:
 ///     • Rapidly connects/disconnects a volatile async subscriber on "db/async"
 ///     • Counts NOT included in integrity totals
@@ -47,6 +54,8 @@
 #include <queue>
 #include <mutex>
 #include <condition_variable>
+#include <algorithm>
+#include <string>
 
 #if defined(DMQ_DATABUS)
 
@@ -66,6 +75,9 @@ static constexpr int     DB_NUM_PUB_THREADS   = 4;   // publish to sync + async
 static constexpr int     DB_NUM_SYNC_SUBS     = 2;
 static constexpr int     DB_NUM_ASYNC_SUBS    = 3;
 static constexpr DelegateRemoteId DB_ECHO_REMOTE_ID = 77;
+static constexpr int     DB_SCALE_MAX_THREADS = 8;
+static constexpr int     DB_SCALE_DURATION_MS = 1000;
+static constexpr double  DB_SCALE_MIN_EFFICIENCY = 0.5;
 
 // ---------------------------------------------------------------------------
 // Topics
@@ -157,6 +169,82 @@ private:
 
 static DbLoopbackTransport g_dbTransport;
 
+// ---------------------------------------------------------------------------
+// Multi-topic scaling — each publisher owns one topic
+// ---------------------------------------------------------------------------
+struct DbScaleResult {
+    int      threads = 0;
+    double   rate = 0;
+    uint64_t published = 0;
+    uint64_t received = 0;
+};
+
+// One counter per topic, padded so publishers do not share a cache line.
+struct alignas(64) DbScaleCounter {
+    std::atomic<uint64_t> received{0};
+    uint64_t published = 0;
+};
+
+static DbScaleResult RunScalePass(int threadCount) {
+    DataBus::ResetForTesting();
+
+    std::vector<DbScaleCounter> counters(threadCount);
+    std::vector<ScopedConnection> conns;
+    std::vector<std::string> topics;
+    for (int i = 0; i < threadCount; ++i) {
+        topics.push_back("db/scale/" + std::to_string(i));
+        auto* counter = &counters[i];
+        conns.push_back(DataBus::Subscribe<int>(topics[i], [counter](int) {
+            counter->received.fetch_add(1, std::memory_order_relaxed);
+        }));
+    }
+
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i]() {
+            const std::string& topic = topics[i];
+            uint64_t published = 0;
+            while (!start) std::this_thread::yield();
+            while (!stop) {
+                DataBus::Publish<int>(topic, static_cast<int>(published));
+                ++published;
+            }
+            counters[i].published = published;
+        });
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    start = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(DB_SCALE_DURATION_MS));
+    stop = true;
+    for (auto& t : threads) t.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+
+    DbScaleResult result;
+    result.threads = threadCount;
+    for (auto& c : counters) {
+        result.published += c.published;
+        result.received += c.received.load();
+    }
+    result.rate = result.published / elapsed.count();
+    conns.clear();
+    return result;
+}
+
+static std::vector<DbScaleResult> RunScaleTest() {
+    std::cout << "Multi-topic scaling (" << DB_SCALE_DURATION_MS << " ms per pass)...\n";
+    std::vector<DbScaleResult> results;
+    for (int n = 1; n <= DB_SCALE_MAX_THREADS; n *= 2) {
+        results.push_back(RunScalePass(n));
+        std::cout << "  " << std::setw(2) << n << " topic(s): "
+                  << static_cast<uint64_t>(results.back().rate) << " msg/s\n";
+    }
+    std::cout << std::endl;
+    return results;
+}
+
 // ---------------------------------------------------------------------------
 // stress_test_databus
 // ---------------------------------------------------------------------------
@@ -172,6 +260,8 @@ int stress_test_databus()
     std::cout << "Features:   LVC, minSep, Filter, Remote, Monitor, Unhandled, Chaos\n";
     std::cout << "Starting...\n" << std::endl;
 
+    const std::vector<DbScaleResult> scaleResults = RunScaleTest();
+
     DataBus::ResetForTesting();
 
     // -----------------------------------------------------------------------
@@ -477,6 +567,26 @@ int stress_test_databus()
               << (rateOk ? " [OK]\n" : " [FAIL]\n");
     if (!rateOk) pass = false;
 
+    // Scaling: disjoint topics must scale with cores. Passes beyond the core
+    // count are reported but cannot be expected to scale.
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    const double baseRate = scaleResults.front().rate;
+    for (const auto& r : scaleResults) {
+        std::string label = "Scale " + std::to_string(r.threads) + " topic(s)";
+        report(label.c_str(), r.received, r.published);
+
+        const double speedup = baseRate > 0 ? r.rate / baseRate : 0;
+        const bool expectScaling = r.threads > 1 && static_cast<unsigned>(r.threads) <= cores;
+        const bool scaleOk = !expectScaling || speedup >= DB_SCALE_MIN_EFFICIENCY * r.threads;
+        std::cout << std::left << std::setw(22) << ""
+                  << " speedup=" << std::fixed << std::setprecision(2) << speedup << "x"
+                  << std::defaultfloat;
+        if (r.threads == 1)  { std::cout << " [BASE]\n"; }
+        else if (!expectScaling) { std::cout << " [SKIP — " << cores << " core(s)]\n"; }
+        else if (scaleOk)    { std::cout << " [OK]\n"; }
+        else                 { std::cout << " [FAIL]\n"; pass = false; }
+    }
+
     bool monOk = (monitor > 0);
     std::cout << std::left << std::setw(22) << "Monitor Events"
               << " count=" << monitor
@@ -3,6 +3,9 @@
 #include <iostream>
 #include <set>
 #include <cstring>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace dmq;
 using namespace dmq::os;
@@ -685,6 +688,126 @@ static void SignalThreadSafeTests()
     }
 }
 
+static void SignalLockFreeEmitTests()
+{
+    // Test 1: Disconnecting another slot during emit. The current emit still
+    // invokes it (snapshot semantics); later emits do not.
+    {
+        Signal<void()> sig;
+        int count1 = 0, count2 = 0;
+        ScopedConnection c2;
+        std::function<void()> slot1 = [&]() { count1++; c2.Disconnect(); };
+        std::function<void()> slot2 = [&]() { count2++; };
+        ScopedConnection c1 = sig.Connect(MakeDelegate(slot1));
+        c2 = sig.Connect(MakeDelegate(slot2));
+
+        sig();
+        ASSERT_TRUE(count1 == 1 && count2 == 1);
+        ASSERT_TRUE(sig.Size() == 1);
+        sig();
+        ASSERT_TRUE(count1 == 2 && count2 == 1);
+    }
+
+    // Test 2: Signal destroyed by one of its own slots during emit
+    {
+        auto* sig = new Signal<void()>();
+        int count = 0;
+        std::function<void()> destroy = [&]() { count++; delete sig; sig = nullptr; };
+        std::function<void()> after = [&]() { count++; };
+        ScopedConnection c1 = sig->Connect(MakeDelegate(destroy));
+        ScopedConnection c2 = sig->Connect(MakeDelegate(after));
+
+        (*sig)();
+        ASSERT_TRUE(sig == nullptr);
+        ASSERT_TRUE(count == 2);
+        c1.Disconnect();
+        c2.Disconnect();
+    }
+
+    // Test 3: Nested emit and connect from within a slot
+    {
+        Signal<void(int)> sig;
+        int count = 0;
+        ScopedConnection inner;
+        std::function<void(int)> slot = [&](int depth) {
+            count++;
+            if (depth == 0) {
+                inner = sig.Connect(MakeDelegate(std::function<void(int)>([&](int) { count++; })));
+                sig(1);
+            }
+        };
+        ScopedConnection c1 = sig.Connect(MakeDelegate(slot));
+        sig(0);
+        ASSERT_TRUE(count == 3);    // Outer slot, nested outer slot, nested inner slot
+        ASSERT_TRUE(sig.Size() == 2);
+    }
+
+    // Test 4: Concurrent emit while subscribers connect and disconnect
+    {
+        Signal<void(int*)> sig;
+        std::atomic<bool> stop{ false };
+        std::atomic<int> emits{ 0 };
+        ScopedConnection fixed = sig.Connect(MakeDelegate(+[](int* p) { (*p)++; }));
+
+        std::vector<std::thread> emitters;
+        for (int t = 0; t < 2; t++) {
+            emitters.emplace_back([&]() {
+                while (!stop) {
+                    int calls = 0;
+                    sig(&calls);
+                    ASSERT_TRUE(calls >= 1);
+                    emits++;
+                }
+            });
+        }
+
+        for (int i = 0; i < 2000; i++) {
+            ScopedConnection conn = sig.Connect(MakeDelegate(+[](int* p) { (*p)++; }));
+            if (i % 100 == 0)
+                std::this_thread::yield();
+        }
+        stop = true;
+        for (auto& t : emitters)
+            t.join();
+        ASSERT_TRUE(sig.Size() == 1);
+        ASSERT_TRUE(emits > 0);
+    }
+
+    // Test 5: Concurrent MulticastDelegateSafe invoke with insert/remove
+    {
+        MulticastDelegateSafe<void(int)> del;
+        std::atomic<bool> stop{ false };
+        std::thread invoker([&]() {
+            while (!stop)
+                del(TEST_INT);
+        });
+
+        for (int i = 0; i < 2000; i++) {
+            del += MakeDelegate(FreeFuncInt1);
+            del -= MakeDelegate(FreeFuncInt1);
+        }
+        stop = true;
+        invoker.join();
+        ASSERT_TRUE(del.Empty());
+    }
+
+    // Test 6: Every emit reaches every subscriber. Throughput is measured in
+    // test/stress_test_signal.cpp.
+    {
+        const int SLOTS = 32;
+        const int EMITS = 100;
+        Signal<void(int*)> sig;
+        std::vector<ScopedConnection> conns;
+        for (int i = 0; i < SLOTS; i++)
+            conns.push_back(sig.Connect(MakeDelegate(+[](int* p) { (*p)++; })));
+
+        int calls = 0;
+        for (int i = 0; i < EMITS; i++)
+            sig(&calls);
+        ASSERT_TRUE(calls == SLOTS * EMITS);
+    }
+}
+
 void ContainersTests()
 {
     UnicastDelegateTests();
@@ -697,4 +820,5 @@ void ContainersTests()
 
     SignalTests();
     SignalThreadSafeTests();
+    SignalLockFreeEmitTests();
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include <iostream>
 #include <set>
 #include <cstring>
+#include <future>
+#include <thread>
+#include <vector>
 
 using namespace dmq;
 using namespace dmq::os;
@@ -815,6 +818,134 @@ static void DelegateFunctionAsyncTests()
     }
 }
 
+// Verify arguments are copied inline into the message and the message carries its own invoker
+static void DelegateAsyncMsgTests()
+{
+    // Reference, pointer and pointer-to-pointer arguments are copied at dispatch
+    {
+        int refVal = 0, ptrVal = 0, ptrPtrVal = 0;
+        bool nullPtr = false, nullInner = false;
+        std::string strVal;
+        std::promise<void> done;
+
+        std::function<void(const int&, int*, int**, int*, int**, std::string)> func =
+            [&](const int& r, int* p, int** pp, int* np, int** npp, std::string s) {
+                refVal = r;
+                ptrVal = *p;
+                ptrPtrVal = **pp;
+                nullPtr = (np == nullptr);
+                nullInner = (npp != nullptr && *npp == nullptr);
+                strVal = s;
+                done.set_value();
+            };
+        auto delegate = MakeDelegate(func, workerThread);
+
+        int r = 1, p = 2, inner = 3;
+        int* pInner = &inner;
+        int* nullInnerPtr = nullptr;
+
+        // Hold the target thread so source values change before the invoke
+        std::promise<void> release;
+        std::shared_future<void> gate = release.get_future().share();
+        auto blocker = MakeDelegate(std::function<void()>([gate]() { gate.wait(); }), workerThread);
+        blocker();
+        delegate(r, &p, &pInner, nullptr, &nullInnerPtr, "abc");
+        r = p = inner = 0;
+        release.set_value();
+
+        done.get_future().wait();
+        ASSERT_TRUE(refVal == 1);
+        ASSERT_TRUE(ptrVal == 2);
+        ASSERT_TRUE(ptrPtrVal == 3);
+        ASSERT_TRUE(nullPtr);
+        ASSERT_TRUE(nullInner);
+        ASSERT_TRUE(strVal == "abc");
+    }
+
+    // Embedded invoker is returned as an aliasing pointer that owns the message
+    {
+        using Del = DelegateFreeAsync<void(int)>;
+        Del delegate(FreeFuncInt1, workerThread);
+        std::weak_ptr<DelegateMsg> weakMsg;
+        std::shared_ptr<IThreadInvoker> invoker;
+        {
+            auto msg = xmake_shared<DelegateAsyncInvokerMsg<Del, int>>(delegate, Priority::HIGH, TEST_INT);
+            ASSERT_TRUE(msg->GetPriority() == Priority::HIGH);
+            ASSERT_TRUE(std::get<0>(msg->GetArgs()) == TEST_INT);
+            weakMsg = msg;
+            invoker = msg->GetInvoker();
+            ASSERT_TRUE(invoker != nullptr);
+            ASSERT_TRUE(invoker->Invoke(msg));
+        }
+        ASSERT_TRUE(!weakMsg.expired());
+        invoker.reset();
+        ASSERT_TRUE(weakMsg.expired());
+    }
+    std::cout << "DelegateAsyncMsgTests() complete!" << std::endl;
+}
+
+// Verify slab blocks are recycled and can be freed from any thread
+static void SlabPoolTests()
+{
+    struct SlabObj { double d; char c[24]; };
+    auto& pool = SlabPool<SlabObj>::Instance();
+    ASSERT_TRUE(&pool == &SlabPool<SlabObj>::Instance());
+    ASSERT_TRUE(SlabPool<SlabObj>::GetBlockSize() >= sizeof(SlabObj));
+
+    // The pool persists across test runs; a freed block is reused next
+    void* a = pool.Allocate();
+    void* b = pool.Allocate();
+    ASSERT_TRUE(a && b && a != b);
+    ASSERT_TRUE(reinterpret_cast<uintptr_t>(a) % alignof(SlabObj) == 0);
+    const size_t blockCount = pool.GetBlockCount();
+    ASSERT_TRUE(blockCount >= SLAB_CHUNK_SIZE && blockCount % SLAB_CHUNK_SIZE == 0);
+    ASSERT_TRUE(pool.GetBlocksInUse() == 2);
+    pool.Deallocate(a);
+    ASSERT_TRUE(pool.Allocate() == a);
+
+    // Exhaust the free list to force one more chunk
+    std::vector<void*> blocks = { a, b };
+    while (blocks.size() <= blockCount)
+        blocks.push_back(pool.Allocate());
+    ASSERT_TRUE(pool.GetBlockCount() == blockCount + SLAB_CHUNK_SIZE);
+    ASSERT_TRUE(std::set<void*>(blocks.begin(), blocks.end()).size() == blocks.size());
+
+    // Free from another thread returns blocks to the same pool
+    std::thread t([&]() {
+        for (void* p : blocks)
+            pool.Deallocate(p);
+    });
+    t.join();
+    ASSERT_TRUE(pool.GetBlocksInUse() == 0);
+    ASSERT_TRUE(pool.GetAllocations() == pool.GetDeallocations());
+
+    // Shared object and control block recycled through SlabAllocator
+    {
+        std::weak_ptr<std::string> weak;
+        {
+            auto sp = std::allocate_shared<std::string>(SlabAllocator<std::string>(), "slab");
+            ASSERT_TRUE(*sp == "slab");
+            weak = sp;
+        }
+        ASSERT_TRUE(weak.expired());
+    }
+
+    // Async messages drawn from the slab still dispatch normally
+    {
+        std::atomic<int> sum{ 0 };
+        std::promise<void> done;
+        auto delegate = MakeDelegate(std::function<void(int)>([&](int v) {
+            if ((sum += v) == 6)
+                done.set_value();
+        }), workerThread);
+        delegate(1);
+        delegate(2);
+        delegate(3);
+        ASSERT_TRUE(done.get_future().wait_for(std::chrono::seconds(2)) == std::future_status::ready);
+    }
+    std::cout << "SlabPoolTests() complete!" << std::endl;
+}
+
 void DelegateAsyncTests()
 {
     workerThread.CreateThread();
@@ -824,6 +955,8 @@ void DelegateAsyncTests()
     DelegateMemberSpAsyncTests();
     DelegateMemberAsyncSpTests();
     DelegateFunctionAsyncTests();
+    DelegateAsyncMsgTests();
+    SlabPoolTests();
 
     workerThread.ExitThread();
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <iostream>
 #include <set>
 #include <cstring>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace dmq;
 using namespace dmq::os;
@@ -24,6 +27,16 @@ namespace AsyncWait
 
     int TestReturn::val = 0;
 
+    struct CopyCounter
+    {
+        static int copies;
+        CopyCounter() = default;
+        CopyCounter(const CopyCounter&) { copies++; }
+        std::string operator()(const std::string& s, int n) const { return s + std::to_string(n); }
+    };
+
+    int CopyCounter::copies = 0;
+
     class TestReturnClass
     {
     public:
@@ -904,6 +917,72 @@ static void DelegateFunctionAsyncWaitTests()
     }
 }
 
+// Verify the per-thread reusable wait message: no delegate clone, typed return
+// value, and recovery after a timed out call
+static void DelegateAsyncWaitMsgTests()
+{
+    // Functor copies reveal a delegate clone
+    using AsyncWait::CopyCounter;
+
+    {
+        auto delegate = MakeDelegate(std::function<std::string(const std::string&, int)>(CopyCounter()), workerThread, WAIT_INFINITE);
+        const int copiesBefore = CopyCounter::copies;
+        for (int i = 0; i < 100; i++) {
+            ASSERT_TRUE(delegate("v", i) == "v" + std::to_string(i));
+            ASSERT_TRUE(delegate.IsSuccess());
+            ASSERT_TRUE(delegate.GetRetVal() == "v" + std::to_string(i));
+        }
+        ASSERT_TRUE(CopyCounter::copies == copiesBefore);
+    }
+
+    // Reference and value arguments pass through to the target
+    {
+        auto delegate = MakeDelegate(std::function<void(int&, std::string)>(
+            [](int& out, std::string s) { out = static_cast<int>(s.size()); }), workerThread, WAIT_INFINITE);
+        int out = 0;
+        delegate(out, "four");
+        ASSERT_TRUE(delegate.IsSuccess() && out == 4);
+    }
+
+    // A timed out call is not reused; the next call waits for its own result
+    {
+        std::atomic<bool> release{ false };
+        auto blocker = MakeDelegate(std::function<void()>([&]() {
+            while (!release)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }), workerThread);
+        auto target = MakeDelegate(std::function<int(int)>([](int v) { return v * 2; }), workerThread, std::chrono::milliseconds(10));
+
+        blocker();                              // Worker busy; wait calls time out while queued
+        ASSERT_TRUE(target(1) == 0 && !target.IsSuccess());
+        ASSERT_TRUE(!target.AsyncInvoke(2).has_value());
+        release = true;
+
+        auto target2 = MakeDelegate(std::function<int(int)>([](int v) { return v * 2; }), workerThread, WAIT_INFINITE);
+        ASSERT_TRUE(target2(21) == 42 && target2.IsSuccess());
+        ASSERT_TRUE(target2(22) == 44 && target2.IsSuccess());
+    }
+
+    // Many caller threads block on the same delegate concurrently
+    {
+        auto delegate = MakeDelegate(std::function<int(int)>([](int v) { return v + 1; }), workerThread, WAIT_INFINITE);
+        std::atomic<int> errors{ 0 };
+        std::vector<std::thread> callers;
+        for (int t = 0; t < 4; t++) {
+            callers.emplace_back([&errors, delegate, t]() mutable {
+                for (int i = 0; i < 200; i++) {
+                    if (delegate(t * 1000 + i) != t * 1000 + i + 1 || !delegate.IsSuccess())
+                        errors++;
+                }
+            });
+        }
+        for (auto& c : callers)
+            c.join();
+        ASSERT_TRUE(errors == 0);
+    }
+    std::cout << "DelegateAsyncWaitMsgTests() complete!" << std::endl;
+}
+
 void DelegateAsyncWaitTests()
 {
     workerThread.CreateThread();
@@ -913,6 +992,7 @@ void DelegateAsyncWaitTests()
     DelegateMemberSpAsyncWaitTests();
     DelegateMemberAsyncWaitSpTests();
     DelegateFunctionAsyncWaitTests();
+    DelegateAsyncWaitMsgTests();
 
     workerThread.ExitThread();
 }
\ No newline at end of file
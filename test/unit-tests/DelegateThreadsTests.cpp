@@ -5,6 +5,9 @@
 #include <chrono>
 #include <cstring>
 #include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
 
 using namespace dmq;
 using namespace dmq::os;
@@ -450,6 +453,309 @@ static void ThreadFullPolicyTests()
     FullPolicy_UnlimitedQueue_DeliversAll();
 }
 
+// ---------------------------------------------------------------------------
+// QueueEngine::LOCK_FREE tests
+// ---------------------------------------------------------------------------
+
+// Many producers posting concurrently; every message is delivered exactly once.
+static void LockFree_MultiProducer_DeliversAll()
+{
+    Thread lfThread("LockFreeThread", 0, FullPolicy::FAULT, dmq::DEFAULT_DISPATCH_TIMEOUT, "", QueueEngine::LOCK_FREE);
+    lfThread.CreateThread();
+
+    const int PRODUCERS = 8;
+    const int SEND_COUNT = 2000;
+    std::atomic<int> deliveredCount{ 0 };
+    auto del = MakeDelegate(std::function<void()>([&deliveredCount]() { deliveredCount++; }), lfThread);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++)
+        producers.emplace_back([&del]() { for (int i = 0; i < SEND_COUNT; i++) del(); });
+    for (auto& t : producers)
+        t.join();
+
+    while (lfThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    ASSERT_TRUE(deliveredCount == PRODUCERS * SEND_COUNT);
+
+    lfThread.ExitThread();
+    std::cout << "LockFree_MultiProducer_DeliversAll() complete!" << std::endl;
+}
+
+// Higher priority messages are processed first; equal priorities are FIFO.
+static void LockFree_PriorityOrder()
+{
+    Thread lfThread("LockFreePriorityThread", 0, FullPolicy::FAULT, dmq::DEFAULT_DISPATCH_TIMEOUT, "", QueueEngine::LOCK_FREE);
+    lfThread.CreateThread();
+
+    std::vector<int> order;
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+
+    // Block the consumer so all messages queue up before any are processed
+    MakeDelegate(std::function<void()>([gate]() { gate.wait(); }), lfThread)();
+    while (lfThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    auto record = std::function<void(int)>([&order](int v) { order.push_back(v); });
+    auto low = MakeDelegate(record, lfThread);
+    low.SetPriority(Priority::LOW);
+    auto high = MakeDelegate(record, lfThread);
+    high.SetPriority(Priority::HIGH);
+
+    low(1);
+    high(2);
+    low(3);
+    high(4);
+    release.set_value();
+
+    while (lfThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    lfThread.ExitThread();
+
+    ASSERT_TRUE((order == std::vector<int>{ 2, 4, 1, 3 }));
+    std::cout << "LockFree_PriorityOrder() complete!" << std::endl;
+}
+
+// A producer blocked on a full ring (maxQueueSize 0) resumes as the consumer drains.
+static void LockFree_RingFull_ProducerResumes()
+{
+    Thread lfThread("LockFreeRingThread", 0, FullPolicy::FAULT, dmq::DEFAULT_DISPATCH_TIMEOUT, "", QueueEngine::LOCK_FREE);
+    lfThread.CreateThread();
+
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+    MakeDelegate(std::function<void()>([gate]() { gate.wait(); }), lfThread)();
+    while (lfThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    const int SEND_COUNT = static_cast<int>(dmq::LOCKFREE_QUEUE_SIZE) + 100;
+    std::atomic<int> deliveredCount{ 0 };
+    auto del = MakeDelegate(std::function<void()>([&deliveredCount]() { deliveredCount++; }), lfThread);
+    std::thread producer([&del]() { for (int i = 0; i < SEND_COUNT; i++) del(); });
+
+    // Wait until the producer holds a reservation it cannot push
+    while (lfThread.GetQueueSize() <= dmq::LOCKFREE_QUEUE_SIZE)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    release.set_value();
+    producer.join();
+
+    while (lfThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(deliveredCount == SEND_COUNT);
+
+    lfThread.ExitThread();
+    std::cout << "LockFree_RingFull_ProducerResumes() complete!" << std::endl;
+}
+
+// FullPolicy is enforced by the atomic queue bound.
+static void LockFree_FullPolicy()
+{
+    {
+        Thread dropThread("LockFreeDropThread", 3, FullPolicy::DROP, dmq::DEFAULT_DISPATCH_TIMEOUT, "", QueueEngine::LOCK_FREE);
+        dropThread.CreateThread();
+
+        std::atomic<int> deliveredCount{ 0 };
+        auto slowConsumer = [&deliveredCount]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            deliveredCount++;
+        };
+        for (int i = 0; i < 10; i++)
+            MakeDelegate(slowConsumer, dropThread)();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        ASSERT_TRUE(deliveredCount < 10);
+        ASSERT_TRUE(deliveredCount > 0);
+        dropThread.ExitThread();
+    }
+    {
+        Thread timeoutThread("LockFreeTimeoutThread", 3, FullPolicy::TIMEOUT, dmq::DEFAULT_DISPATCH_TIMEOUT, "", QueueEngine::LOCK_FREE);
+        timeoutThread.CreateThread();
+
+        std::atomic<int> deliveredCount{ 0 };
+        const int SEND_COUNT = 10;
+        std::thread sender([&]() {
+            for (int i = 0; i < SEND_COUNT; i++)
+                MakeDelegate([&deliveredCount]() {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                    deliveredCount++;
+                }, timeoutThread)();
+        });
+        sender.join();
+
+        while (timeoutThread.GetQueueSize() != 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        ASSERT_TRUE(deliveredCount == SEND_COUNT);
+        timeoutThread.ExitThread();
+    }
+    std::cout << "LockFree_FullPolicy() complete!" << std::endl;
+}
+
+static void ThreadLockFreeQueueTests()
+{
+    LockFree_MultiProducer_DeliversAll();
+    LockFree_PriorityOrder();
+    LockFree_RingFull_ProducerResumes();
+    LockFree_FullPolicy();
+}
+
+// ---------------------------------------------------------------------------
+// Batch drain tests
+// ---------------------------------------------------------------------------
+
+// Batched messages are delivered in priority order and counted once each.
+static void BatchDrain_DeliversInPriorityOrder(QueueEngine engine)
+{
+    Thread batchThread("BatchThread", 0, FullPolicy::FAULT, dmq::DEFAULT_DISPATCH_TIMEOUT, "", engine);
+    batchThread.SetBatchSize(16);
+    ASSERT_TRUE(batchThread.GetBatchSize() == 16);
+    batchThread.CreateThread();
+
+    std::vector<int> order;
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+
+    // Block the consumer so the next messages are drained as one batch
+    MakeDelegate(std::function<void()>([gate]() { gate.wait(); }), batchThread)();
+    while (batchThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    auto record = std::function<void(int)>([&order](int v) { order.push_back(v); });
+    auto low = MakeDelegate(record, batchThread);
+    low.SetPriority(Priority::LOW);
+    auto high = MakeDelegate(record, batchThread);
+    high.SetPriority(Priority::HIGH);
+
+    const int SEND_COUNT = 40;
+    for (int i = 0; i < SEND_COUNT; i++)
+        (i % 2 ? high : low)(i);
+    release.set_value();
+
+    while (batchThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+#if defined(DMQ_DATABUS_TOOLS)
+    auto stats = batchThread.SnapshotStats();
+    ASSERT_TRUE(stats.dispatch_count == SEND_COUNT + 1);
+#endif
+    batchThread.ExitThread();
+
+    // The first batch holds 16 messages: all HIGH (odd) values must come first
+    ASSERT_TRUE(order.size() == SEND_COUNT);
+    for (int i = 0; i < 16; i++)
+        ASSERT_TRUE(order[i] % 2 == 1);
+    std::cout << "BatchDrain_DeliversInPriorityOrder() complete!" << std::endl;
+}
+
+// Messages drained into a batch but not yet run still count against maxQueueSize.
+static void BatchDrain_HonorsMaxQueueSize(QueueEngine engine)
+{
+    const size_t MAX_QUEUE = 4;
+    Thread batchThread("BatchBoundThread", MAX_QUEUE, FullPolicy::DROP, dmq::DEFAULT_DISPATCH_TIMEOUT, "", engine);
+    batchThread.SetBatchSize(MAX_QUEUE);
+    batchThread.CreateThread();
+
+    std::promise<void> release1, release2;
+    std::shared_future<void> gate1 = release1.get_future().share();
+    std::shared_future<void> gate2 = release2.get_future().share();
+    std::atomic<bool> started(false);
+    std::atomic<int> delivered(0);
+
+    // Block the consumer, then fill the queue
+    MakeDelegate(std::function<void()>([gate1]() { gate1.wait(); }), batchThread)();
+    while (batchThread.GetQueueSize() != 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    MakeDelegate(std::function<void()>([gate2, &started]() { started = true; gate2.wait(); }), batchThread)();
+    auto record = MakeDelegate(std::function<void(int)>([&delivered](int) { delivered++; }), batchThread);
+    for (size_t i = 1; i < MAX_QUEUE; i++)
+        record(0);
+
+    // The consumer drains all four as one batch and blocks in the first
+    release1.set_value();
+    while (!started)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // Three batch messages are still pending, so only one slot is free
+    for (size_t i = 0; i < MAX_QUEUE; i++)
+        record(1);
+    release2.set_value();
+
+    for (int i = 0; i < 500 && delivered < static_cast<int>(MAX_QUEUE); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    batchThread.ExitThread();
+
+    ASSERT_TRUE(delivered == static_cast<int>(MAX_QUEUE));
+    std::cout << "BatchDrain_HonorsMaxQueueSize() complete!" << std::endl;
+}
+
+// A thread that exits mid-batch and is created again keeps its full capacity.
+static void BatchDrain_ExitRestoresCapacity(QueueEngine engine)
+{
+    const size_t MAX_QUEUE = 4;
+    Thread batchThread("BatchExitThread", MAX_QUEUE, FullPolicy::DROP, dmq::DEFAULT_DISPATCH_TIMEOUT, "", engine);
+    batchThread.SetBatchSize(MAX_QUEUE);
+    batchThread.CreateThread();
+
+    std::atomic<int> delivered(0);
+    auto record = MakeDelegate(std::function<void(int)>([&delivered](int) { delivered++; }), batchThread);
+
+    // Block the consumer, queue two messages, then exit. The exit message is
+    // drained into the same batch as the two messages.
+    {
+        std::promise<void> release;
+        std::shared_future<void> gate = release.get_future().share();
+        MakeDelegate(std::function<void()>([gate]() { gate.wait(); }), batchThread)();
+        while (batchThread.GetQueueSize() != 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        record(0);
+        record(0);
+        std::thread exiter([&batchThread]() { batchThread.ExitThread(); });
+        while (batchThread.GetQueueSize() != 3)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        release.set_value();
+        exiter.join();
+    }
+
+    // After re-creating the thread, a blocked consumer accepts MAX_QUEUE messages
+    batchThread.CreateThread();
+    delivered = 0;
+    {
+        std::promise<void> release;
+        std::shared_future<void> gate = release.get_future().share();
+        MakeDelegate(std::function<void()>([gate]() { gate.wait(); }), batchThread)();
+        for (int i = 0; i < 500 && batchThread.GetQueueSize() != 0; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_TRUE(batchThread.GetQueueSize() == 0);
+        for (size_t i = 0; i < MAX_QUEUE; i++)
+            record(1);
+        release.set_value();
+    }
+
+    for (int i = 0; i < 500 && delivered < static_cast<int>(MAX_QUEUE); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    batchThread.ExitThread();
+
+    ASSERT_TRUE(delivered == static_cast<int>(MAX_QUEUE));
+    std::cout << "BatchDrain_ExitRestoresCapacity() complete!" << std::endl;
+}
+
+static void ThreadBatchDrainTests()
+{
+    BatchDrain_DeliversInPriorityOrder(QueueEngine::MUTEX);
+    BatchDrain_DeliversInPriorityOrder(QueueEngine::LOCK_FREE);
+    BatchDrain_HonorsMaxQueueSize(QueueEngine::MUTEX);
+    BatchDrain_HonorsMaxQueueSize(QueueEngine::LOCK_FREE);
+    BatchDrain_ExitRestoresCapacity(QueueEngine::MUTEX);
+    BatchDrain_ExitRestoresCapacity(QueueEngine::LOCK_FREE);
+}
+
 void DelegateThreadsTests()
 {
     workerThread1.CreateThread();
@@ -464,4 +770,6 @@ void DelegateThreadsTests()
     workerThread2.ExitThread();
 
     ThreadFullPolicyTests();
+    ThreadLockFreeQueueTests();
+    ThreadBatchDrainTests();
 }
\ No newline at end of file
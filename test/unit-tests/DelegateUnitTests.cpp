@@ -2581,8 +2581,15 @@ extern void ContainersTests();
 extern void RemoteChannelTests();
 extern void SerializeTests();
 extern void DispatcherTests();
+extern void WindowedTransportTests();
+extern void FragmentTransportTests();
+extern void ShmTransportTests();
+extern void LinuxUringTransportTests();
+extern void LinuxTcpTransportTests();
 extern void MonotonicGuardTests();
+extern void SemaphoreTests();
 extern void TimerDelegateTests();
+extern void ThreadPoolTests();
 #ifdef DMQ_ALLOCATOR
 extern void AllocatorTests();
 #endif
@@ -2602,8 +2609,15 @@ void RunDelegateUnitTests()
 		RemoteChannelTests();
 		SerializeTests();
 		DispatcherTests();
+		WindowedTransportTests();
+		FragmentTransportTests();
+		ShmTransportTests();
+		LinuxUringTransportTests();
+		LinuxTcpTransportTests();
 		MonotonicGuardTests();
+		SemaphoreTests();
 		TimerDelegateTests();
+		ThreadPoolTests();
 #ifdef DMQ_ALLOCATOR
 		AllocatorTests();
 #endif
@@ -0,0 +1,167 @@
+#include "DelegateMQ.h"
+#include "UnitTestCommon.h"
+#include "extras/util/FragmentTransport.h"
+#include "LoopbackLink.h"
+#include <chrono>
+#include <deque>
+#include <string>
+#include <thread>
+
+using namespace dmq;
+using namespace dmq::transport;
+using namespace dmq::util;
+using namespace LoopbackLink;
+
+namespace {
+    std::string MakePayload(size_t size, char seed) {
+        std::string s(size, '\0');
+        for (size_t i = 0; i < size; i++)
+            s[i] = static_cast<char>(seed + i * 7);
+        return s;
+    }
+
+    int SendPayload(FragmentTransport& transport, uint16_t id, const std::string& payload) {
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os.write(payload.data(), payload.size());
+        return transport.Send(os, DmqHeader(id, DmqHeader::GetNextSeqNum()));
+    }
+
+    // Drain everything queued for a transport; collect completed messages
+    void Drain(FragmentTransport& transport, std::deque<std::pair<DmqHeader, std::string>>& delivered) {
+        while (transport.HasPending()) {
+            xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+            DmqHeader header;
+            if (transport.Receive(is, header) == 0)
+                delivered.emplace_back(header, is.str());
+        }
+    }
+}
+
+void FragmentTransportTests()
+{
+    // Small messages pass through unfragmented
+    {
+        Link link;
+        FragmentTransport sender(link.a), receiver(link.b);
+        std::string payload = MakePayload(100, 'a');
+        ASSERT_TRUE(SendPayload(sender, 10, payload) == 0);
+        ASSERT_TRUE(link.a.sent == 1);
+        ASSERT_TRUE(link.aToB.front().header.GetId() == 10);
+
+        std::deque<std::pair<DmqHeader, std::string>> delivered;
+        Drain(receiver, delivered);
+        ASSERT_TRUE(delivered.size() == 1);
+        ASSERT_TRUE(delivered[0].second == payload);
+    }
+
+    // Large message split into MTU-sized fragments and reassembled, even out of order
+    {
+        Link link;
+        const size_t MTU = 512;
+        FragmentTransport sender(link.a, MTU), receiver(link.b, MTU);
+        std::string payload = MakePayload(100 * 1024, 'b');
+        DmqHeader header(11, 0x00012345);
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os.write(payload.data(), payload.size());
+        ASSERT_TRUE(sender.Send(os, header) == 0);
+        ASSERT_TRUE(link.a.sent > 200);
+        ASSERT_TRUE(link.a.largest <= MTU);
+        ASSERT_TRUE(link.aToB.front().header.GetId() == FRAGMENT_REMOTE_ID);
+
+        std::swap(link.aToB.front(), link.aToB.back());
+        std::deque<std::pair<DmqHeader, std::string>> delivered;
+        Drain(receiver, delivered);
+        ASSERT_TRUE(delivered.size() == 1);
+        ASSERT_TRUE(delivered[0].first.GetId() == 11);
+        ASSERT_TRUE(delivered[0].first.GetSeqNum32() == 0x00012345);
+        ASSERT_TRUE(delivered[0].first.GetLength() == payload.size());
+        ASSERT_TRUE(delivered[0].second == payload);
+    }
+
+    // Lost fragments: without retransmission the message times out
+    {
+        Link link;
+        int count = 0;
+        link.a.drop = [&](const DmqHeader&, const std::string&) { return ++count == 3; };
+        FragmentTransport sender(link.a), receiver(link.b, FragmentTransport::DEFAULT_MTU,
+            FragmentTransport::DEFAULT_MAX_MESSAGE_SIZE, std::chrono::milliseconds(10));
+        ASSERT_TRUE(SendPayload(sender, 12, MakePayload(10000, 'c')) == 0);
+
+        std::deque<std::pair<DmqHeader, std::string>> delivered;
+        Drain(receiver, delivered);
+        ASSERT_TRUE(delivered.empty());
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        receiver.Process();
+        ASSERT_TRUE(receiver.GetDroppedCount() == 1);
+    }
+
+    // Lost fragments: NACK resends only the missing ones
+    {
+        Link link;
+        int count = 0;
+        link.a.drop = [&](const DmqHeader&, const std::string&) { count++; return count == 2 || count == 5; };
+        FragmentTransport sender(link.a, FragmentTransport::DEFAULT_MTU, FragmentTransport::DEFAULT_MAX_MESSAGE_SIZE,
+            std::chrono::milliseconds(1000), true);
+        FragmentTransport receiver(link.b, FragmentTransport::DEFAULT_MTU, FragmentTransport::DEFAULT_MAX_MESSAGE_SIZE,
+            std::chrono::milliseconds(1000), true);
+        std::string payload = MakePayload(20000, 'd');
+        ASSERT_TRUE(SendPayload(sender, 13, payload) == 0);
+        const int firstSend = link.a.sent;
+
+        std::deque<std::pair<DmqHeader, std::string>> delivered;
+        for (int i = 0; i < 100 && delivered.empty(); i++) {
+            Drain(receiver, delivered);
+            receiver.Process();
+            std::deque<std::pair<DmqHeader, std::string>> none;
+            Drain(sender, none);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        ASSERT_TRUE(delivered.size() == 1);
+        ASSERT_TRUE(delivered[0].second == payload);
+        ASSERT_TRUE(link.a.sent == firstSend + 2);
+        ASSERT_TRUE(receiver.GetDroppedCount() == 0);
+    }
+
+    // Peers with different MTUs interoperate
+    {
+        Link link;
+        FragmentTransport sender(link.a, 512), receiver(link.b);
+        std::string payload = MakePayload(10000, 'f');
+        ASSERT_TRUE(SendPayload(sender, 15, payload) == 0);
+        std::deque<std::pair<DmqHeader, std::string>> delivered;
+        Drain(receiver, delivered);
+        ASSERT_TRUE(delivered.size() == 1);
+        ASSERT_TRUE(delivered[0].second == payload);
+    }
+
+    // Fragments with overlapping or misplaced offsets are rejected
+    {
+        Link link;
+        const size_t MTU = 512;
+        FragmentTransport sender(link.a, MTU), receiver(link.b, MTU);
+        ASSERT_TRUE(SendPayload(sender, 16, MakePayload(10000, 'g')) == 0);
+        ASSERT_TRUE(link.aToB.size() > 3);
+
+        // Fragment offset is a big-endian field at byte 12 of the fragment header
+        auto setOffset = [](Packet& p, uint32_t offset) {
+            for (int i = 0; i < 4; i++)
+                p.data[12 + i] = static_cast<char>(offset >> (8 * (3 - i)));
+        };
+        setOffset(link.aToB[1], 1);
+        setOffset(link.aToB.back(), 0);
+
+        std::deque<std::pair<DmqHeader, std::string>> delivered;
+        Drain(receiver, delivered);
+        ASSERT_TRUE(delivered.empty());
+    }
+
+    // Messages larger than the receiver's buffer are ignored
+    {
+        Link link;
+        FragmentTransport sender(link.a), receiver(link.b, FragmentTransport::DEFAULT_MTU, 4096);
+        ASSERT_TRUE(SendPayload(sender, 14, MakePayload(8192, 'e')) == 0);
+        std::deque<std::pair<DmqHeader, std::string>> delivered;
+        Drain(receiver, delivered);
+        ASSERT_TRUE(delivered.empty());
+    }
+}
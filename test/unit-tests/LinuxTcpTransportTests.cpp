@@ -0,0 +1,331 @@
+#include "DelegateMQ.h"
+#include "UnitTestCommon.h"
+
+#if defined(__linux__)
+#include "port/transport/linux-tcp/LinuxTcpTransport.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace dmq;
+using namespace dmq::transport;
+
+namespace {
+    const uint16_t TEST_PORT = 51740;
+    const uint16_t TEST_ID = 100;
+
+    // Create a SERVER that does not send ACKs, so clients see only broadcast frames
+    bool CreateServer(TcpTransport& server) {
+        if (server.Create(TcpTransport::Type::SERVER, "127.0.0.1", TEST_PORT) != 0)
+            return false;
+        server.SetSendTransport(nullptr);
+        return true;
+    }
+
+    // Connect a raw client socket. A non-zero rcvBuf shrinks its receive buffer.
+    int ConnectClient(int rcvBuf = 0) {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (rcvBuf > 0)
+            setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvBuf, sizeof(rcvBuf));
+        struct timeval tv = { 2, 0 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(TEST_PORT);
+        inet_aton("127.0.0.1", &addr.sin_addr);
+        if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    // Encode a frame whose payload starts with value
+    std::vector<uint8_t> MakeFrame(int value, size_t payloadSize = sizeof(int)) {
+        std::vector<uint8_t> frame(DmqHeader::HEADER_SIZE + payloadSize, 0);
+        WriteHeader(DmqHeader(TEST_ID, DmqHeader::GetNextSeqNum(), static_cast<uint32_t>(payloadSize)), frame.data());
+        memcpy(frame.data() + DmqHeader::HEADER_SIZE, &value, sizeof(value));
+        return frame;
+    }
+
+    bool WriteAll(int fd, const uint8_t* data, size_t size) {
+        while (size > 0) {
+            ssize_t n = send(fd, data, size, MSG_NOSIGNAL);
+            if (n <= 0) return false;
+            data += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    // Read exactly size bytes. Returns the bytes read; fewer on EOF or timeout.
+    size_t ReadAll(int fd, uint8_t* data, size_t size) {
+        size_t total = 0;
+        while (total < size) {
+            ssize_t n = read(fd, data + total, size - total);
+            if (n <= 0) break;
+            total += static_cast<size_t>(n);
+        }
+        return total;
+    }
+
+    // Read one broadcast frame from a raw client. Returns the payload value, or -1.
+    int ReadFrame(int fd) {
+        uint8_t headerBytes[DmqHeader::HEADER_SIZE];
+        if (ReadAll(fd, headerBytes, sizeof(headerBytes)) != sizeof(headerBytes))
+            return -1;
+        DmqHeader header;
+        if (ReadHeader(headerBytes, sizeof(headerBytes), header) != DmqHeader::HEADER_SIZE ||
+            header.GetId() != TEST_ID)
+            return -1;
+        std::vector<uint8_t> payload(header.GetLength());
+        if (ReadAll(fd, payload.data(), payload.size()) != payload.size() || payload.size() < sizeof(int))
+            return -1;
+        int value = -1;
+        memcpy(&value, payload.data(), sizeof(value));
+        return value;
+    }
+
+    int BroadcastInt(TcpTransport& server, int value, size_t payloadSize = sizeof(int)) {
+        std::vector<char> payload(payloadSize, 0);
+        memcpy(payload.data(), &value, sizeof(value));
+        TransportBuffer buffer{ payload.data(), payload.size() };
+        return server.SendBuffers(DmqHeader(TEST_ID, DmqHeader::GetNextSeqNum()), &buffer, 1);
+    }
+
+    // Receive on the server until a frame arrives or the timeout. Returns the
+    // payload value, or -1.
+    int ServerReceiveInt(TcpTransport& server, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+            DmqHeader header;
+            if (server.Receive(is, header) != 0)
+                continue;
+            if (header.GetId() != TEST_ID)
+                return -1;
+            int value = -1;
+            is.read(reinterpret_cast<char*>(&value), sizeof(value));
+            return value;
+        }
+        return -1;
+    }
+}
+
+void LinuxTcpTransportTests()
+{
+    // A frame split across several reads is reassembled
+    {
+        TcpTransport server;
+        ASSERT_TRUE(CreateServer(server));
+        int client = ConnectClient();
+        ASSERT_TRUE(client >= 0);
+
+        std::vector<uint8_t> frame = MakeFrame(7);
+        ASSERT_TRUE(WriteAll(client, frame.data(), 3));
+        ASSERT_TRUE(ServerReceiveInt(server, std::chrono::milliseconds(50)) == -1);
+        ASSERT_TRUE(WriteAll(client, frame.data() + 3, DmqHeader::HEADER_SIZE + 1 - 3));
+        ASSERT_TRUE(ServerReceiveInt(server, std::chrono::milliseconds(50)) == -1);
+        ASSERT_TRUE(WriteAll(client, frame.data() + DmqHeader::HEADER_SIZE + 1, frame.size() - DmqHeader::HEADER_SIZE - 1));
+        ASSERT_TRUE(ServerReceiveInt(server) == 7);
+        close(client);
+    }
+
+    // Bytes ahead of a valid marker are discarded and the next frame is found
+    {
+        TcpTransport server;
+        ASSERT_TRUE(CreateServer(server));
+        int client = ConnectClient();
+        ASSERT_TRUE(client >= 0);
+
+        const uint8_t garbage[] = { 0x01, 0xAA, 0x02, 0x55, 0xAA, 0x13, 'x', 'y', 'z', 0x00, 0xFF };
+        ASSERT_TRUE(WriteAll(client, garbage, sizeof(garbage)));
+        std::vector<uint8_t> frame = MakeFrame(8);
+        ASSERT_TRUE(WriteAll(client, frame.data(), frame.size()));
+        frame = MakeFrame(9);
+        ASSERT_TRUE(WriteAll(client, frame.data(), frame.size()));
+        ASSERT_TRUE(ServerReceiveInt(server) == 8);
+        ASSERT_TRUE(ServerReceiveInt(server) == 9);
+        close(client);
+    }
+
+    // Several clients send to the server and each receives the broadcast
+    {
+        TcpTransport server;
+        ASSERT_TRUE(CreateServer(server));
+        const int CLIENTS = 3;
+        int clients[CLIENTS];
+        for (int i = 0; i < CLIENTS; i++) {
+            clients[i] = ConnectClient();
+            ASSERT_TRUE(clients[i] >= 0);
+            std::vector<uint8_t> frame = MakeFrame(i + 1);
+            ASSERT_TRUE(WriteAll(clients[i], frame.data(), frame.size()));
+        }
+
+        std::set<int> values;
+        for (int i = 0; i < CLIENTS; i++)
+            values.insert(ServerReceiveInt(server));
+        ASSERT_TRUE(values == std::set<int>({ 1, 2, 3 }));
+
+        ASSERT_TRUE(BroadcastInt(server, 100) == 0);
+        for (int i = 0; i < CLIENTS; i++) {
+            ASSERT_TRUE(ReadFrame(clients[i]) == 100);
+            close(clients[i]);
+        }
+    }
+
+    // A client that stops reading is shut down at a frame it cannot take whole.
+    // The other client receives every frame, and the stalled client's stream ends
+    // instead of continuing after a partial frame.
+    {
+        TcpTransport server;
+        ASSERT_TRUE(CreateServer(server));
+        server.SetSendTimeout(std::chrono::milliseconds(200));
+        int reader = ConnectClient();
+        int stalled = ConnectClient(4096);
+        ASSERT_TRUE(reader >= 0 && stalled >= 0);
+        ASSERT_TRUE(ServerReceiveInt(server, std::chrono::milliseconds(50)) == -1);  // Accept
+
+        const int COUNT = 400;
+        const size_t PAYLOAD = 32 * 1024;
+        std::atomic<int> readCount(0);
+        std::thread readerThread([&]() {
+            for (int i = 0; i < COUNT; i++) {
+                if (ReadFrame(reader) != i)
+                    return;
+                readCount++;
+            }
+        });
+
+        int failed = 0;
+        for (int i = 0; i < COUNT; i++) {
+            if (BroadcastInt(server, i, PAYLOAD) != 0)
+                failed++;
+        }
+        readerThread.join();
+        ASSERT_TRUE(readCount == COUNT);
+        ASSERT_TRUE(failed > 0);
+
+        // Whole frames in order, at most one partial frame, then end of stream
+        std::vector<uint8_t> frame(DmqHeader::HEADER_SIZE + PAYLOAD);
+        int expected = 0;
+        for (;;) {
+            size_t n = ReadAll(stalled, frame.data(), frame.size());
+            if (n < frame.size())
+                break;
+            int value = -1;
+            memcpy(&value, frame.data() + DmqHeader::HEADER_SIZE, sizeof(value));
+            ASSERT_TRUE(value == expected);
+            expected++;
+        }
+        uint8_t byte;
+        ASSERT_TRUE(read(stalled, &byte, 1) == 0);
+        ASSERT_TRUE(expected < COUNT);
+
+        close(reader);
+        close(stalled);
+    }
+
+    // A client disconnecting while the server broadcasts and receives concurrently
+    // does not disturb the remaining client
+    {
+        TcpTransport server;
+        ASSERT_TRUE(CreateServer(server));
+        int reader = ConnectClient();
+        int leaving = ConnectClient();
+        ASSERT_TRUE(reader >= 0 && leaving >= 0);
+        ASSERT_TRUE(ServerReceiveInt(server, std::chrono::milliseconds(50)) == -1);  // Accept
+
+        std::atomic<bool> stop(false);
+        std::thread receiveThread([&]() {
+            while (!stop)
+                ServerReceiveInt(server, std::chrono::milliseconds(10));
+        });
+
+        const int COUNT = 2000;
+        std::atomic<int> readCount(0);
+        std::thread readerThread([&]() {
+            for (int i = 0; i < COUNT; i++) {
+                if (ReadFrame(reader) != i)
+                    return;
+                readCount++;
+            }
+        });
+        std::thread leavingThread([&]() {
+            for (int i = 0; i < 100; i++)
+                ReadFrame(leaving);
+            close(leaving);
+        });
+
+        for (int i = 0; i < COUNT; i++)
+            BroadcastInt(server, i, 1024);
+        leavingThread.join();
+        readerThread.join();
+        ASSERT_TRUE(readCount == COUNT);
+
+        // Let the receive thread remove the departed client
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        stop = true;
+        receiveThread.join();
+        ASSERT_TRUE(BroadcastInt(server, COUNT) == 0);
+        ASSERT_TRUE(ReadFrame(reader) == COUNT);
+        close(reader);
+    }
+
+    // The monitor and ACK use the sequence number as sent: all 32 bits with an
+    // extended header, the low 16 bits with a standard header
+    {
+        TcpTransport server;
+        ASSERT_TRUE(server.Create(TcpTransport::Type::SERVER, "127.0.0.1", TEST_PORT) == 0);
+        TcpTransport client;
+        ASSERT_TRUE(client.Create(TcpTransport::Type::CLIENT, "127.0.0.1", TEST_PORT) == 0);
+        dmq::util::TransportMonitor monitor(std::chrono::seconds(5));
+        client.SetTransportMonitor(&monitor);
+
+        std::vector<uint32_t> acked;
+        ScopedConnection conn = monitor.OnSendStatus.Connect(MakeDelegate(
+            std::function<void(DelegateRemoteId, uint32_t, dmq::util::TransportMonitor::Status)>(
+                [&acked](DelegateRemoteId, uint32_t seqNum, dmq::util::TransportMonitor::Status status) {
+                    if (status == dmq::util::TransportMonitor::Status::SUCCESS)
+                        acked.push_back(seqNum);
+                })));
+
+        auto sendAndAck = [&](uint32_t seqNum) {
+            xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+            int value = 1;
+            os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            if (client.Send(os, DmqHeader(TEST_ID, seqNum)) != 0)
+                return false;
+            if (ServerReceiveInt(server) != 1)
+                return false;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (acked.empty() && std::chrono::steady_clock::now() < deadline) {
+                xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+                DmqHeader header;
+                client.Receive(is, header);
+            }
+            return !acked.empty();
+        };
+
+        client.SetExtendedHeader(true);
+        ASSERT_TRUE(sendAndAck(0x12345));
+        ASSERT_TRUE(acked.size() == 1 && acked[0] == 0x12345);
+
+        acked.clear();
+        client.SetExtendedHeader(false);
+        ASSERT_TRUE(sendAndAck(0x12346));
+        ASSERT_TRUE(acked.size() == 1 && acked[0] == 0x2346);
+    }
+
+    std::cout << "LinuxTcpTransportTests() complete!" << std::endl;
+}
+
+#else
+void LinuxTcpTransportTests() {}
+#endif
@@ -0,0 +1,197 @@
+#include "DelegateMQ.h"
+#include "UnitTestCommon.h"
+
+#if defined(__linux__)
+#include "port/transport/linux-uring/LinuxUringTransport.h"
+#include "port/transport/linux-udp/LinuxUdpTransport.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace dmq;
+using namespace dmq::transport;
+
+namespace {
+    const uint16_t TEST_PORT = 51730;
+    const uint16_t FALLBACK_PORT = 51731;
+    const uint16_t TEST_ID = 100;
+
+    int SendInt(ITransport& transport, int value) {
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        return transport.Send(os, DmqHeader(TEST_ID, DmqHeader::GetNextSeqNum()));
+    }
+
+    // Receive until the transport times out. Returns the number of datagrams received.
+    int ReceiveAll(LinuxUringTransport& transport) {
+        int received = 0;
+        for (;;) {
+            xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+            DmqHeader header;
+            if (transport.Receive(is, header) != 0)
+                return received;
+            if (header.GetId() == TEST_ID)
+                received++;
+        }
+    }
+
+    // Receive until the transport times out. Returns true if exactly the values
+    // first..first+count-1 arrived, in order.
+    bool ReceiveSequence(LinuxUringTransport& transport, int first, int count) {
+        int expected = first;
+        for (;;) {
+            xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+            DmqHeader header;
+            if (transport.Receive(is, header) != 0)
+                return expected == first + count;
+            int value = -1;
+            is.read(reinterpret_cast<char*>(&value), sizeof(value));
+            if (header.GetId() != TEST_ID || value != expected)
+                return false;
+            expected++;
+        }
+    }
+
+    // Receive one datagram from any transport. Returns the payload value, or -1.
+    int ReceiveInt(ITransport& transport) {
+        xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+        DmqHeader header;
+        if (transport.Receive(is, header) != 0 || header.GetId() != TEST_ID)
+            return -1;
+        int value = -1;
+        is.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+
+    // A transport whose Create() failed must stay inert, and LinuxUdpTransport
+    // must interoperate with LinuxUringTransport so either end can fall back to it.
+    void FallbackTests(bool uringAvailable)
+    {
+        // Create() failure (port already bound) leaves the transport closed
+        {
+            LinuxUdpTransport owner;
+            ASSERT_TRUE(owner.Create(LinuxUdpTransport::Type::SUB, "127.0.0.1", FALLBACK_PORT) == 0);
+
+            LinuxUringTransport failed;
+            ASSERT_TRUE(failed.Create(LinuxUringTransport::Type::SUB, "127.0.0.1", FALLBACK_PORT) != 0);
+            failed.SetRecvTimeout(std::chrono::milliseconds(10));
+            xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+            DmqHeader header;
+            ASSERT_TRUE(failed.Receive(is, header) != 0);
+            failed.Close();
+            failed.Close();
+        }
+
+        if (!uringAvailable)
+            return;
+
+        // io_uring sender, stdlib socket receiver
+        {
+            LinuxUdpTransport rx;
+            LinuxUringTransport tx;
+            ASSERT_TRUE(rx.Create(LinuxUdpTransport::Type::SUB, "127.0.0.1", FALLBACK_PORT) == 0);
+            ASSERT_TRUE(tx.Create(LinuxUringTransport::Type::PUB, "127.0.0.1", FALLBACK_PORT) == 0);
+            ASSERT_TRUE(SendInt(tx, 7) == 0);
+            ASSERT_TRUE(ReceiveInt(rx) == 7);
+        }
+
+        // stdlib socket sender, io_uring receiver
+        {
+            LinuxUringTransport rx;
+            LinuxUdpTransport tx;
+            ASSERT_TRUE(rx.Create(LinuxUringTransport::Type::SUB, "127.0.0.1", FALLBACK_PORT) == 0);
+            ASSERT_TRUE(tx.Create(LinuxUdpTransport::Type::PUB, "127.0.0.1", FALLBACK_PORT) == 0);
+            rx.SetRecvTimeout(std::chrono::milliseconds(200));
+            ASSERT_TRUE(SendInt(tx, 8) == 0);
+            ASSERT_TRUE(ReceiveInt(rx) == 8);
+        }
+    }
+}
+
+void LinuxUringTransportTests()
+{
+    LinuxUringTransport rx, tx;
+    if (rx.Create(LinuxUringTransport::Type::SUB, "127.0.0.1", TEST_PORT) != 0 ||
+        tx.Create(LinuxUringTransport::Type::PUB, "127.0.0.1", TEST_PORT) != 0)
+    {
+        // io_uring unavailable or restricted on this host
+        rx.Close();
+        FallbackTests(false);
+        std::cout << "LinuxUringTransportTests() skipped!" << std::endl;
+        return;
+    }
+    rx.SetRecvTimeout(std::chrono::milliseconds(200));
+
+    // Send and receive
+    {
+        ASSERT_TRUE(SendInt(tx, 1) == 0);
+        xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+        DmqHeader header;
+        ASSERT_TRUE(rx.Receive(is, header) == 0);
+        ASSERT_TRUE(header.GetId() == TEST_ID);
+        int value = 0;
+        is.read(reinterpret_cast<char*>(&value), sizeof(value));
+        ASSERT_TRUE(value == 1);
+    }
+
+    // One multishot request receives a burst of datagrams in order
+    {
+        const int BURST = 100;
+        for (int i = 0; i < BURST; i++)
+            ASSERT_TRUE(SendInt(tx, i) == 0);
+        ASSERT_TRUE(ReceiveSequence(rx, 0, BURST));
+    }
+
+    // Buffers handed back with PROVIDE_BUFFERS are reused: several times the pool
+    // size passes through in rounds that each fit in the pool
+    {
+        const int ROUND = 64;
+        for (int round = 0; round < 16; round++) {
+            for (int i = 0; i < ROUND; i++)
+                ASSERT_TRUE(SendInt(tx, round * ROUND + i) == 0);
+            ASSERT_TRUE(ReceiveSequence(rx, round * ROUND, ROUND));
+        }
+    }
+
+    // A buffer viewed in place is handed back on the next receive call
+    {
+        const int COUNT = 600;
+        for (int i = 0; i < COUNT; i++) {
+            ASSERT_TRUE(SendInt(tx, i) == 0);
+            TransportBuffer payload;
+            DmqHeader header;
+            ASSERT_TRUE(rx.ReceiveView(payload, header) == 0);
+            int value = -1;
+            ASSERT_TRUE(payload.size == sizeof(value));
+            memcpy(&value, payload.data, sizeof(value));
+            ASSERT_TRUE(value == i);
+        }
+    }
+
+    // A burst larger than the provided buffer pool terminates the multishot receive.
+    // Reception re-arms and resumes once the buffers are handed back.
+    {
+        const int BURST = 300;
+        for (int i = 0; i < BURST; i++)
+            ASSERT_TRUE(SendInt(tx, i) == 0);
+        ASSERT_TRUE(ReceiveAll(rx) >= 256);
+
+        for (int round = 0; round < 3; round++) {
+            const int COUNT = 10;
+            for (int i = 0; i < COUNT; i++)
+                ASSERT_TRUE(SendInt(tx, i) == 0);
+            ASSERT_TRUE(ReceiveAll(rx) == COUNT);
+        }
+    }
+
+    ASSERT_TRUE(tx.GetSendErrors() == 0);
+    rx.Close();
+    tx.Close();
+
+    FallbackTests(true);
+    std::cout << "LinuxUringTransportTests() complete!" << std::endl;
+}
+
+#else
+void LinuxUringTransportTests() {}
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "DelegateMQ.h"
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <string>
+
+/// In-memory datagram link for transport decorator tests. Each LinkEnd is an
+/// ITransport that queues sent packets for the other end, with optional loss.
+namespace LoopbackLink
+{
+    struct Packet {
+        dmq::transport::DmqHeader header;
+        std::string data;
+    };
+
+    // One direction of the link
+    class LinkEnd : public dmq::transport::ITransport {
+    public:
+        LinkEnd(std::deque<Packet>& out, std::deque<Packet>& in) : m_out(out), m_in(in) {}
+
+        // Return true to drop the outgoing packet
+        std::function<bool(const dmq::transport::DmqHeader&, const std::string&)> drop;
+        int sent = 0;           // All packets, including dropped ones
+        int dataSent = 0;       // Non-ACK packets
+        int acksSent = 0;       // ACK packets
+        size_t largest = 0;     // Largest packet, header included
+
+        int Send(dmq::xostringstream& os, const dmq::transport::DmqHeader& header) override {
+            dmq::transport::TransportBuffer payload = dmq::transport::GetStreamBuffer(os);
+            return SendBuffers(header, &payload, 1);
+        }
+        int SendBuffers(const dmq::transport::DmqHeader& header,
+            const dmq::transport::TransportBuffer* buffers, size_t count) override {
+            Packet p{ header, std::string() };
+            for (size_t i = 0; i < count; i++)
+                p.data.append(static_cast<const char*>(buffers[i].data), buffers[i].size);
+            sent++;
+            (header.GetId() == dmq::ACK_REMOTE_ID ? acksSent : dataSent)++;
+            largest = (std::max)(largest, dmq::transport::DmqHeader::HEADER_SIZE + p.data.size());
+            if (drop && drop(header, p.data))
+                return 0;
+            m_out.push_back(p);
+            return 0;
+        }
+        int Receive(dmq::xstringstream& is, dmq::transport::DmqHeader& header) override {
+            if (m_in.empty())
+                return -1;
+            Packet p = m_in.front();
+            m_in.pop_front();
+            header = p.header;
+            is.write(p.data.data(), p.data.size());
+            return 0;
+        }
+        bool HasPending() const override { return !m_in.empty(); }
+
+    private:
+        std::deque<Packet>& m_out;
+        std::deque<Packet>& m_in;
+    };
+
+    struct Link {
+        std::deque<Packet> aToB, bToA;
+        LinkEnd a{ aToB, bToA };
+        LinkEnd b{ bToA, aToB };
+    };
+}
@@ -3,6 +3,10 @@
 #include "UnitTestCommon.h"
 #include <iostream>
 #include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace dmq;
 using namespace dmq::transport;
@@ -137,6 +141,29 @@ namespace RemoteChannelTest
         }
     };
 
+    /// Writes a count then each value. Read() clears the vector and refills it,
+    /// so a reused vector keeps its capacity.
+    class VectorSerializer : public ISerializer<void(std::vector<int>&)> {
+    public:
+        std::ostream& Write(std::ostream& os, std::vector<int>& v) override {
+            os << v.size() << "\n";
+            for (int i : v)
+                os << i << "\n";
+            return os;
+        }
+        std::istream& Read(std::istream& is, std::vector<int>& v) override {
+            size_t size = 0;
+            is >> size;
+            v.clear();
+            for (size_t i = 0; i < size && is >> std::ws; i++) {
+                int value = 0;
+                is >> value;
+                v.push_back(value);
+            }
+            return is;
+        }
+    };
+
     // ---- mock transport --------------------------------------------------------
 
     /// Captures the serialized payload written by Dispatcher::Dispatch so
@@ -284,6 +311,30 @@ static void RemoteChannel_RoundTrip_FreeFunc_Int()
     ASSERT_TRUE(g_lastInt == TEST_INT);
 }
 
+static void RemoteChannel_RoundTrip_ByteBuffer()
+{
+    MockTransport transport;
+    RCSerializer<void(int, int)> serializer;
+    RemoteChannel<void(int, int)> channel(transport, serializer);
+
+    // Sender serializes into the channel's reusable byte buffer
+    auto sender = MakeDelegate(&FreeFuncTwoArgs, REMOTE_ID, channel);
+    sender(TEST_INT, TEST_INT + 1);
+    ASSERT_TRUE(transport.m_sendCount == 1);
+    ASSERT_TRUE(channel.GetBuffer().Size() == transport.m_payload.size());
+
+    // Receiver invokes from a byte buffer
+    DelegateFreeRemote<void(int, int)> receiver(&FreeFuncTwoArgs, REMOTE_ID);
+    receiver.SetSerializer(&serializer);
+
+    ByteBuffer recvBuffer;
+    recvBuffer.Assign(transport.m_payload.data(), transport.m_payload.size());
+    g_invoked = false;
+    ASSERT_TRUE(receiver.InvokeBuffer(recvBuffer));
+    ASSERT_TRUE(g_invoked);
+    ASSERT_TRUE(receiver.GetError() == DelegateError::SUCCESS);
+}
+
 static void RemoteChannel_RoundTrip_FreeFunc_IntRef()
 {
     MockTransport transport;
@@ -554,6 +605,101 @@ static void RemoteChannel_Bind_RawLambda()
     ASSERT_TRUE(g_invoked);
 }
 
+// ---- Reused receive-side argument storage --------------------------------------
+
+static void RemoteChannel_ReuseArgs()
+{
+    MockTransport transport;
+    VectorSerializer serializer;
+    RemoteChannel<void(std::vector<int>&)> sender(transport, serializer);
+    RemoteChannel<void(std::vector<int>&)> receiver(transport, serializer);
+
+    std::vector<int> received;
+    std::vector<const int*> storage;
+    receiver.Bind([&](std::vector<int>& v) {
+        received = v;
+        storage.push_back(v.data());
+    }, REMOTE_ID);
+    receiver.SetReuseArgs(true);
+
+    auto send = [&](std::vector<int> v) {
+        sender(v);
+        return transport.m_payload;
+    };
+    auto receive = [&](const std::string& payload) {
+        std::stringstream recvStream(payload, std::ios::in | std::ios::out | std::ios::binary);
+        return receiver.GetEndpoint()->Invoke(recvStream);
+    };
+
+    // Same storage for every message; a smaller message keeps the capacity
+    const std::vector<int> big(100, TEST_INT), small{ 1, 2, 3 };
+    const std::string bigPayload = send(big);
+    const std::string smallPayload = send(small);
+    ASSERT_TRUE(receive(bigPayload));
+    ASSERT_TRUE(received == big);
+    ASSERT_TRUE(receive(smallPayload));
+    ASSERT_TRUE(received == small);
+    ASSERT_TRUE(receive(bigPayload));
+    ASSERT_TRUE(received == big);
+    ASSERT_TRUE(storage.size() == 3 && storage[0] == storage[1] && storage[1] == storage[2]);
+    ASSERT_TRUE(receiver.GetError() == DelegateError::SUCCESS);
+
+    // A re-entrant invoke gets its own arguments
+    std::vector<int> seen;
+    bool reentered = false;
+    receiver.Bind([&](std::vector<int>& v) {
+        if (!reentered) {
+            reentered = true;
+            receive(bigPayload);
+        }
+        seen.insert(seen.end(), v.begin(), v.end());
+    }, REMOTE_ID);
+    ASSERT_TRUE(receive(smallPayload));
+    ASSERT_TRUE(seen.size() == big.size() + small.size());
+    ASSERT_TRUE(std::equal(small.begin(), small.end(), seen.end() - small.size()));
+
+    // Concurrent invokes on one receiver never share the argument storage
+    const std::vector<int> other(50, 7);
+    const std::string otherPayload = send(other);
+    std::atomic<int> corrupt{ 0 };
+    receiver.Bind([&](std::vector<int>& v) {
+        if (v != big && v != other)
+            corrupt++;
+    }, REMOTE_ID);
+    auto receiveLoop = [&](const std::string& payload) {
+        for (int i = 0; i < 20000; i++)
+            receive(payload);
+    };
+    std::thread t1(receiveLoop, bigPayload);
+    std::thread t2(receiveLoop, otherPayload);
+    t1.join();
+    t2.join();
+    ASSERT_TRUE(corrupt == 0);
+
+    // Copies and move assignment keep the reuse setting. A reused vector keeps the
+    // capacity of the big message when the small one is received into it.
+    using Remote = DelegateFunctionRemote<void(std::vector<int>&)>;
+    size_t capacity = 0;
+    auto keepsCapacity = [&](Remote& remote) {
+        remote.SetSerializer(&serializer);
+        std::stringstream bigStream(bigPayload, std::ios::in | std::ios::out | std::ios::binary);
+        std::stringstream smallStream(smallPayload, std::ios::in | std::ios::out | std::ios::binary);
+        remote.Invoke(bigStream);
+        remote.Invoke(smallStream);
+        return capacity >= big.size();
+    };
+    Remote original([&](std::vector<int>& v) { capacity = v.capacity(); }, REMOTE_ID);
+    original.SetReuseArgs(true);
+    Remote copied(original);
+    ASSERT_TRUE(keepsCapacity(copied));
+    Remote assigned;
+    assigned = original;
+    ASSERT_TRUE(keepsCapacity(assigned));
+    Remote moved;
+    moved = std::move(assigned);
+    ASSERT_TRUE(keepsCapacity(moved));
+}
+
 // ---- Entry point ---------------------------------------------------------------
 
 void RemoteChannelTests()
@@ -568,6 +714,7 @@ void RemoteChannelTests()
     RemoteChannel_MakeDelegate_RawLambda();
 
     RemoteChannel_RoundTrip_FreeFunc_Int();
+    RemoteChannel_RoundTrip_ByteBuffer();
     RemoteChannel_RoundTrip_FreeFunc_IntRef();
     RemoteChannel_RoundTrip_FreeFunc_IntPtr();
     RemoteChannel_RoundTrip_FreeFunc_RemoteData();
@@ -579,4 +726,5 @@ void RemoteChannelTests()
     RemoteChannel_DispatchError_PropagatedToErrorHandler();
     RemoteChannel_MakeDelegate_MatchesManualWiring();
     RemoteChannel_Bind_RawLambda();
+    RemoteChannel_ReuseArgs();
 }
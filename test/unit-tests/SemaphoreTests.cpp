@@ -0,0 +1,134 @@
+#include "DelegateMQ.h"
+#include "UnitTestCommon.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#ifdef DMQ_HAS_CV
+
+using namespace dmq;
+using namespace std::chrono;
+
+// ---- Behavior shared by every semaphore implementation ----
+
+template <class Sema>
+static void Semaphore_SignalBeforeWait(const char* name)
+{
+    Sema sema;
+    sema.Signal();
+    ASSERT_TRUE(sema.Wait(milliseconds(0)));
+    ASSERT_TRUE(!sema.Wait(milliseconds(0)));
+
+    // Binary: repeated signals do not accumulate
+    sema.Signal();
+    sema.Signal();
+    ASSERT_TRUE(sema.Wait(milliseconds(0)));
+    ASSERT_TRUE(!sema.Wait(milliseconds(0)));
+    std::cout << "Semaphore_SignalBeforeWait<" << name << ">() complete!" << std::endl;
+}
+
+template <class Sema>
+static void Semaphore_Timeout(const char* name)
+{
+    Sema sema;
+    auto start = steady_clock::now();
+    ASSERT_TRUE(!sema.Wait(milliseconds(20)));
+    ASSERT_TRUE(steady_clock::now() - start >= milliseconds(15));
+
+    // A timed out waiter does not consume a later signal
+    sema.Signal();
+    ASSERT_TRUE(sema.Wait(milliseconds(0)));
+    std::cout << "Semaphore_Timeout<" << name << ">() complete!" << std::endl;
+}
+
+template <class Sema>
+static void Semaphore_WakeBlockedWaiter(const char* name)
+{
+    Sema sema;
+    std::atomic<bool> woke{ false };
+    std::thread waiter([&]() {
+        woke = sema.Wait(Duration::max());
+    });
+    std::this_thread::sleep_for(milliseconds(10));
+    ASSERT_TRUE(!woke);
+    sema.Signal();
+    waiter.join();
+    ASSERT_TRUE(woke);
+    std::cout << "Semaphore_WakeBlockedWaiter<" << name << ">() complete!" << std::endl;
+}
+
+template <class Sema>
+static void Semaphore_PingPong(const char* name)
+{
+    // Every signal is observed exactly once by the other thread
+    Sema ping, pong;
+    const int COUNT = 20000;
+    std::atomic<int> errors{ 0 };
+    std::thread peer([&]() {
+        for (int i = 0; i < COUNT; i++) {
+            if (!ping.Wait(seconds(5)))
+                errors++;
+            pong.Signal();
+        }
+    });
+    for (int i = 0; i < COUNT; i++) {
+        ping.Signal();
+        if (!pong.Wait(seconds(5)))
+            errors++;
+    }
+    peer.join();
+    ASSERT_TRUE(errors == 0);
+    ASSERT_TRUE(!ping.Wait(milliseconds(0)) && !pong.Wait(milliseconds(0)));
+    std::cout << "Semaphore_PingPong<" << name << ">() complete!" << std::endl;
+}
+
+template <class Sema>
+static void Semaphore_TimedWaiterRace(const char* name)
+{
+    // Short timeouts racing signals never lose or duplicate a signal
+    Sema sema;
+    const int COUNT = 2000;
+    std::atomic<int> signaled{ 0 };
+    std::atomic<bool> done{ false };
+    std::atomic<int> received{ 0 };
+    std::thread signaler([&]() {
+        for (int i = 0; i < COUNT; i++) {
+            while (signaled != received && !done)
+                std::this_thread::yield();
+            signaled++;
+            sema.Signal();
+        }
+    });
+    while (received < COUNT) {
+        if (sema.Wait(microseconds(50)))
+            received++;
+    }
+    done = true;
+    signaler.join();
+    ASSERT_TRUE(received == COUNT && signaled == COUNT);
+    ASSERT_TRUE(!sema.Wait(milliseconds(0)));
+    std::cout << "Semaphore_TimedWaiterRace<" << name << ">() complete!" << std::endl;
+}
+
+template <class Sema>
+static void SemaphoreTests(const char* name)
+{
+    Semaphore_SignalBeforeWait<Sema>(name);
+    Semaphore_Timeout<Sema>(name);
+    Semaphore_WakeBlockedWaiter<Sema>(name);
+    Semaphore_PingPong<Sema>(name);
+    Semaphore_TimedWaiterRace<Sema>(name);
+}
+
+void SemaphoreTests()
+{
+    SemaphoreTests<CvSemaphore>("CvSemaphore");
+#ifdef DMQ_FUTEX_SEMAPHORE
+    SemaphoreTests<FutexSemaphore>("FutexSemaphore");
+#endif
+}
+
+#else
+void SemaphoreTests() {}
+#endif
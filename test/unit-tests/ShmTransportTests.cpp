@@ -0,0 +1,243 @@
+#include "DelegateMQ.h"
+#include "UnitTestCommon.h"
+
+#if defined(__linux__)
+#include "port/transport/shm/ShmTransport.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace dmq;
+using namespace dmq::transport;
+
+namespace {
+    // Writes a single int in host byte order
+    class IntSerializer : public ISerializer<void(int)> {
+    public:
+        std::ostream& Write(std::ostream& os, const int& value) override {
+            return os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+        std::istream& Read(std::istream& is, int& value) override {
+            return is.read(reinterpret_cast<char*>(&value), sizeof(value));
+        }
+    };
+
+    std::string SegmentName(const char* suffix) {
+        return "dmq_test_" + std::to_string(getpid()) + "_" + suffix;
+    }
+
+    int SendBytes(ShmTransport& transport, uint16_t id, const std::string& data) {
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os.write(data.data(), data.size());
+        return transport.Send(os, DmqHeader(id, DmqHeader::GetNextSeqNum()));
+    }
+
+    int ReceiveBytes(ShmTransport& transport, DmqHeader& header, std::string& data) {
+        xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+        int err = transport.Receive(is, header);
+        const auto bytes = is.str();
+        data.assign(bytes.data(), bytes.size());
+        return err;
+    }
+
+    // Deterministic payload of a given length
+    std::string Pattern(int producer, int index) {
+        std::string s(1 + (index * 37) % 300, '\0');
+        for (size_t i = 0; i < s.size(); i++)
+            s[i] = static_cast<char>(producer * 31 + index + i);
+        return s;
+    }
+}
+
+void ShmTransportTests()
+{
+    const std::string ab = SegmentName("ab");
+    const std::string ba = SegmentName("ba");
+    ShmTransport::Unlink(ab.c_str());
+    ShmTransport::Unlink(ba.c_str());
+
+    // Full-duplex pair: framing, both directions, HasPending
+    {
+        ShmTransport a, b;
+        ASSERT_TRUE(a.Create(ab.c_str(), ba.c_str(), 4096) == 0);
+        ASSERT_TRUE(b.Create(ba.c_str(), ab.c_str(), 4096) == 0);
+        a.SetRecvTimeout(std::chrono::milliseconds(100));
+        b.SetRecvTimeout(std::chrono::milliseconds(100));
+
+        ASSERT_TRUE(SendBytes(a, 10, "hello") == 0);
+        ASSERT_TRUE(SendBytes(a, 11, "") == 0);
+        ASSERT_TRUE(b.HasPending());
+
+        DmqHeader header;
+        std::string data;
+        ASSERT_TRUE(ReceiveBytes(b, header, data) == 0);
+        ASSERT_TRUE(header.GetId() == 10 && header.GetLength() == 5 && data == "hello");
+        ASSERT_TRUE(ReceiveBytes(b, header, data) == 0);
+        ASSERT_TRUE(header.GetId() == 11 && data.empty());
+        ASSERT_TRUE(!b.HasPending());
+        ASSERT_TRUE(ReceiveBytes(b, header, data) == -1);      // Timeout
+
+        ASSERT_TRUE(SendBytes(b, 12, "reply") == 0);
+        ASSERT_TRUE(ReceiveBytes(a, header, data) == 0);
+        ASSERT_TRUE(header.GetId() == 12 && data == "reply");
+
+        // Extended header is read transparently
+        a.SetExtendedHeader(true, true);
+        ASSERT_TRUE(SendBytes(a, 13, "ext") == 0);
+        ASSERT_TRUE(ReceiveBytes(b, header, data) == 0);
+        ASSERT_TRUE(header.GetId() == 13 && header.IsExtended() && data == "ext");
+    }
+
+    // Two producers, small ring: wraparound, full-ring waits, per-producer order
+    {
+        ShmTransport rx;
+        ShmTransport tx1, tx2;
+        ASSERT_TRUE(rx.Create(ShmTransport::Type::SUB, ab.c_str(), 4096) == 0);
+        ASSERT_TRUE(tx1.Create(ShmTransport::Type::PUB, ab.c_str(), 4096) == 0);
+        ASSERT_TRUE(tx2.Create(ShmTransport::Type::PUB, ab.c_str(), 4096) == 0);
+        rx.SetRecvTimeout(std::chrono::milliseconds(1000));
+
+        const int COUNT = 2000;
+        std::atomic<int> sendErrors{ 0 };
+        auto producer = [&](ShmTransport& tx, uint16_t id) {
+            for (int i = 0; i < COUNT; i++)
+                if (SendBytes(tx, id, Pattern(id, i)) != 0)
+                    sendErrors++;
+        };
+        std::thread t1(producer, std::ref(tx1), uint16_t(1));
+        std::thread t2(producer, std::ref(tx2), uint16_t(2));
+
+        int next[3] = { 0, 0, 0 };
+        bool ok = true;
+        for (int i = 0; i < COUNT * 2 && ok; i++) {
+            DmqHeader header;
+            std::string data;
+            ok = ReceiveBytes(rx, header, data) == 0 && (header.GetId() == 1 || header.GetId() == 2);
+            if (ok) {
+                ok = data == Pattern(header.GetId(), next[header.GetId()]);
+                next[header.GetId()]++;
+            }
+        }
+        t1.join();
+        t2.join();
+        ASSERT_TRUE(ok);
+        ASSERT_TRUE(sendErrors == 0);
+        ASSERT_TRUE(next[1] == COUNT && next[2] == COUNT);
+    }
+    ShmTransport::Unlink(ab.c_str());
+
+    // Zero-copy send: serializer writes into the ring slot
+    {
+        ShmTransport tx, rx;
+        ASSERT_TRUE(tx.Create(ShmTransport::Type::PUB, ab.c_str(), 4096) == 0);
+        ASSERT_TRUE(rx.Create(ShmTransport::Type::SUB, ab.c_str(), 4096) == 0);
+        rx.SetRecvTimeout(std::chrono::milliseconds(100));
+
+        IntSerializer serializer;
+        ASSERT_TRUE(tx.SendInPlace(20, serializer, 1234) == 0);
+
+        xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+        DmqHeader header;
+        ASSERT_TRUE(rx.Receive(is, header) == 0);
+        int value = 0;
+        serializer.Read(is, value);
+        ASSERT_TRUE(header.GetId() == 20 && header.GetLength() == sizeof(int) && value == 1234);
+
+        // Slot too small: nothing sent, ring still usable
+        tx.SetInPlaceSize(2);
+        ASSERT_TRUE(tx.SendInPlace(21, serializer, 1) == -1);
+        ASSERT_TRUE(!rx.HasPending());
+
+        // Reserve/Commit directly
+        uint8_t* slot = tx.Reserve(3);
+        ASSERT_TRUE(slot != nullptr);
+        memcpy(slot, "abc", 3);
+        ASSERT_TRUE(tx.Commit(DmqHeader(22, DmqHeader::GetNextSeqNum()), 3) == 0);
+        std::string data;
+        ASSERT_TRUE(ReceiveBytes(rx, header, data) == 0);
+        ASSERT_TRUE(header.GetId() == 22 && data == "abc");
+    }
+    ShmTransport::Unlink(ab.c_str());
+
+    // Zero-copy receive: the payload is viewed in the ring until the next call
+    {
+        ShmTransport tx, rx;
+        ASSERT_TRUE(tx.Create(ShmTransport::Type::PUB, ab.c_str(), 1024) == 0);
+        ASSERT_TRUE(rx.Create(ShmTransport::Type::SUB, ab.c_str(), 1024) == 0);
+        rx.SetRecvTimeout(std::chrono::milliseconds(100));
+        ASSERT_TRUE(rx.SupportsReceiveView());
+
+        IntSerializer serializer;
+        ASSERT_TRUE(tx.SendInPlace(40, serializer, 5678) == 0);
+        ASSERT_TRUE(SendBytes(tx, 41, "view") == 0);
+
+        TransportBuffer payload;
+        DmqHeader header;
+        ASSERT_TRUE(rx.ReceiveView(payload, header) == 0);
+        ASSERT_TRUE(header.GetId() == 40 && payload.size == sizeof(int));
+        ByteSpan span(payload.data, payload.size);
+        int value = 0;
+        serializer.ReadSpan(span, value);
+        ASSERT_TRUE(span.Good() && value == 5678);
+        ASSERT_TRUE(rx.HasPending());
+
+        ASSERT_TRUE(rx.ReceiveView(payload, header) == 0);
+        ASSERT_TRUE(header.GetId() == 41);
+        ASSERT_TRUE(std::string(static_cast<const char*>(payload.data), payload.size) == "view");
+        ASSERT_TRUE(!rx.HasPending());      // Held record is not pending
+
+        // A held record keeps its space until released by the next receive
+        int sent = 0;
+        tx.SetSendTimeout(std::chrono::milliseconds(10));
+        while (SendBytes(tx, 42, std::string(100, 'x')) == 0)
+            sent++;
+        ASSERT_TRUE(std::string(static_cast<const char*>(payload.data), payload.size) == "view");
+        for (int i = 0; i < sent; i++)
+            ASSERT_TRUE(rx.ReceiveView(payload, header) == 0 && header.GetId() == 42);
+        ASSERT_TRUE(rx.ReceiveView(payload, header) == -1);
+    }
+    ShmTransport::Unlink(ab.c_str());
+
+    // Ring full without a reader: send times out; SUB side cannot send
+    {
+        ShmTransport tx, rx;
+        ASSERT_TRUE(tx.Create(ShmTransport::Type::PUB, ab.c_str(), 1024) == 0);
+        ASSERT_TRUE(rx.Create(ShmTransport::Type::SUB, ab.c_str(), 1024) == 0);
+        tx.SetSendTimeout(std::chrono::milliseconds(10));
+        int sent = 0;
+        while (SendBytes(tx, 30, std::string(100, 'x')) == 0 && sent < 100)
+            sent++;
+        ASSERT_TRUE(sent > 0 && sent < 100);
+        ASSERT_TRUE(SendBytes(tx, 30, std::string(tx.GetMaxPayloadSize() + 1, 'x')) == -1);
+        ASSERT_TRUE(SendBytes(rx, 30, "x") == -1);
+    }
+    ShmTransport::Unlink(ab.c_str());
+
+    // Close wakes a blocked receiver
+    {
+        ShmTransport rx;
+        ASSERT_TRUE(rx.Create(ShmTransport::Type::SUB, ab.c_str(), 4096) == 0);
+        rx.SetRecvTimeout(std::chrono::milliseconds(5000));
+        std::atomic<int> result{ 1 };
+        std::thread t([&]() {
+            DmqHeader header;
+            std::string data;
+            result = ReceiveBytes(rx, header, data);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        auto start = std::chrono::steady_clock::now();
+        rx.Close();
+        t.join();
+        ASSERT_TRUE(result == -1);
+        ASSERT_TRUE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(1000));
+    }
+
+    ShmTransport::Unlink(ab.c_str());
+    ShmTransport::Unlink(ba.c_str());
+}
+
+#else
+void ShmTransportTests() {}
+#endif
@@ -0,0 +1,247 @@
+#include "DelegateMQ.h"
+#include "UnitTestCommon.h"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace dmq;
+using namespace dmq::os;
+
+// Wait until count reaches expected or timeout elapses. Returns true on success.
+static bool WaitCount(const std::atomic<int>& cnt, int expected,
+                      std::chrono::milliseconds timeout = std::chrono::milliseconds(5000))
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (cnt.load() < expected && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    return cnt.load() >= expected;
+}
+
+namespace PoolTest
+{
+    // Detects overlapping calls on the same instance
+    class Target
+    {
+    public:
+        void Work(int value)
+        {
+            if (m_active.fetch_add(1) != 0)
+                m_overlap = true;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            if (value != m_next)
+                m_outOfOrder = true;
+            m_next = value + 1;
+            m_active.fetch_sub(1);
+            m_count++;
+        }
+
+        std::atomic<int> m_active{ 0 };
+        std::atomic<int> m_count{ 0 };
+        std::atomic<bool> m_overlap{ false };
+        bool m_outOfOrder = false;
+        int m_next = 0;
+    };
+
+    // Records the most calls in progress at once across all instances. Aligned
+    // like typical heap objects so the strand keys share their low address bits.
+    class alignas(64) BusyTarget
+    {
+    public:
+        void Work()
+        {
+            int active = ++s_active;
+            int peak = s_peak.load();
+            while (active > peak && !s_peak.compare_exchange_weak(peak, active)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            s_active--;
+            s_count++;
+        }
+
+        static std::atomic<int> s_active;
+        static std::atomic<int> s_peak;
+        static std::atomic<int> s_count;
+    };
+    std::atomic<int> BusyTarget::s_active{ 0 };
+    std::atomic<int> BusyTarget::s_peak{ 0 };
+    std::atomic<int> BusyTarget::s_count{ 0 };
+}
+using namespace PoolTest;
+
+// Many producers posting to the pool; every message is delivered exactly once.
+static void ThreadPool_DeliversAll()
+{
+    ThreadPool pool("DeliverPool", 4);
+    pool.CreateThreadPool();
+    ASSERT_TRUE(pool.GetWorkerCount() == 4);
+
+    const int PRODUCERS = 4;
+    const int SEND_COUNT = 500;
+    std::atomic<int> deliveredCount{ 0 };
+    auto del = MakeDelegate(std::function<void()>([&deliveredCount]() { deliveredCount++; }), pool);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++)
+        producers.emplace_back([&del]() { for (int i = 0; i < SEND_COUNT; i++) del(); });
+    for (auto& t : producers)
+        t.join();
+
+    ASSERT_TRUE(WaitCount(deliveredCount, PRODUCERS * SEND_COUNT));
+    pool.ExitThreadPool();
+    ASSERT_TRUE(deliveredCount == PRODUCERS * SEND_COUNT);
+    std::cout << "ThreadPool_DeliversAll() complete!" << std::endl;
+}
+
+// Calls on one target object are serialized and ordered; separate objects run in parallel.
+static void ThreadPool_StrandSerializesTarget()
+{
+    ThreadPool pool("StrandPool", 4);
+    pool.CreateThreadPool();
+
+    Target t1, t2;
+    auto d1 = MakeDelegate(&t1, &Target::Work, pool);
+    auto d2 = MakeDelegate(&t2, &Target::Work, pool);
+
+    const int SEND_COUNT = 200;
+    for (int i = 0; i < SEND_COUNT; i++)
+    {
+        d1(i);
+        d2(i);
+    }
+
+    ASSERT_TRUE(WaitCount(t1.m_count, SEND_COUNT));
+    ASSERT_TRUE(WaitCount(t2.m_count, SEND_COUNT));
+    pool.ExitThreadPool();
+
+    ASSERT_TRUE(!t1.m_overlap && !t2.m_overlap);
+    ASSERT_TRUE(!t1.m_outOfOrder && !t2.m_outOfOrder);
+    std::cout << "ThreadPool_StrandSerializesTarget() complete!" << std::endl;
+}
+
+// Separate strand targets are spread over the workers and run at the same time.
+static void ThreadPool_StrandTargetsRunConcurrently()
+{
+    ThreadPool pool("StrandSpreadPool", 4);
+    pool.CreateThreadPool();
+    BusyTarget::s_peak = 0;
+    BusyTarget::s_count = 0;
+
+    const int TARGETS = 8;
+    std::vector<std::unique_ptr<BusyTarget>> targets;
+    for (int i = 0; i < TARGETS; i++)
+        targets.push_back(std::make_unique<BusyTarget>());
+
+    for (auto& target : targets)
+        MakeDelegate(target.get(), &BusyTarget::Work, pool)();
+
+    ASSERT_TRUE(WaitCount(BusyTarget::s_count, TARGETS));
+    pool.ExitThreadPool();
+    ASSERT_TRUE(BusyTarget::s_peak >= 2);
+    std::cout << "ThreadPool_StrandTargetsRunConcurrently() complete!" << std::endl;
+}
+
+// A blocked worker's shareable messages are stolen by an idle worker.
+static void ThreadPool_IdleWorkerSteals()
+{
+    ThreadPool pool("StealPool", 2);
+    pool.CreateThreadPool();
+
+    std::promise<void> release;
+    std::shared_future<void> gate = release.get_future().share();
+    std::atomic<int> deliveredCount{ 0 };
+
+    auto blocker = MakeDelegate(std::function<void()>([gate]() { gate.wait(); }), pool);
+    auto work = MakeDelegate(std::function<void()>([&deliveredCount]() { deliveredCount++; }), pool);
+
+    // Blocker lands on worker 0; work is posted round-robin to both workers
+    blocker();
+    for (int i = 0; i < 10; i++)
+        work();
+
+    // All work completes while worker 0 is still blocked
+    ASSERT_TRUE(WaitCount(deliveredCount, 10));
+    release.set_value();
+    pool.ExitThreadPool();
+    std::cout << "ThreadPool_IdleWorkerSteals() complete!" << std::endl;
+}
+
+// IsCurrentThread() and blocking async calls onto the pool.
+static void ThreadPool_AsyncWait()
+{
+    ThreadPool pool("WaitPool", 2);
+    pool.CreateThreadPool();
+
+    ASSERT_TRUE(!pool.IsCurrentThread());
+    auto onPool = MakeDelegate(std::function<bool()>([&pool]() { return pool.IsCurrentThread(); }), pool, WAIT_INFINITE);
+    auto retVal = onPool.AsyncInvoke();
+    ASSERT_TRUE(retVal.has_value() && retVal.value());
+
+    pool.ExitThreadPool();
+    std::cout << "ThreadPool_AsyncWait() complete!" << std::endl;
+}
+
+// ExitThreadPool() called from a handler stops the pool without joining the caller.
+static void ThreadPool_ExitFromHandler()
+{
+    std::atomic<int> exitedCount{ 0 };
+    std::atomic<int> finishedCount{ 0 };
+    std::atomic<int> deliveredCount{ 0 };
+    {
+        ThreadPool pool("ExitPool", 2);
+        pool.CreateThreadPool();
+
+        auto exitPool = MakeDelegate(std::function<void()>([&pool, &exitedCount, &finishedCount]() {
+            pool.ExitThreadPool();
+            exitedCount++;
+            // Still running on a worker after the caller sees the exit
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            finishedCount++;
+        }), pool);
+        auto work = MakeDelegate(std::function<void()>([&deliveredCount]() { deliveredCount++; }), pool);
+
+        exitPool();
+        ASSERT_TRUE(WaitCount(exitedCount, 1));
+
+        // Stopped pool rejects new messages
+        work();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_TRUE(deliveredCount == 0);
+
+        // Joined from outside the pool; the pool can then be restarted
+        pool.ExitThreadPool();
+        pool.CreateThreadPool();
+        work();
+        ASSERT_TRUE(WaitCount(deliveredCount, 1));
+
+        // Exit from a handler, then restart directly without an outside exit
+        exitPool();
+        ASSERT_TRUE(WaitCount(exitedCount, 2));
+        ASSERT_TRUE(pool.CreateThreadPool());
+        ASSERT_TRUE(finishedCount == 2);
+        work();
+        ASSERT_TRUE(WaitCount(deliveredCount, 2));
+
+        // Exit from a handler again and leave the join to the destructor
+        exitPool();
+        ASSERT_TRUE(WaitCount(exitedCount, 3));
+    }
+
+    // No worker outlives the pool
+    ASSERT_TRUE(finishedCount == 3);
+    std::cout << "ThreadPool_ExitFromHandler() complete!" << std::endl;
+}
+
+void ThreadPoolTests()
+{
+    ThreadPool_DeliversAll();
+    ThreadPool_StrandSerializesTarget();
+    ThreadPool_StrandTargetsRunConcurrently();
+    ThreadPool_IdleWorkerSteals();
+    ThreadPool_AsyncWait();
+    ThreadPool_ExitFromHandler();
+
+    std::cout << "ThreadPoolTests() complete!" << std::endl;
+}
@@ -0,0 +1,138 @@
+#include "DelegateMQ.h"
+#include "UnitTestCommon.h"
+#include "extras/util/WindowedTransport.h"
+#include "LoopbackLink.h"
+#include <chrono>
+#include <functional>
+#include <set>
+#include <thread>
+
+using namespace dmq;
+using namespace dmq::transport;
+using namespace dmq::util;
+using namespace LoopbackLink;
+
+namespace {
+    int SendValue(WindowedTransport& transport, uint16_t id, int value) {
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        DmqHeader header(id, DmqHeader::GetNextSeqNum());
+        return transport.Send(os, header);
+    }
+
+    // Drain both directions once; collect delivered values on the receiver
+    void Pump(WindowedTransport& sender, WindowedTransport& receiver, std::multiset<int>& delivered) {
+        for (;;) {
+            xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+            DmqHeader header;
+            if (!receiver.HasPending())
+                break;
+            if (receiver.Receive(is, header) == 0 && header.GetId() != ACK_REMOTE_ID) {
+                int value = 0;
+                is.read(reinterpret_cast<char*>(&value), sizeof(value));
+                delivered.insert(value);
+            }
+        }
+        receiver.Process();
+        while (sender.HasPending()) {
+            xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+            DmqHeader header;
+            sender.Receive(is, header);
+        }
+        sender.Process();
+    }
+}
+
+void WindowedTransportTests()
+{
+    // Lossless: every message acknowledged, ACKs coalesced
+    {
+        Link link;
+        WindowedTransport sender(link.a), receiver(link.b);
+        int success = 0;
+        ScopedConnection conn = sender.OnSendStatus.Connect(MakeDelegate(std::function<void(DelegateRemoteId, uint32_t, WindowedTransport::Status)>(
+            [&](DelegateRemoteId, uint32_t, WindowedTransport::Status status) {
+                if (status == WindowedTransport::Status::SUCCESS) success++;
+            })));
+
+        const int COUNT = 200;
+        std::multiset<int> delivered;
+        for (int i = 0; i < COUNT; i++) {
+            while (SendValue(sender, 10, i) != 0)
+                Pump(sender, receiver, delivered);
+        }
+        for (int i = 0; i < 20 && success < COUNT; i++) {
+            Pump(sender, receiver, delivered);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        ASSERT_TRUE(success == COUNT);
+        ASSERT_TRUE(delivered.size() == COUNT);
+        ASSERT_TRUE(sender.GetInFlight() == 0);
+        ASSERT_TRUE(link.a.dataSent == COUNT);              // No retransmissions
+        ASSERT_TRUE(link.b.acksSent <= COUNT / 2 + 1);      // Delayed ACK
+        ASSERT_TRUE(sender.GetRto() < std::chrono::milliseconds(500));  // RTT sampled
+    }
+
+    // Lossy: every 5th first transmission dropped; all delivered exactly once
+    {
+        Link link;
+        std::set<uint16_t> droppedOnce;
+        link.a.drop = [&](const DmqHeader& h, const std::string&) {
+            return h.GetSeqNum() % 5 == 0 && droppedOnce.insert(h.GetSeqNum()).second;
+        };
+        WindowedTransport sender(link.a, 5, std::chrono::milliseconds(20)), receiver(link.b);
+        int success = 0;
+        ScopedConnection conn = sender.OnSendStatus.Connect(MakeDelegate(std::function<void(DelegateRemoteId, uint32_t, WindowedTransport::Status)>(
+            [&](DelegateRemoteId, uint32_t, WindowedTransport::Status status) {
+                if (status == WindowedTransport::Status::SUCCESS) success++;
+            })));
+
+        const int COUNT = 100;
+        std::multiset<int> delivered;
+        for (int i = 0; i < COUNT; i++) {
+            while (SendValue(sender, 11, i) != 0) {
+                Pump(sender, receiver, delivered);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            Pump(sender, receiver, delivered);
+        }
+        for (int i = 0; i < 500 && success < COUNT; i++) {
+            Pump(sender, receiver, delivered);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_TRUE(success == COUNT);
+        ASSERT_TRUE(delivered.size() == COUNT);
+        for (int i = 0; i < COUNT; i++)
+            ASSERT_TRUE(delivered.count(i) == 1);
+    }
+
+    // Window full: sends rejected until ACKs arrive
+    {
+        Link link;
+        WindowedTransport sender(link.a);
+        for (int i = 0; i < WindowedTransport::WINDOW_SIZE; i++)
+            ASSERT_TRUE(SendValue(sender, 12, i) == 0);
+        ASSERT_TRUE(SendValue(sender, 12, 0) == -1);
+        ASSERT_TRUE(sender.GetInFlight() == WindowedTransport::WINDOW_SIZE);
+    }
+
+    // Dead link: reported as TIMEOUT after the retry budget
+    {
+        Link link;
+        link.a.drop = [](const DmqHeader&, const std::string&) { return true; };
+        WindowedTransport sender(link.a, 2, std::chrono::milliseconds(10));
+        int timeouts = 0;
+        ScopedConnection conn = sender.OnSendStatus.Connect(MakeDelegate(std::function<void(DelegateRemoteId, uint32_t, WindowedTransport::Status)>(
+            [&](DelegateRemoteId id, uint32_t, WindowedTransport::Status status) {
+                if (status == WindowedTransport::Status::TIMEOUT && id == 13) timeouts++;
+            })));
+        ASSERT_TRUE(SendValue(sender, 13, 1) == 0);
+        for (int i = 0; i < 200 && timeouts == 0; i++) {
+            sender.Process();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_TRUE(timeouts == 1);
+        ASSERT_TRUE(link.a.dataSent == 3);      // Original + 2 retries
+        ASSERT_TRUE(sender.GetInFlight() == 0);
+    }
+}
@@ -11,6 +11,9 @@
 #include <map>
 #include <list>
 #include <set>
+#include <thread>
+#include <mutex>
+#include <deque>
 
 using namespace std;
 
@@ -24,6 +27,9 @@ public:
 // Allocate 10 blocks of MyClass size from the heap
 IMPLEMENT_ALLOCATOR(MyClass, 10, NULL)
 
+// Defined in xallocator.cpp
+extern "C" Allocator* xallocator_get_allocator(size_t size);
+
 // A class to test XALLOCATOR
 class MyXClass {
     XALLOCATOR
@@ -51,6 +57,8 @@ void AllocatorTests()
         void* p2 = allocator.Allocate(requestSize);
         ASSERT_TRUE(p2 != NULL);
         ASSERT_TRUE(allocator.GetBlocksInUse() == 2);
+        ASSERT_TRUE(allocator.GetBlocksInUseMax() == 2);
+        ASSERT_TRUE(allocator.GetMaxBlocks() == 5);
 
         allocator.Deallocate(p1);
         ASSERT_TRUE(allocator.GetBlocksInUse() == 1);
@@ -58,6 +66,8 @@ void AllocatorTests()
 
         allocator.Deallocate(p2);
         ASSERT_TRUE(allocator.GetBlocksInUse() == 0);
+        ASSERT_TRUE(allocator.GetBlocksInUseMax() == 2);
+        ASSERT_TRUE(allocator.GetExhaustedCount() == 0);
     }
 
     // Test AllocatorPool
@@ -147,6 +157,105 @@ void AllocatorTests()
         ASSERT_TRUE(m.size() == 2);
     }
 
+    // Test xallocator from several threads: blocks freed on another thread are
+    // reused, and thread caches are returned to the allocator on thread exit
+    {
+        const int COUNT = 20000;
+        Allocator* allocator = xallocator_get_allocator(48);
+        uint32_t inUse = allocator->GetBlocksInUse();
+
+        std::mutex lock;
+        std::deque<int*> queue;
+        bool ok = true;
+        std::thread producer([&]() {
+            for (int i = 0; i < COUNT; i++) {
+                int* p = static_cast<int*>(xmalloc(48));
+                p[0] = i;
+                p[11] = ~i;
+                std::lock_guard<std::mutex> guard(lock);
+                queue.push_back(p);
+            }
+        });
+        std::thread consumer([&]() {
+            for (int i = 0; i < COUNT; ) {
+                int* p = nullptr;
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (!queue.empty()) {
+                        p = queue.front();
+                        queue.pop_front();
+                    }
+                }
+                if (p) {
+                    ok = ok && p[0] == i && p[11] == ~i;
+                    xfree(p);
+                    i++;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        producer.join();
+        consumer.join();
+        ASSERT_TRUE(ok);
+        ASSERT_TRUE(allocator->GetBlocksInUse() == inUse);
+        ASSERT_TRUE(xallocator_get_allocator(48) == allocator);
+        ASSERT_TRUE(xallocator_get_allocator(100000)->GetBlockSize() == 131072);
+    }
+
+    // Test xallocator blocks larger than the largest size class
+    {
+        const size_t BIG = 32 * 1024 * 1024;
+        ASSERT_TRUE(xallocator_get_allocator(BIG) == nullptr);
+        char* p = static_cast<char*>(xmalloc(BIG));
+        ASSERT_TRUE(p != nullptr);
+        p[0] = 'a';
+        p[BIG - 1] = 'z';
+        p = static_cast<char*>(xrealloc(p, BIG * 2));
+        ASSERT_TRUE(p != nullptr && p[0] == 'a' && p[BIG - 1] == 'z');
+        p = static_cast<char*>(xrealloc(p, 64));
+        ASSERT_TRUE(p != nullptr && p[0] == 'a');
+        xfree(p);
+    }
+
+    // Test xalloc_get_stats: one entry per size class, smallest first
+    {
+        void* p1 = xmalloc(1000);
+        void* p2 = xmalloc(1000);
+        XallocStats stats[32];
+        size_t count = xalloc_get_stats(stats, 32);
+        ASSERT_TRUE(count > 0);
+        const XallocStats* entry = nullptr;
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0)
+                ASSERT_TRUE(stats[i - 1].blockSize < stats[i].blockSize);
+            if (stats[i].blockSize == 1024)
+                entry = &stats[i];
+        }
+        ASSERT_TRUE(entry != nullptr);
+        ASSERT_TRUE(entry->blocksInUse >= 2);
+        ASSERT_TRUE(entry->blocksInUseMax >= entry->blocksInUse);
+        ASSERT_TRUE(entry->allocations >= entry->deallocations + 2);
+        ASSERT_TRUE(entry->maxBlocks == 0 && entry->exhaustedCount == 0);
+        ASSERT_TRUE(xalloc_get_stats(stats, 1) == 1);
+        xfree(p1);
+        xfree(p2);
+    }
+
+    // Test large blocks bypass the thread cache: one xmalloc holds one block
+    {
+        const size_t LARGE = 1024 * 1024;
+        Allocator* allocator = xallocator_get_allocator(LARGE);
+        uint32_t inUse = allocator ? allocator->GetBlocksInUse() : 0;
+        void* p = xmalloc(LARGE);
+        allocator = xallocator_get_allocator(LARGE);
+        ASSERT_TRUE(p != nullptr && allocator != nullptr);
+        ASSERT_TRUE(allocator->GetBlocksInUse() == inUse + 1);
+        xfree(p);
+        ASSERT_TRUE(allocator->GetBlocksInUse() == inUse);
+    }
+
     // Test xmake_shared
     {
         auto sp = xmake_shared<int>(123);
@@ -146,6 +146,32 @@ int DataBusErrorTest() {
         }
     }
 
+    // Test 5: Remote interest added after the topic was published unregistered
+    {
+        DataBus::ResetForTesting();
+        MockTransport transport;
+        auto participant = std::make_shared<Participant>(transport);
+        DataBus::AddParticipant(participant);
+
+        dmq::DelegateError capturedError = dmq::DelegateError::SUCCESS;
+        auto conn = DataBus::SubscribeError([&](const std::string&, dmq::DelegateError error) {
+            capturedError = error;
+        });
+
+        // The unregistered route is cached; AddRemoteTopic() must invalidate it
+        DataBus::Publish<int>("test/late", 1);
+        DataBus::Publish<int>("test/late", 2);
+        participant->AddRemoteTopic("test/late", 101);
+        DataBus::Publish<int>("test/late", 3);
+
+        if (capturedError == dmq::DelegateError::ERR_NO_SERIALIZER) {
+            std::cout << "Test 5 Passed: Remote interest seen after unregistered publishes" << std::endl;
+        } else {
+            std::cerr << "Test 5 Failed! Error: " << (int)capturedError << std::endl;
+            return 1;
+        }
+    }
+
     std::cout << "DataBusErrorTest Finished Successfully!" << std::endl;
     return 0;
 }
@@ -1,6 +1,8 @@
 #include "DelegateMQ.h"
+#include "extras/dispatcher/BatchDispatcher.h"
 #include <iostream>
 #include <queue>
+#include <vector>
 #include <atomic>
 #include <thread>
 #include <chrono>
@@ -37,10 +39,36 @@ public:
         return 0;
     }
 
+    // Report queued packets as already received, like a recvmmsg() batch
+    virtual bool HasPending() const override { return batching && !m_queue.empty(); }
+
+    bool batching = false;
+
 private:
     std::queue<Packet> m_queue;
 };
 
+// Loopback transport that lends each payload in place via ReceiveView()
+class DataBusViewTransport : public DataBusLoopbackTransport {
+public:
+    virtual int ReceiveView(TransportBuffer& payload, DmqHeader& header) override {
+        xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+        if (Receive(is, header) != 0) return -1;
+        m_current = is.str();
+        payload.data = m_current.data();
+        payload.size = m_current.size();
+        views++;
+        return 0;
+    }
+
+    virtual bool SupportsReceiveView() const override { return true; }
+
+    int views = 0;
+
+private:
+    xstring m_current;
+};
+
 int DataBusRemoteTestMain() {
     std::cout << "Starting DataBusRemoteTest..." << std::endl;
 
@@ -214,6 +242,132 @@ int DataBusRemoteTestMain() {
         sendWorker.ExitThread();
     }
 
+    // 5. Multi-participant fan-out serializes once and sends identical bytes
+    {
+        DataBus::ResetForTesting();
+
+        struct CountingSerializer : public dmq::serialization::serializer::Serializer<void(int)> {
+            int writeCount = 0;
+            std::ostream& Write(std::ostream& os, const int& v) override {
+                writeCount++;
+                return Serializer<void(int)>::Write(os, v);
+            }
+            dmq::ByteBuffer& WriteBuffer(dmq::ByteBuffer& buffer, const int& v) override {
+                writeCount++;
+                return Serializer<void(int)>::WriteBuffer(buffer, v);
+            }
+        } serializer;
+
+        DataBusLoopbackTransport transportA, transportB, transportC;
+        std::shared_ptr<Participant> senders[] = {
+            std::make_shared<Participant>(transportA),
+            std::make_shared<Participant>(transportB),
+            std::make_shared<Participant>(transportC)
+        };
+        for (auto& sender : senders) {
+            sender->AddRemoteTopic("fanout/topic", 600);
+            DataBus::AddParticipant(sender);
+        }
+        DataBus::RegisterSerializer<int>("fanout/topic", serializer);
+
+        DataBus::Publish<int>("fanout/topic", 1234);
+        ASSERT_TRUE(serializer.writeCount == 1);
+
+        // Every receiver decodes the shared payload
+        DataBusLoopbackTransport* transports[] = { &transportA, &transportB, &transportC };
+        for (auto* transport : transports) {
+            Participant receiver(*transport);
+            int receivedValue = 0;
+            receiver.RegisterHandler<int>(600, serializer, [&](int val) { receivedValue = val; });
+            ASSERT_TRUE(receiver.ProcessIncoming() == 0);
+            ASSERT_TRUE(receivedValue == 1234);
+        }
+    }
+
+    // 6. A batching transport is drained by a single ProcessIncoming() call
+    {
+        DataBus::ResetForTesting();
+        DataBusLoopbackTransport transport;
+        transport.batching = true;
+        dmq::serialization::serializer::Serializer<void(int)> serializer;
+
+        auto sender = std::make_shared<Participant>(transport);
+        sender->AddRemoteTopic("batch/topic", 700);
+        DataBus::AddParticipant(sender);
+        DataBus::RegisterSerializer<int>("batch/topic", serializer);
+        for (int i = 1; i <= 5; i++)
+            DataBus::Publish<int>("batch/topic", i);
+
+        Participant receiver(transport);
+        std::vector<int> received;
+        receiver.RegisterHandler<int>(700, serializer, [&](int val) { received.push_back(val); });
+        ASSERT_TRUE(receiver.ProcessIncoming() == 0);
+        ASSERT_TRUE((received == std::vector<int>{ 1, 2, 3, 4, 5 }));
+        ASSERT_TRUE(!transport.HasPending());
+    }
+
+    // 7. Messages coalesced by a BatchDispatcher are unpacked by ProcessIncoming()
+    {
+        DataBus::ResetForTesting();
+        DataBusLoopbackTransport transport;
+        dmq::serialization::serializer::Serializer<void(int)> serializer;
+        BatchDispatcher dispatcher;
+        dispatcher.SetTransport(&transport);
+        dispatcher.SetMaxDelay(dmq::Duration(0));
+
+        auto sender = std::make_shared<Participant>(transport);
+        sender->SetDispatcher(&dispatcher);
+        sender->AddRemoteTopic("coalesce/topic", 800);
+        DataBus::AddParticipant(sender);
+        DataBus::RegisterSerializer<int>("coalesce/topic", serializer);
+        for (int i = 1; i <= 5; i++)
+            DataBus::Publish<int>("coalesce/topic", i);
+        ASSERT_TRUE(dispatcher.GetPendingCount() == 5);
+        ASSERT_TRUE(dispatcher.Flush() == 0);
+
+        Participant receiver(transport);
+        std::vector<int> received;
+        receiver.RegisterHandler<int>(800, serializer, [&](int val) { received.push_back(val); });
+        ASSERT_TRUE(receiver.ProcessIncoming() == 0);
+        ASSERT_TRUE((received == std::vector<int>{ 1, 2, 3, 4, 5 }));
+        ASSERT_TRUE(receiver.ProcessIncoming() != 0);   // One frame carried all five
+    }
+
+    // 8. A transport with ReceiveView() is dispatched from the viewed payload,
+    //    including the records of a batch frame
+    {
+        DataBus::ResetForTesting();
+        DataBusViewTransport transport;
+        transport.batching = true;
+        dmq::serialization::serializer::Serializer<void(int)> serializer;
+        BatchDispatcher dispatcher;
+        dispatcher.SetTransport(&transport);
+        dispatcher.SetMaxDelay(dmq::Duration(0));
+
+        auto direct = std::make_shared<Participant>(transport);
+        direct->AddRemoteTopic("view/direct", 900);
+        DataBus::AddParticipant(direct);
+        auto batched = std::make_shared<Participant>(transport);
+        batched->SetDispatcher(&dispatcher);
+        batched->AddRemoteTopic("view/batched", 900);
+        DataBus::AddParticipant(batched);
+        DataBus::RegisterSerializer<int>("view/direct", serializer);
+        DataBus::RegisterSerializer<int>("view/batched", serializer);
+
+        DataBus::Publish<int>("view/direct", 1);
+        DataBus::Publish<int>("view/direct", 2);
+        DataBus::Publish<int>("view/batched", 3);
+        DataBus::Publish<int>("view/batched", 4);
+        ASSERT_TRUE(dispatcher.Flush() == 0);
+
+        Participant receiver(transport);
+        std::vector<int> received;
+        receiver.RegisterHandler<int>(900, serializer, [&](int val) { received.push_back(val); });
+        ASSERT_TRUE(receiver.ProcessIncoming() == 0);
+        ASSERT_TRUE((received == std::vector<int>{ 1, 2, 3, 4 }));
+        ASSERT_TRUE(transport.views == 3);
+    }
+
     std::cout << "DataBusRemoteTest PASSED!" << std::endl;
     return 0;
 }
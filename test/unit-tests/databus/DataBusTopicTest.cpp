@@ -0,0 +1,196 @@
+#include "DelegateMQ.h"
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <atomic>
+#include <thread>
+
+#if defined(DMQ_DATABUS)
+
+using namespace dmq;
+using namespace dmq::transport;
+using namespace dmq::databus;
+
+int DataBusTopicTestMain() {
+    std::cout << "Starting DataBusTopicTest..." << std::endl;
+
+    // 1. Handle publish reaches subscribers, including ones added after GetTopic()
+    {
+        DataBus::ResetForTesting();
+        auto topic = DataBus::GetTopic<int>("topic/handle");
+        ASSERT_TRUE(topic.GetName() == "topic/handle");
+
+        bool unhandled = false;
+        auto unhandledConn = DataBus::SubscribeUnhandled([&](const std::string&) { unhandled = true; });
+        topic.Publish(1);
+        ASSERT_TRUE(unhandled == true);
+
+        int received = 0;
+        auto conn = DataBus::Subscribe<int>("topic/handle", [&](int v) { received = v; });
+        topic.Publish(2);
+        ASSERT_TRUE(received == 2);
+
+        // String and handle publish are interchangeable
+        DataBus::Publish<int>("topic/handle", 3);
+        ASSERT_TRUE(received == 3);
+        topic.Publish(4);
+        ASSERT_TRUE(received == 4);
+    }
+
+    // 2. LVC enabled after the handle was resolved
+    {
+        DataBus::ResetForTesting();
+        auto topic = DataBus::GetTopic<int>("topic/lvc");
+        topic.Publish(10);
+        DataBus::LastValueCache("topic/lvc", true);
+        topic.Publish(11);
+
+        int received = 0;
+        QoS qos;
+        qos.lastValueCache = true;
+        auto conn = DataBus::Subscribe<int>("topic/lvc", [&](int v) { received = v; }, nullptr, qos);
+        ASSERT_TRUE(received == 11);
+    }
+
+    // 3. Monitor and stringifier
+    {
+        DataBus::ResetForTesting();
+        auto topic = DataBus::GetTopic<int>("topic/spy");
+        DataBus::RegisterStringifier<int>("topic/spy", [](const int& v) { return std::to_string(v); });
+
+        std::string value;
+        auto conn = DataBus::Monitor([&](const SpyPacket& packet) { value = packet.value; });
+        topic.Publish(42);
+        ASSERT_TRUE(value == "42");
+    }
+
+    // 4. Remote routes follow AddParticipant and AddRemoteTopic
+    {
+        DataBus::ResetForTesting();
+        dmq::serialization::serializer::Serializer<void(int)> serializer;
+
+        struct CountingTransport : public ITransport {
+            int sendCount = 0;
+            int Send(xostringstream&, const DmqHeader&) override { sendCount++; return 0; }
+            int Receive(xstringstream&, DmqHeader&) override { return -1; }
+        } transport;
+
+        auto topic = DataBus::GetTopic<int>("topic/remote");
+        DataBus::RegisterSerializer<int>("topic/remote", serializer);
+
+        auto participant = std::make_shared<Participant>(transport);
+        DataBus::AddParticipant(participant);
+        topic.Publish(1);
+        ASSERT_TRUE(transport.sendCount == 0);
+
+        participant->AddRemoteTopic("topic/remote", 500);
+        topic.Publish(2);
+        ASSERT_TRUE(transport.sendCount == 1);
+
+        topic.PublishLocal(3);
+        ASSERT_TRUE(transport.sendCount == 1);
+    }
+
+    // 5. Handle remains usable after a reset
+    {
+        auto topic = DataBus::GetTopic<int>("topic/reset");
+        DataBus::ResetForTesting();
+
+        int received = 0;
+        auto conn = DataBus::Subscribe<int>("topic/reset", [&](int v) { received = v; });
+        topic.Publish(7);
+        ASSERT_TRUE(received == 7);
+    }
+
+    // 6. Publishing unregistered topics creates no topic node but still reports
+    // unhandled; a later registration is picked up
+    {
+        DataBus::ResetForTesting();
+        int unhandled = 0;
+        auto unhandledConn = DataBus::SubscribeUnhandled([&](const std::string&) { unhandled++; });
+        for (int i = 0; i < 1000; ++i)
+            DataBus::Publish<int>("topic/unknown/" + std::to_string(i), i);
+        ASSERT_TRUE(unhandled == 1000);
+
+        int received = 0;
+        auto conn = DataBus::Subscribe<int>("topic/unknown/5", [&](int v) { received = v; });
+        DataBus::Publish<int>("topic/unknown/5", 55);
+        ASSERT_TRUE(received == 55);
+        ASSERT_TRUE(unhandled == 1000);
+
+        // Registered after a publish that created no node
+        DataBus::Publish<int>("topic/unknown/late", 1);
+        auto lateConn = DataBus::Subscribe<int>("topic/unknown/late", [&](int v) { received = v; });
+        DataBus::Publish<int>("topic/unknown/late", 2);
+        ASSERT_TRUE(received == 2);
+    }
+
+    // 7. ResetForTesting() while other threads publish by name and by handle
+    {
+        DataBus::ResetForTesting();
+        std::atomic<bool> stop(false);
+        auto publisher = [&stop](int id) {
+            auto topic = DataBus::GetTopic<int>("topic/reset/handle");
+            const std::string name = "topic/reset/" + std::to_string(id);
+            for (int i = 0; !stop; ++i) {
+                DataBus::Publish<int>(name, i);
+                DataBus::Publish<int>("topic/reset/unknown", i);
+                topic.Publish(i);
+            }
+        };
+        std::thread t1(publisher, 1);
+        std::thread t2(publisher, 2);
+
+        for (int i = 0; i < 200; ++i) {
+            {
+                auto conn1 = DataBus::Subscribe<int>("topic/reset/1", [](int) {});
+                auto conn2 = DataBus::Subscribe<int>("topic/reset/2", [](int) {});
+                std::this_thread::yield();
+            }
+            DataBus::ResetForTesting();
+        }
+        stop = true;
+        t1.join();
+        t2.join();
+
+        int received = 0;
+        auto conn = DataBus::Subscribe<int>("topic/reset/1", [&](int v) { received = v; });
+        DataBus::Publish<int>("topic/reset/1", 9);
+        ASSERT_TRUE(received == 9);
+    }
+
+    // 8. Throughput comparison
+    {
+        DataBus::ResetForTesting();
+        const int iterations = 100000;
+        int count = 0;
+        auto conn = DataBus::Subscribe<int>("topic/bench", [&](int) { count++; });
+        auto topic = DataBus::GetTopic<int>("topic/bench");
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            DataBus::Publish<int>("topic/bench", i);
+        auto mid = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            topic.Publish(i);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::chrono::duration<double> byName = mid - start;
+        std::chrono::duration<double> byHandle = end - mid;
+        std::cout << "Publish by name: " << iterations / byName.count() << " msg/sec" << std::endl;
+        std::cout << "Publish by handle: " << iterations / byHandle.count() << " msg/sec" << std::endl;
+        ASSERT_TRUE(count == iterations * 2);
+    }
+
+    DataBus::ResetForTesting();
+    std::cout << "DataBusTopicTest PASSED!" << std::endl;
+    return 0;
+}
+
+#else
+
+int DataBusTopicTestMain() {
+    return 0;
+}
+
+#endif
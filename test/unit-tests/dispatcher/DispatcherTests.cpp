@@ -2,7 +2,13 @@
 #include "UnitTestCommon.h"
 #include "extras/dispatcher/Dispatcher.h"
 #include "extras/dispatcher/RemoteChannel.h"
+#include "extras/dispatcher/BatchDispatcher.h"
+#include <chrono>
+#include <thread>
+#include <vector>
 #include <iostream>
+#include <cstring>
+#include <string>
 
 using namespace std;
 using namespace dmq;
@@ -27,7 +33,40 @@ namespace {
         int Receive(xstringstream& is, DmqHeader& header) override { return 0; }
     };
 
+    // Transport implementing the gather send path
+    class MockBufferTransport : public MockTransport {
+    public:
+        const void* lastData = nullptr;
+        std::string lastPayload;
+        int bufferSendCount = 0;
+
+        int SendBuffers(const DmqHeader& header, const TransportBuffer* buffers, size_t count) override {
+            lastId = header.GetId();
+            lastSeq = header.GetSeqNum();
+            lastData = count ? buffers[0].data : nullptr;
+            lastPayload.clear();
+            for (size_t i = 0; i < count; i++)
+                lastPayload.append(static_cast<const char*>(buffers[i].data), buffers[i].size);
+            lastPayloadSize = lastPayload.size();
+            bufferSendCount++;
+            return 0;
+        }
+        bool SupportsBufferSend() const override { return true; }
+    };
+
     void FreeFunc(int i) {}
+
+    // Records of the last batch frame sent on a buffer transport
+    std::vector<std::pair<DmqHeader, std::string>> UnpackLast(const MockBufferTransport& transport) {
+        std::vector<std::pair<DmqHeader, std::string>> records;
+        xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+        is.write(transport.lastPayload.data(), transport.lastPayload.size());
+        UnpackBatch(is, [&](const DmqHeader& header, xstringstream& record) {
+            TransportBuffer view = GetStreamBuffer(record);
+            records.emplace_back(header, std::string(static_cast<const char*>(view.data), view.size));
+        });
+        return records;
+    }
 }
 
 void DispatcherTests()
@@ -53,6 +92,228 @@ void DispatcherTests()
         ASSERT_TRUE(transport.lastSeq >= nextExpectedSeq - 1);
     }
 
+    // Dispatcher passes the stream bytes in place to a buffer-capable transport
+    {
+        MockBufferTransport transport;
+        Dispatcher dispatcher;
+        dispatcher.SetTransport(&transport);
+
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os << "test data";
+        TransportBuffer view = GetStreamBuffer(os);
+        ASSERT_TRUE(view.size == 9);
+
+        int err = dispatcher.Dispatch(os, DelegateRemoteId(101));
+        ASSERT_TRUE(err == 0);
+        ASSERT_TRUE(transport.bufferSendCount == 1);
+        ASSERT_TRUE(transport.sendCount == 0);
+        ASSERT_TRUE(transport.lastId == 101);
+        ASSERT_TRUE(transport.lastData == view.data);
+        ASSERT_TRUE(transport.lastPayload == "test data");
+    }
+
+    // Default SendBuffers() gathers the buffers and falls back to Send()
+    {
+        MockTransport transport;
+        const char part1[] = "abc";
+        const char part2[] = "defg";
+        TransportBuffer buffers[2];
+        buffers[0].data = part1;
+        buffers[0].size = 3;
+        buffers[1].data = part2;
+        buffers[1].size = 4;
+
+        ASSERT_TRUE(!transport.SupportsBufferSend());
+        int err = transport.SendBuffers(DmqHeader(102, 0), buffers, 2);
+        ASSERT_TRUE(err == 0);
+        ASSERT_TRUE(transport.sendCount == 1);
+        ASSERT_TRUE(transport.lastId == 102);
+        ASSERT_TRUE(transport.lastPayloadSize == 7);
+    }
+
+    // Header wire encoding is Network Byte Order
+    {
+        DmqHeader header(0x0102, 0x0304, 0x0506);
+        uint8_t bytes[DmqHeader::HEADER_SIZE];
+        WriteHeader(header, bytes);
+        const uint8_t expected[] = { 0xAA, 0x55, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+        ASSERT_TRUE(memcmp(bytes, expected, sizeof(expected)) == 0);
+    }
+
+    // Extended header round trip, with and without a timestamp
+    {
+        DmqHeader header(0x0102, 0x12345678, 0x00020000);
+        ASSERT_TRUE(header.IsExtended());           // Length needs 32 bits
+        ASSERT_TRUE(header.GetSeqNum() == 0x5678);
+        uint8_t bytes[DmqHeader::MAX_HEADER_SIZE];
+        ASSERT_TRUE(WriteHeader(header, bytes) == DmqHeader::EXT_HEADER_SIZE);
+        const uint8_t expected[] = { 0xAA, 0x56, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00,
+                                     0x12, 0x34, 0x56, 0x78, 0x00, 0x02, 0x00, 0x00 };
+        ASSERT_TRUE(memcmp(bytes, expected, sizeof(expected)) == 0);
+        ASSERT_TRUE(PeekHeaderSize(bytes) == DmqHeader::EXT_HEADER_SIZE);
+
+        DmqHeader decoded;
+        ASSERT_TRUE(ReadHeader(bytes, sizeof(bytes), decoded) == DmqHeader::EXT_HEADER_SIZE);
+        ASSERT_TRUE(decoded.GetMarker() == DmqHeader::MARKER);
+        ASSERT_TRUE(decoded.GetId() == 0x0102);
+        ASSERT_TRUE(decoded.GetSeqNum32() == 0x12345678);
+        ASSERT_TRUE(decoded.GetLength() == 0x00020000);
+        ASSERT_TRUE(decoded.GetTimestamp() == 0);
+
+        DmqHeader stamped(7, 9);
+        stamped.SetFlags(DmqHeader::FLAG_FRAGMENTED);
+        stamped.SetTimestamp(0x0102030405060708ULL);
+        ASSERT_TRUE(WriteHeader(stamped, bytes) == DmqHeader::MAX_HEADER_SIZE);
+        ASSERT_TRUE(ReadHeader(bytes, DmqHeader::EXT_HEADER_SIZE, decoded) == 0);  // Truncated
+        ASSERT_TRUE(ReadHeader(bytes, sizeof(bytes), decoded) == DmqHeader::MAX_HEADER_SIZE);
+        ASSERT_TRUE(decoded.GetTimestamp() == 0x0102030405060708ULL);
+        ASSERT_TRUE(decoded.GetFlags() == (DmqHeader::FLAG_FRAGMENTED | DmqHeader::FLAG_TIMESTAMP));
+
+        // Unknown extended version and unknown markers are rejected
+        bytes[4] = DmqHeader::EXT_VERSION + 1;
+        ASSERT_TRUE(PeekHeaderSize(bytes) == 0);
+        bytes[1] = 0x57;
+        ASSERT_TRUE(ReadHeader(bytes, sizeof(bytes), decoded) == 0);
+    }
+
+    // Standard headers stay 8 bytes and decode through the size-checked reader
+    {
+        DmqHeader header(3, 0x00012345, 10);
+        ASSERT_TRUE(!header.IsExtended());
+        uint8_t bytes[DmqHeader::MAX_HEADER_SIZE];
+        ASSERT_TRUE(WriteHeader(header, bytes) == DmqHeader::HEADER_SIZE);
+        DmqHeader decoded;
+        ASSERT_TRUE(ReadHeader(bytes, DmqHeader::HEADER_SIZE, decoded) == DmqHeader::HEADER_SIZE);
+        ASSERT_TRUE(decoded.GetSeqNum32() == 0x2345);   // Low 16 bits on the wire
+        ASSERT_TRUE(!decoded.IsExtended());
+    }
+
+    // BatchDispatcher queues records until an explicit flush
+    {
+        MockBufferTransport transport;
+        BatchDispatcher dispatcher;
+        dispatcher.SetTransport(&transport);
+        dispatcher.SetMaxDelay(Duration(0));
+
+        for (int i = 0; i < 3; i++) {
+            xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+            os << "msg" << i;
+            ASSERT_TRUE(dispatcher.Dispatch(os, DelegateRemoteId(110 + i)) == 0);
+        }
+        ASSERT_TRUE(transport.bufferSendCount == 0);
+        ASSERT_TRUE(dispatcher.GetPendingCount() == 3);
+
+        ASSERT_TRUE(dispatcher.Flush() == 0);
+        ASSERT_TRUE(transport.bufferSendCount == 1);
+        ASSERT_TRUE(transport.lastId == BATCH_REMOTE_ID);
+        auto records = UnpackLast(transport);
+        ASSERT_TRUE(records.size() == 3);
+        for (int i = 0; i < 3; i++) {
+            ASSERT_TRUE(records[i].first.GetId() == 110 + i);
+            ASSERT_TRUE(records[i].second == "msg" + std::to_string(i));
+        }
+        ASSERT_TRUE(dispatcher.Flush() == 0);       // Nothing pending
+        ASSERT_TRUE(transport.bufferSendCount == 1);
+    }
+
+    // BatchDispatcher flushes before a record would exceed the frame size
+    {
+        MockBufferTransport transport;
+        BatchDispatcher dispatcher;
+        dispatcher.SetTransport(&transport);
+        dispatcher.SetMaxDelay(Duration(0));
+        dispatcher.SetMaxFrameSize(DmqHeader::HEADER_SIZE + 3 * (DmqHeader::HEADER_SIZE + 4));
+
+        ByteBuffer buffer;
+        buffer.Assign(reinterpret_cast<const uint8_t*>("abcd"), 4);
+        for (int i = 0; i < 7; i++)
+            ASSERT_TRUE(dispatcher.DispatchBuffer(buffer, DelegateRemoteId(120)) == 0);
+        ASSERT_TRUE(transport.bufferSendCount == 2);
+        ASSERT_TRUE(UnpackLast(transport).size() == 3);
+        ASSERT_TRUE(dispatcher.GetPendingCount() == 1);
+
+        // A message too large for any frame is sent on its own, after the pending frame
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os << std::string(64, 'x');
+        ASSERT_TRUE(dispatcher.Dispatch(os, DelegateRemoteId(121)) == 0);
+        ASSERT_TRUE(transport.bufferSendCount == 4);
+        ASSERT_TRUE(transport.lastId == 121);
+        ASSERT_TRUE(transport.lastPayloadSize == 64);
+        ASSERT_TRUE(dispatcher.GetPendingCount() == 0);
+    }
+
+    // A record too large for the 16-bit record length is sent unbatched, not dropped
+    {
+        MockBufferTransport transport;
+        BatchDispatcher dispatcher;
+        dispatcher.SetTransport(&transport);
+        dispatcher.SetMaxDelay(Duration(0));
+        dispatcher.SetMaxFrameSize(200000);
+
+        xostringstream small(std::ios::in | std::ios::out | std::ios::binary);
+        small << "first";
+        ASSERT_TRUE(dispatcher.Dispatch(small, DelegateRemoteId(125)) == 0);
+
+        xostringstream large(std::ios::in | std::ios::out | std::ios::binary);
+        large << std::string(70000, 'y');
+        ASSERT_TRUE(dispatcher.Dispatch(large, DelegateRemoteId(126)) == 0);
+        ASSERT_TRUE(transport.bufferSendCount == 2);        // Pending frame, then the record
+        ASSERT_TRUE(transport.lastId == 126);
+        ASSERT_TRUE(transport.lastPayloadSize == 70000);
+        ASSERT_TRUE(dispatcher.GetPendingCount() == 0);
+    }
+
+    // BatchDispatcher flushes on the max delay timer (driven by Timer::ProcessTimers())
+    {
+        MockBufferTransport transport;
+        BatchDispatcher dispatcher;
+        dispatcher.SetTransport(&transport);
+        dispatcher.SetMaxDelay(std::chrono::milliseconds(5));
+
+        xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+        os << "late";
+        ASSERT_TRUE(dispatcher.Dispatch(os, DelegateRemoteId(130)) == 0);
+        for (int i = 0; i < 200 && dispatcher.GetPendingCount() != 0; i++) {
+            dmq::util::Timer::ProcessTimers();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        ASSERT_TRUE(dispatcher.GetPendingCount() == 0);
+        ASSERT_TRUE(transport.bufferSendCount == 1);
+        ASSERT_TRUE(transport.lastId == BATCH_REMOTE_ID);
+    }
+
+    // Records still pending are flushed when the dispatcher is destroyed
+    {
+        MockBufferTransport transport;
+        {
+            BatchDispatcher dispatcher;
+            dispatcher.SetTransport(&transport);
+            dispatcher.SetMaxDelay(Duration(0));
+
+            xostringstream os(std::ios::in | std::ios::out | std::ios::binary);
+            os << "pending";
+            ASSERT_TRUE(dispatcher.Dispatch(os, DelegateRemoteId(135)) == 0);
+            ASSERT_TRUE(transport.bufferSendCount == 0);
+        }
+        ASSERT_TRUE(transport.bufferSendCount == 1);
+        auto records = UnpackLast(transport);
+        ASSERT_TRUE(records.size() == 1);
+        ASSERT_TRUE(records[0].first.GetId() == 135);
+        ASSERT_TRUE(records[0].second == "pending");
+    }
+
+    // Truncated batch frames are rejected
+    {
+        xstringstream is(std::ios::in | std::ios::out | std::ios::binary);
+        uint8_t bytes[DmqHeader::HEADER_SIZE];
+        WriteHeader(DmqHeader(140, 0, 10), bytes);
+        is.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+        is.write("short", 5);
+        int delivered = 0;
+        ASSERT_TRUE(UnpackBatch(is, [&](const DmqHeader&, xstringstream&) { delivered++; }) == -1);
+        ASSERT_TRUE(delivered == 0);
+    }
+
     // Test RemoteChannel class
     {
         MockTransport transport;
@@ -935,6 +935,90 @@ static void NonSeekableStreamTest()
     ASSERT_TRUE(nss.fail());
 }
 
+// ---------------------------------------------------------------------------
+// ByteBuffer tests
+// ---------------------------------------------------------------------------
+
+static void ByteBufferTests()
+{
+    // Write, read and clear; capacity is kept after Clear()
+    {
+        dmq::ByteBuffer buf;
+        const char text[] = "abcdef";
+        buf.Write(text, 6);
+        ASSERT_TRUE(buf.Size() == 6);
+        ASSERT_TRUE(memcmp(buf.Data(), text, 6) == 0);
+
+        char out[4] = {};
+        ASSERT_TRUE(buf.Read(out, 4) == 4);
+        ASSERT_TRUE(memcmp(out, "abcd", 4) == 0);
+        ASSERT_TRUE(buf.Remaining() == 2);
+        ASSERT_TRUE(buf.Good());
+
+        // Reading past the end fails
+        ASSERT_TRUE(buf.Read(out, 4) == 2);
+        ASSERT_TRUE(!buf.Good());
+
+        size_t capacity = buf.Capacity();
+        const uint8_t* data = buf.Data();
+        buf.Clear();
+        ASSERT_TRUE(buf.Empty() && buf.Good());
+        ASSERT_TRUE(buf.Capacity() == capacity);
+        ASSERT_TRUE(buf.Data() == data);
+    }
+
+    // Stream adapters round-trip objects, including size backfill via seekp()
+    {
+        dmq::ByteBuffer buf;
+        serialize ser;
+        NestedMsg src;
+        src.inner.id = 7;
+        src.inner.value = 3.14f;
+        src.extra = -100;
+        {
+            dmq::ByteBufferOStream os(buf);
+            ser.write(os, src);
+            ASSERT_TRUE(os.good());
+        }
+
+        std::ostringstream oss;
+        ser.write(oss, src);
+        ASSERT_TRUE(buf.Size() == oss.str().size());
+        ASSERT_TRUE(memcmp(buf.Data(), oss.str().data(), buf.Size()) == 0);
+
+        NestedMsg dst;
+        {
+            dmq::ByteBufferIStream is(buf);
+            ser.read(is, dst);
+            ASSERT_TRUE(!is.fail());
+        }
+        ASSERT_TRUE(buf.Good());
+        ASSERT_TRUE(buf.Remaining() == 0);
+        ASSERT_TRUE(dst.inner.id == 7 && dst.extra == -100);
+    }
+
+    // ISerializer buffer overloads; a warm buffer is reused without reallocation
+    {
+        dmq::serialization::serializer::Serializer<void(int, std::string)> ser;
+        dmq::ByteBuffer buf(256);
+        const uint8_t* data = buf.Data();
+
+        for (int i = 0; i < 10; i++)
+        {
+            ser.WriteBuffer(buf, i, std::string("payload"));
+            ASSERT_TRUE(buf.Good() && buf.Size() > 0);
+            ASSERT_TRUE(buf.Data() == data);
+
+            int outInt = -1;
+            std::string outStr;
+            ser.ReadBuffer(buf, outInt, outStr);
+            ASSERT_TRUE(buf.Good());
+            ASSERT_TRUE(outInt == i);
+            ASSERT_TRUE(outStr == "payload");
+        }
+    }
+}
+
 // ---------------------------------------------------------------------------
 // Entry point
 // ---------------------------------------------------------------------------
@@ -953,4 +1037,5 @@ void SerializeTests()
     MultiObjectStreamTests();
     EmptyStringBugFixTest();
     NonSeekableStreamTest();
+    ByteBufferTests();
 }
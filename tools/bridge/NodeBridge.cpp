@@ -7,6 +7,7 @@
 #include "extras/util/Timer.h"
 #include "extras/util/ThreadMonitor.h"
 #include "extras/util/ThreadMonitorSer.h"
+#include "extras/util/AllocatorMonitorSer.h"
 #include <iostream>
 #include <sstream>
 
@@ -82,6 +83,26 @@ void NodeBridge::InitTelemetry(const std::string& address, uint16_t port, bool i
         }
     }, instance.thread.get());
 
+    static dmq::util::AllocatorStatsPacketSerializer allocatorSerializer;
+    dmq::databus::DataBus::RegisterSerializer<dmq::util::AllocatorStatsPacket>("AllocatorStats", allocatorSerializer);
+    dmq::databus::DataBus::RegisterStringifier<dmq::util::AllocatorStatsPacket>("AllocatorStats", dmq::util::AllocatorStatsPacketToString);
+
+    // Subscribe to AllocatorStats. Asynchronous delivery to NodeBridge thread.
+    instance.allocatorStatsConn = dmq::databus::DataBus::Subscribe<dmq::util::AllocatorStatsPacket>("AllocatorStats", [](const dmq::util::AllocatorStatsPacket& packet) {
+        auto& inst = GetInstance();
+        std::ostringstream oss(std::ios::binary);
+        static dmq::util::AllocatorStatsPacketSerializer ser;
+        ser.Write(oss, packet);
+        if (oss.good()) {
+            std::string body = oss.str();
+            std::string buf;
+            buf.reserve(1 + body.size());
+            buf.push_back(static_cast<char>(dmq::PacketType::AllocatorStats));
+            buf.append(body);
+            inst.telemetrySocket.Send(buf.data(), buf.size());
+        }
+    }, instance.thread.get());
+
     instance.telemetrySocket.Create();
     if (isMulticast && !localInterface.empty() && localInterface != "0.0.0.0") {
 #ifdef _WIN32
@@ -140,6 +161,7 @@ void NodeBridge::Stop() {
 
     instance.monitorConn.Disconnect();
     instance.threadStatsConn.Disconnect();
+    instance.allocatorStatsConn.Disconnect();
     instance.timerConn.Disconnect();
     
     instance.thread->ExitThread();
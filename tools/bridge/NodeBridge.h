@@ -72,6 +72,7 @@ private:
 
         dmq::ScopedConnection monitorConn;
         dmq::ScopedConnection threadStatsConn;
+        dmq::ScopedConnection allocatorStatsConn;
         dmq::ScopedConnection timerConn;
         dmq::util::Timer heartbeatTimer;
         UdpSocket telemetrySocket;
@@ -14,6 +14,7 @@ namespace dmq {
 enum class PacketType : uint8_t {
     NodeInfo    = 1,
     ThreadStats = 2,
+    AllocatorStats = 3,
 };
 
 /// @brief Heartbeat packet broadcast by NodeBridge to identify a node on the DataBus network.
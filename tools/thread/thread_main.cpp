@@ -12,6 +12,7 @@
 #include "UdpSocket.h"
 #include "NodeInfoPacket.h"
 #include "extras/util/ThreadMonitorSer.h"
+#include "extras/util/AllocatorMonitorSer.h"
 #include "extras/util/NetworkConnect.h"
 
 #include <iostream>
@@ -34,8 +35,15 @@ struct ThreadRecord {
     std::string ip;
 };
 
+struct AllocatorRecord {
+    dmq::util::AllocatorStatsPacket packet;
+    std::chrono::steady_clock::time_point lastSeen;
+    std::string ip;
+};
+
 // Global state
 static std::map<std::string, ThreadRecord> g_threads;
+static std::map<std::string, AllocatorRecord> g_allocators;
 static std::mutex g_threadsMutex;
 static std::atomic<bool> g_running{true};
 static std::atomic<uint32_t> g_packetCount{0};
@@ -46,6 +54,11 @@ static std::string MakeKey(const dmq::util::ThreadStatsPacket& p, const std::str
     return ip + ":" + p.cpu_name + ":" + p.thread_name;
 }
 
+// Unique key: IP + CPU + block size
+static std::string MakeKey(const dmq::util::AllocatorStatsPacket& p, const std::string& ip) {
+    return ip + ":" + p.cpu_name + ":" + std::to_string(p.block_size);
+}
+
 static void ReceiverThread(uint16_t port, std::string multicastGroup, std::string localInterface) {
     UdpSocket socket;
     if (!socket.Create()) {
@@ -68,6 +81,7 @@ static void ReceiverThread(uint16_t port, std::string multicastGroup, std::strin
     socket.SetReceiveTimeout(100);
     std::vector<uint8_t> buffer(16384);
     dmq::util::ThreadStatsPacketSerializer serializer;
+    dmq::util::AllocatorStatsPacketSerializer allocatorSerializer;
 
     while (g_running) {
         int received = socket.Receive(buffer.data(), (int)buffer.size());
@@ -75,14 +89,31 @@ static void ReceiverThread(uint16_t port, std::string multicastGroup, std::strin
             std::string senderIp = socket.GetRemoteAddress();
             g_packetCount++;
 
-            if (received < 2 ||
-                static_cast<dmq::PacketType>(buffer[0]) != dmq::PacketType::ThreadStats) {
+            if (received < 2)
                 continue;
-            }
 
-            dmq::util::ThreadStatsPacket packet;
+            auto type = static_cast<dmq::PacketType>(buffer[0]);
             std::string data(reinterpret_cast<char*>(buffer.data() + 1), received - 1);
             std::istringstream iss(data, std::ios::binary);
+
+            if (type == dmq::PacketType::AllocatorStats) {
+                dmq::util::AllocatorStatsPacket packet;
+                allocatorSerializer.Read(iss, packet);
+                if (iss.good() && packet.block_size != 0) {
+                    std::string key = MakeKey(packet, senderIp);
+                    std::lock_guard<std::mutex> lock(g_threadsMutex);
+                    AllocatorRecord& rec = g_allocators[key];
+                    rec.packet = std::move(packet);
+                    rec.lastSeen = std::chrono::steady_clock::now();
+                    rec.ip = senderIp;
+                }
+                continue;
+            }
+
+            if (type != dmq::PacketType::ThreadStats)
+                continue;
+
+            dmq::util::ThreadStatsPacket packet;
             serializer.Read(iss, packet);
 
             if (!packet.thread_name.empty()) {
@@ -124,9 +155,11 @@ int main(int argc, char* argv[]) {
 
     auto renderer = Renderer([&] {
         std::vector<ThreadRecord> records;
+        std::vector<AllocatorRecord> allocators;
         {
             std::lock_guard<std::mutex> lock(g_threadsMutex);
             for (auto& pair : g_threads) records.push_back(pair.second);
+            for (auto& pair : g_allocators) allocators.push_back(pair.second);
         }
 
         // Sort by CPU then Thread
@@ -199,11 +232,85 @@ int main(int argc, char* argv[]) {
                 text(" " + fmtFloat(p.invoke_max_all_ms)) | size(WIDTH, EQUAL, 10),
             }));
             }
-        return vbox({
-            text("DelegateMQ Thread Monitor") | bold | color(Color::Cyan) | center,
-            text(" Packets: " + std::to_string(g_packetCount)) | dim,
-            vbox(std::move(rows)) | border,
+        // Memory pools panel: one row per xallocator size class
+        std::sort(allocators.begin(), allocators.end(), [](const AllocatorRecord& a, const AllocatorRecord& b) {
+            if (a.ip != b.ip) return a.ip < b.ip;
+            if (a.packet.cpu_name != b.packet.cpu_name) return a.packet.cpu_name < b.packet.cpu_name;
+            return a.packet.block_size < b.packet.block_size;
         });
+
+        Elements poolRows;
+        poolRows.push_back(hbox({
+            text(" CPU")           | bold | size(WIDTH, EQUAL, 12),
+            separator(),
+            text(" IP")            | bold | size(WIDTH, EQUAL, 15),
+            separator(),
+            text(" Block")         | bold | size(WIDTH, EQUAL, 8),
+            separator(),
+            text(" InUse")         | bold | size(WIDTH, EQUAL, 8),
+            separator(),
+            text(" Max")           | bold | size(WIDTH, EQUAL, 8),
+            separator(),
+            text(" Pool")          | bold | size(WIDTH, EQUAL, 8),
+            separator(),
+            text(" Created")       | bold | size(WIDTH, EQUAL, 8),
+            separator(),
+            text(" Alloc/s")       | bold | size(WIDTH, EQUAL, 10),
+            separator(),
+            text(" Free/s")        | bold | size(WIDTH, EQUAL, 10),
+            separator(),
+            text(" Exhausted")     | bold | size(WIDTH, EQUAL, 10),
+            }) | color(Color::White));
+        poolRows.push_back(separator());
+
+        for (const auto& rec : allocators) {
+            auto& p = rec.packet;
+
+            auto fmtRate = [](float f) {
+                std::stringstream ss;
+                ss << std::fixed << std::setprecision(1) << f;
+                return ss.str();
+            };
+
+            // Highlight a pool that ran out, or is close to its limit
+            Color rowColor = Color::Default;
+            if (p.max_blocks && p.blocks_in_use_max >= p.max_blocks)
+                rowColor = Color::Yellow;
+            if (p.exhausted_count)
+                rowColor = Color::Red;
+
+            poolRows.push_back(hbox({
+                text(" " + p.cpu_name)    | size(WIDTH, EQUAL, 12),
+                separator(),
+                text(" " + rec.ip)        | size(WIDTH, EQUAL, 15),
+                separator(),
+                text(" " + std::to_string(p.block_size)) | size(WIDTH, EQUAL, 8),
+                separator(),
+                text(" " + std::to_string(p.blocks_in_use)) | size(WIDTH, EQUAL, 8),
+                separator(),
+                text(" " + std::to_string(p.blocks_in_use_max)) | size(WIDTH, EQUAL, 8),
+                separator(),
+                text(p.max_blocks ? " " + std::to_string(p.max_blocks) : " heap") | size(WIDTH, EQUAL, 8),
+                separator(),
+                text(" " + std::to_string(p.block_count)) | size(WIDTH, EQUAL, 8),
+                separator(),
+                text(" " + fmtRate(p.alloc_rate)) | size(WIDTH, EQUAL, 10),
+                separator(),
+                text(" " + fmtRate(p.free_rate)) | size(WIDTH, EQUAL, 10),
+                separator(),
+                text(" " + std::to_string(p.exhausted_count)) | size(WIDTH, EQUAL, 10),
+            }) | color(rowColor));
+        }
+
+        Elements panels;
+        panels.push_back(text("DelegateMQ Thread Monitor") | bold | color(Color::Cyan) | center);
+        panels.push_back(text(" Packets: " + std::to_string(g_packetCount)) | dim);
+        panels.push_back(vbox(std::move(rows)) | border);
+        if (!allocators.empty()) {
+            panels.push_back(text(" Memory Pools (xallocator)") | bold);
+            panels.push_back(vbox(std::move(poolRows)) | border);
+        }
+        return vbox(std::move(panels));
     });
 
     auto component = CatchEvent(renderer, [&](Event event) {